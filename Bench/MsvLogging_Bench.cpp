@@ -0,0 +1,263 @@
+
+#include "pch.h"
+
+#include "msys/logging/MsvBinaryLog.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+//maximum number of latencies stored by one benchmark thread
+const size_t MSV_BENCH_LATENCY_SAMPLES = 1 << 20;
+
+//number of records written by one iteration of throughput benchmark
+const int64_t MSV_BENCH_LOG_BATCH = 1024;
+
+
+enum class MsvBenchLogMode
+{
+	SYNC,
+	ASYNC
+};
+
+
+static std::shared_ptr<MsvLogger> GetBenchLogger(MsvBenchLogMode mode, const char* loggerName, const char* logFile = nullptr, int maxLogFileSize = 10485760)
+{
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider;
+	if (mode == MsvBenchLogMode::SYNC)
+	{
+		spLoggerProvider = MsvSys_BenchEnvironment::GetSyncLoggerProvider();
+	}
+	else
+	{
+		spLoggerProvider = MsvSys_BenchEnvironment::GetAsyncLoggerProvider();
+	}
+
+	if (!spLoggerProvider)
+	{
+		return nullptr;
+	}
+
+	return logFile ? spLoggerProvider->GetLogger(loggerName, logFile, maxLogFileSize, 2) : spLoggerProvider->GetLogger(loggerName);
+}
+
+static void FlushBenchLogger(MsvBenchLogMode mode, const std::shared_ptr<MsvLogger>& spLogger)
+{
+	if (mode == MsvBenchLogMode::SYNC)
+	{
+		spLogger->flush();
+	}
+	else
+	{
+		MsvSys_BenchEnvironment::GetAsyncLoggerProvider()->Flush();
+	}
+}
+
+static void SetLatencyCounters(benchmark::State& state, std::vector<int64_t>& latencies)
+{
+	if (latencies.empty())
+	{
+		return;
+	}
+
+	std::sort(latencies.begin(), latencies.end());
+
+	//each benchmark thread has its own latencies -> counters are averaged over threads
+	state.counters["latency_p50_ns"] = benchmark::Counter(static_cast<double>(latencies[latencies.size() * 50 / 100]), benchmark::Counter::kAvgThreads);
+	state.counters["latency_p99_ns"] = benchmark::Counter(static_cast<double>(latencies[latencies.size() * 99 / 100]), benchmark::Counter::kAvgThreads);
+	state.counters["latency_p999_ns"] = benchmark::Counter(static_cast<double>(latencies[latencies.size() * 999 / 1000]), benchmark::Counter::kAvgThreads);
+	state.counters["latency_p9999_ns"] = benchmark::Counter(static_cast<double>(latencies[latencies.size() * 9999 / 10000]), benchmark::Counter::kAvgThreads);
+	state.counters["latency_max_ns"] = benchmark::Counter(static_cast<double>(latencies.back()), benchmark::Counter::kAvgThreads);
+}
+
+
+static void BM_LogCallLatency(benchmark::State& state, MsvBenchLogMode mode)
+{
+	std::shared_ptr<MsvLogger> spLogger = GetBenchLogger(mode, "LogCallLatency");
+	if (!spLogger)
+	{
+		state.SkipWithError("Logger creation failed.");
+		return;
+	}
+
+	std::vector<int64_t> latencies;
+	latencies.reserve(MSV_BENCH_LATENCY_SAMPLES);
+
+	//one iteration is one log call (clock reads are included in measured time)
+	int64_t i = 0;
+	for (auto _: state)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		spLogger->info("Module {} has been successfully started ({}).", "MsvBenchModule", i++);
+		int64_t latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+		if (latencies.size() < MSV_BENCH_LATENCY_SAMPLES)
+		{
+			latencies.push_back(latency);
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations());
+	SetLatencyCounters(state, latencies);
+
+	if (state.thread_index() == 0)
+	{
+		FlushBenchLogger(mode, spLogger);
+	}
+}
+BENCHMARK_CAPTURE(BM_LogCallLatency, sync, MsvBenchLogMode::SYNC)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_LogCallLatency, async, MsvBenchLogMode::ASYNC)->ThreadRange(1, 16)->UseRealTime();
+
+
+static void BM_BinaryLogCallLatency(benchmark::State& state)
+{
+	static std::shared_ptr<IMsvBinaryLogger> spLogger;
+
+	if (state.thread_index() == 0)
+	{
+		if (MSV_FAILED(MsvSys_BenchEnvironment::GetLogging()->GetBinaryLogger(spLogger, "BinaryLogCallLatency", "msysBench_binary.mblog")))
+		{
+			state.SkipWithError("Binary logger creation failed.");
+		}
+	}
+
+	std::vector<int64_t> latencies;
+	latencies.reserve(MSV_BENCH_LATENCY_SAMPLES);
+
+	int64_t i = 0;
+	for (auto _: state)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		MSV_BLOG_INFO(spLogger, "Module {} has been successfully started ({}).", "MsvBenchModule", i++);
+		int64_t latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+		if (latencies.size() < MSV_BENCH_LATENCY_SAMPLES)
+		{
+			latencies.push_back(latency);
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations());
+	SetLatencyCounters(state, latencies);
+
+	if (state.thread_index() == 0)
+	{
+		spLogger->Flush();
+		spLogger.reset();
+	}
+}
+BENCHMARK(BM_BinaryLogCallLatency)->ThreadRange(1, 16)->UseRealTime();
+
+
+static void BM_LogSustainedThroughput(benchmark::State& state, MsvBenchLogMode mode)
+{
+	std::shared_ptr<MsvLogger> spLogger = GetBenchLogger(mode, "LogSustainedThroughput");
+	if (!spLogger)
+	{
+		state.SkipWithError("Logger creation failed.");
+		return;
+	}
+
+	//records are flushed in each iteration -> lines/s include writing to file
+	int64_t i = 0;
+	for (auto _: state)
+	{
+		for (int64_t record = 0; record < MSV_BENCH_LOG_BATCH; ++record)
+		{
+			spLogger->info("Executing task of module {} ({}).", "MsvBenchModule", i++);
+		}
+
+		FlushBenchLogger(mode, spLogger);
+	}
+
+	state.SetItemsProcessed(state.iterations() * MSV_BENCH_LOG_BATCH);
+}
+BENCHMARK_CAPTURE(BM_LogSustainedThroughput, sync, MsvBenchLogMode::SYNC)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_CAPTURE(BM_LogSustainedThroughput, async, MsvBenchLogMode::ASYNC)->ThreadRange(1, 8)->UseRealTime();
+
+
+static void BM_LogRotationStall(benchmark::State& state, MsvBenchLogMode mode)
+{
+	//1 MB files and 200 B records -> file is rotated every ~5000 log calls
+	std::shared_ptr<MsvLogger> spLogger = GetBenchLogger(mode, mode == MsvBenchLogMode::SYNC ? "LogRotationStall_sync" : "LogRotationStall_async",
+		mode == MsvBenchLogMode::SYNC ? "msysBench_rotation_sync.txt" : "msysBench_rotation_async.txt", 1048576);
+	if (!spLogger)
+	{
+		state.SkipWithError("Logger creation failed.");
+		return;
+	}
+
+	std::string payload(160, 'x');
+	std::vector<int64_t> latencies;
+	latencies.reserve(MSV_BENCH_LATENCY_SAMPLES);
+
+	//rotation stalls are visible in highest percentiles and maximum
+	for (auto _: state)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		spLogger->info("Rotated record {}.", payload);
+		int64_t latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+		if (latencies.size() < MSV_BENCH_LATENCY_SAMPLES)
+		{
+			latencies.push_back(latency);
+		}
+	}
+
+	SetLatencyCounters(state, latencies);
+	FlushBenchLogger(mode, spLogger);
+}
+BENCHMARK_CAPTURE(BM_LogRotationStall, sync, MsvBenchLogMode::SYNC)->Iterations(200000)->UseRealTime();
+BENCHMARK_CAPTURE(BM_LogRotationStall, async, MsvBenchLogMode::ASYNC)->Iterations(200000)->UseRealTime();
+
+
+static void BM_LogSlowSink(benchmark::State& state)
+{
+	static uint64_t droppedRecords = 0;
+
+	//long records do not fit to inline payload and many producers outrun background writer
+	std::shared_ptr<MsvLogger> spLogger = GetBenchLogger(MsvBenchLogMode::ASYNC, "LogSlowSink");
+	if (!spLogger)
+	{
+		state.SkipWithError("Logger creation failed.");
+		return;
+	}
+
+	if (state.thread_index() == 0)
+	{
+		droppedRecords = MsvSys_BenchEnvironment::GetAsyncLoggerProvider()->GetDroppedRecordsCount();
+	}
+
+	std::string payload(1024, 'x');
+	std::vector<int64_t> latencies;
+	latencies.reserve(MSV_BENCH_LATENCY_SAMPLES);
+
+	for (auto _: state)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		spLogger->info("Slow sink record {}.", payload);
+		int64_t latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+		if (latencies.size() < MSV_BENCH_LATENCY_SAMPLES)
+		{
+			latencies.push_back(latency);
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations());
+	SetLatencyCounters(state, latencies);
+
+	if (state.thread_index() == 0)
+	{
+		//overflow policy is selected by --msv_log_overflow (blocked producers have high latency, dropped records are counted)
+		MsvSys_BenchEnvironment::GetAsyncLoggerProvider()->Flush();
+		state.counters["dropped_records"] = static_cast<double>(MsvSys_BenchEnvironment::GetAsyncLoggerProvider()->GetDroppedRecordsCount() - droppedRecords);
+	}
+}
+BENCHMARK(BM_LogSlowSink)->ThreadRange(1, 32)->UseRealTime();
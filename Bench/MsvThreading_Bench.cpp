@@ -0,0 +1,220 @@
+
+#include "pch.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+//number of tasks submitted by one producer in one iteration
+const int64_t MSV_BENCH_TASK_BATCH = 256;
+
+
+static void BM_ThreadPoolSubmitComplete(benchmark::State& state)
+{
+	static std::shared_ptr<IMsvThreadPool> spThreadPool;
+
+	if (state.thread_index() == 0)
+	{
+		if (MSV_FAILED(MsvSys_BenchEnvironment::GetThreading()->GetThreadPool(spThreadPool)) || MSV_FAILED(spThreadPool->StartThreadPool()))
+		{
+			spThreadPool.reset();
+			state.SkipWithError("Thread pool start failed.");
+
+			//other threads wait for this one at start and end of benchmark loop
+			for (auto _: state)
+			{
+			}
+
+			return;
+		}
+	}
+
+	//each producer waits for its own tasks -> submit and complete are measured together
+	std::atomic<int64_t> completed(0);
+	std::function<void(void*)> task = [&completed](void*) { completed.fetch_add(1, std::memory_order_release); };
+
+	for (auto _: state)
+	{
+		//thread pool is set before the loop starts (it is empty when it could not be started)
+		if (!spThreadPool)
+		{
+			state.SkipWithError("Thread pool start failed.");
+			continue;
+		}
+
+		completed.store(0, std::memory_order_relaxed);
+
+		for (int64_t i = 0; i < MSV_BENCH_TASK_BATCH; ++i)
+		{
+			spThreadPool->AddTask(task, nullptr);
+		}
+
+		while (completed.load(std::memory_order_acquire) < MSV_BENCH_TASK_BATCH)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * MSV_BENCH_TASK_BATCH);
+
+	if (state.thread_index() == 0 && spThreadPool)
+	{
+		spThreadPool->StopAndWaitForThreadPoolStop();
+		spThreadPool.reset();
+	}
+}
+BENCHMARK(BM_ThreadPoolSubmitComplete)->ThreadRange(1, 32)->UseRealTime();
+
+
+static void BM_EventPingPong(benchmark::State& state)
+{
+	std::shared_ptr<IMsvEvent> spPing;
+	std::shared_ptr<IMsvEvent> spPong;
+	if (MSV_FAILED(MsvSys_BenchEnvironment::GetThreading()->GetEvent(spPing)) || MSV_FAILED(MsvSys_BenchEnvironment::GetThreading()->GetEvent(spPong)))
+	{
+		state.SkipWithError("Event creation failed.");
+		return;
+	}
+
+	std::atomic<bool> running(true);
+	std::thread ponger([&]()
+	{
+		while (true)
+		{
+			spPing->WaitForEvent();
+			if (!running)
+			{
+				break;
+			}
+
+			spPong->SetEvent();
+		}
+	});
+
+	//one iteration is one round trip (two event wake ups)
+	for (auto _: state)
+	{
+		spPing->SetEvent();
+		spPong->WaitForEvent();
+	}
+
+	running = false;
+	spPing->SetEvent();
+	ponger.join();
+}
+BENCHMARK(BM_EventPingPong)->UseRealTime();
+
+
+static void BM_UniqueWorkerPeriodJitter(benchmark::State& state)
+{
+	const uint64_t period = static_cast<uint64_t>(state.range(0));
+	const size_t ticks = 200;
+
+	std::shared_ptr<IMsvUniqueWorker> spUniqueWorker;
+	std::shared_ptr<IMsvEvent> spDone;
+	if (MSV_FAILED(MsvSys_BenchEnvironment::GetThreading()->GetUniqueWorker(spUniqueWorker)) || MSV_FAILED(MsvSys_BenchEnvironment::GetThreading()->GetEvent(spDone)))
+	{
+		state.SkipWithError("Unique worker creation failed.");
+		return;
+	}
+
+	std::vector<std::chrono::steady_clock::time_point> timestamps;
+	timestamps.reserve(ticks);
+
+	//task is executed by one worker thread -> timestamps are not shared
+	spUniqueWorker->SetTask([&](void*)
+	{
+		if (timestamps.size() < ticks)
+		{
+			timestamps.push_back(std::chrono::steady_clock::now());
+			if (timestamps.size() == ticks)
+			{
+				spDone->SetEvent();
+			}
+		}
+	}, nullptr);
+
+	for (auto _: state)
+	{
+		timestamps.clear();
+		spUniqueWorker->StartThread(period);
+		spDone->WaitForEvent();
+		spUniqueWorker->StopThread();
+		spUniqueWorker->WaitForThreadStop();
+	}
+
+	std::vector<double> jitters;
+	for (size_t i = 1; i < timestamps.size(); ++i)
+	{
+		double interval = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(timestamps[i] - timestamps[i - 1]).count());
+		jitters.push_back(std::abs(interval - static_cast<double>(period)));
+	}
+
+	if (jitters.empty())
+	{
+		return;
+	}
+
+	std::sort(jitters.begin(), jitters.end());
+
+	double sum = 0;
+	for (double jitter: jitters)
+	{
+		sum += jitter;
+	}
+
+	state.counters["jitter_mean_us"] = sum / static_cast<double>(jitters.size());
+	state.counters["jitter_p99_us"] = jitters[jitters.size() * 99 / 100];
+	state.counters["jitter_max_us"] = jitters.back();
+}
+BENCHMARK(BM_UniqueWorkerPeriodJitter)->Arg(1000)->Arg(10000)->Iterations(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+
+static void BM_SharedThreadPoolContention(benchmark::State& state)
+{
+	static std::atomic<int64_t> submitted(0);
+	static std::atomic<int64_t> completed(0);
+
+	std::shared_ptr<IMsvThreadPool> spThreadPool;
+	if (state.thread_index() == 0)
+	{
+		submitted = 0;
+		completed = 0;
+
+		if (MSV_FAILED(MsvSys_BenchEnvironment::GetThreading()->GetSharedThreadPool(spThreadPool)) || MSV_FAILED(spThreadPool->StartThreadPool()))
+		{
+			state.SkipWithError("Shared thread pool start failed.");
+		}
+	}
+
+	std::function<void(void*)> task = [](void*) { completed.fetch_add(1, std::memory_order_relaxed); };
+
+	//every producer resolves shared pool and submits to it (facade lock and pool queue contention)
+	for (auto _: state)
+	{
+		std::shared_ptr<IMsvThreadPool> spSharedThreadPool;
+		MsvSys_BenchEnvironment::GetThreading()->GetSharedThreadPool(spSharedThreadPool);
+		spSharedThreadPool->AddTask(task, nullptr);
+		submitted.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	state.SetItemsProcessed(state.iterations());
+
+	if (state.thread_index() == 0)
+	{
+		//all producers have finished (end barrier) -> wait for queued tasks outside of measurement
+		while (completed.load(std::memory_order_relaxed) < submitted.load(std::memory_order_relaxed))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+BENCHMARK(BM_SharedThreadPoolContention)->ThreadRange(1, 32)->UseRealTime();
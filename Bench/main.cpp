@@ -0,0 +1,87 @@
+
+#include "pch.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstring>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+std::shared_ptr<IMsvLoggerProvider> MsvSys_BenchEnvironment::m_spLoggerProvider;
+std::shared_ptr<MsvLogger> MsvSys_BenchEnvironment::m_spLogger;
+std::shared_ptr<IMsvDllFactory> MsvSys_BenchEnvironment::m_spDllFactory;
+std::shared_ptr<IMsvSys> MsvSys_BenchEnvironment::m_spSys;
+std::shared_ptr<IMsvThreading> MsvSys_BenchEnvironment::m_spThreading;
+std::shared_ptr<IMsvLogging> MsvSys_BenchEnvironment::m_spLogging;
+std::shared_ptr<IMsvLoggerProvider> MsvSys_BenchEnvironment::m_spSyncLoggerProvider;
+std::shared_ptr<IMsvAsyncLoggerProvider> MsvSys_BenchEnvironment::m_spAsyncLoggerProvider;
+
+
+int main(int argc, char** argv)
+{
+	//results are written as JSON (to compare builds) unless output is set explicitly
+	std::vector<char*> args(argv, argv + 1);
+	char outArg[] = "--benchmark_out=msysBench.json";
+	char outFormatArg[] = "--benchmark_out_format=json";
+	const char* overflowArg = "--msv_log_overflow=";
+
+	//overflow policy of async logger provider (block, drop or count) is not passed to benchmark library
+	MsvLogOverflowPolicy overflowPolicy = MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_BLOCK;
+
+	bool outSet = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strncmp(argv[i], overflowArg, std::strlen(overflowArg)) == 0)
+		{
+			const char* policy = argv[i] + std::strlen(overflowArg);
+			if (std::strcmp(policy, "drop") == 0)
+			{
+				overflowPolicy = MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_DROP;
+			}
+			else if (std::strcmp(policy, "count") == 0)
+			{
+				overflowPolicy = MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_DROP_AND_COUNT;
+			}
+			else if (std::strcmp(policy, "block") != 0)
+			{
+				return 1;
+			}
+
+			continue;
+		}
+
+		if (std::strncmp(argv[i], "--benchmark_out=", std::strlen("--benchmark_out=")) == 0)
+		{
+			outSet = true;
+		}
+
+		args.push_back(argv[i]);
+	}
+
+	if (!outSet)
+	{
+		args.push_back(outArg);
+		args.push_back(outFormatArg);
+	}
+
+	int argsCount = static_cast<int>(args.size());
+	benchmark::Initialize(&argsCount, args.data());
+	if (benchmark::ReportUnrecognizedArguments(argsCount, args.data()))
+	{
+		return 1;
+	}
+
+	if (MSV_FAILED(MsvSys_BenchEnvironment::InitializeSys(overflowPolicy)))
+	{
+		return 1;
+	}
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+
+	MsvSys_BenchEnvironment::UninitializeSys();
+
+	return 0;
+}
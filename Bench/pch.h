@@ -0,0 +1,113 @@
+//
+// pch.h
+// Header for standard system include files.
+//
+
+#pragma once
+
+
+#include "msys/msys/MsvSysDll_Interface.h"
+
+#include "mdllfactory/MsvDllFactory.h"
+#include "mdllfactory/MsvDllList.h"
+#include "merror/MsvErrorCodes.h"
+#include "mlogging/MsvSpdLogLoggerProvider.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include "benchmark/benchmark.h"
+
+MSV_ENABLE_WARNINGS
+
+
+class MsvSys_BenchEnvironment
+{
+public:
+	//benchmark threads call fixture SetUp in parallel -> sys is initialized once in main
+	static MsvErrorCode InitializeSys(MsvLogOverflowPolicy overflowPolicy = MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_BLOCK)
+	{
+		m_spLoggerProvider.reset(new (std::nothrow) MsvNullLoggerProvider());
+		if (!m_spLoggerProvider)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+
+		m_spLogger = m_spLoggerProvider->GetLogger();
+
+		//prepare DLL list for factory
+		std::shared_ptr<MsvDllList> spDllList(new (std::nothrow) MsvDllList(m_spLogger));
+		if (!spDllList)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+
+		MSV_RETURN_FAILED(spDllList->AddDll(MSV_SYS_OBJECT_ID_LAST, "msys.dll"));
+
+		//initialize DLL factory
+		m_spDllFactory.reset(new (std::nothrow) MsvDllFactory(spDllList, m_spLogger));
+		if (!m_spDllFactory)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+
+		//get DLL object IMsvSys from msys.dll
+		MSV_RETURN_FAILED(m_spDllFactory->GetDllObject<IMsvSys>(MSV_SYS_OBJECT_ID_LAST, m_spSys));
+		MSV_RETURN_FAILED(m_spSys->GetMsvThreading(m_spThreading));
+		MSV_RETURN_FAILED(m_spSys->GetMsvLogging(m_spLogging));
+
+		//synchronous provider of mlogging (logging allows one shared provider)
+		m_spSyncLoggerProvider.reset(new (std::nothrow) MsvLoggerProvider("", "msysBench_sync.txt"));
+		if (!m_spSyncLoggerProvider)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+
+		MSV_RETURN_FAILED(m_spLogging->GetAsyncLoggerProvider(m_spAsyncLoggerProvider, "", "msysBench_async.txt", 10485760, 3, 8192, overflowPolicy));
+
+		return MSV_SUCCESS;
+	}
+
+	static void UninitializeSys()
+	{
+		m_spAsyncLoggerProvider.reset();
+		m_spSyncLoggerProvider.reset();
+		m_spLogging.reset();
+		m_spThreading.reset();
+		m_spSys.reset();
+		m_spDllFactory.reset();
+		m_spLogger.reset();
+		m_spLoggerProvider.reset();
+	}
+
+	static std::shared_ptr<IMsvThreading> GetThreading()
+	{
+		return m_spThreading;
+	}
+
+	static std::shared_ptr<IMsvLogging> GetLogging()
+	{
+		return m_spLogging;
+	}
+
+	static std::shared_ptr<IMsvLoggerProvider> GetSyncLoggerProvider()
+	{
+		return m_spSyncLoggerProvider;
+	}
+
+	static std::shared_ptr<IMsvAsyncLoggerProvider> GetAsyncLoggerProvider()
+	{
+		return m_spAsyncLoggerProvider;
+	}
+
+	//logger
+	static std::shared_ptr<IMsvLoggerProvider> m_spLoggerProvider;
+	static std::shared_ptr<MsvLogger> m_spLogger;
+
+	//benchmarked functions and classes
+	static std::shared_ptr<IMsvDllFactory> m_spDllFactory;
+	static std::shared_ptr<IMsvSys> m_spSys;
+	static std::shared_ptr<IMsvThreading> m_spThreading;
+	static std::shared_ptr<IMsvLogging> m_spLogging;
+	static std::shared_ptr<IMsvLoggerProvider> m_spSyncLoggerProvider;
+	static std::shared_ptr<IMsvAsyncLoggerProvider> m_spAsyncLoggerProvider;
+};
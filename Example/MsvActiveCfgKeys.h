@@ -58,7 +58,10 @@ enum class MsvActiveCfgKey: int32_t
 	MSV_DYNAMIC_MODULE1_INSTALLED,
 	MSV_DYNAMIC_MODULE1_ENABLED,
 	MSV_DYNAMIC_MODULE2_INSTALLED,
-	MSV_DYNAMIC_MODULE2_ENABLED
+	MSV_DYNAMIC_MODULE2_ENABLED,
+
+	//logging config IDs
+	MSV_MAIN_LOG_LEVEL
 };
 
 
@@ -32,9 +32,10 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 
 
 #include "MsvMain.h"
+#include "MsvActiveCfgKeys.h"
 #include "MsvMain_Factory.h"
 
-#include "mlogging/mlogging.h"
+#include "msys/logging/MsvLogMacros.h"
 #include "merror/MsvErrorCodes.h"
 
 
@@ -160,6 +161,8 @@ MsvErrorCode MsvMain::Uninitialize()
 	m_spModuleManager.reset();
 	m_spModules.reset();
 
+	m_spLogLevelBinding.reset();
+
 	if (MSV_FAILED(errorCode = m_spActiveCfg->Uninitialize()))
 	{
 		MSV_LOG_ERROR(m_spLogger, "Uninitialize active config failed with error: {0:x}", errorCode);
@@ -366,6 +369,25 @@ MsvErrorCode MsvMain::InitializeActiveConfig()
 		return errorCode;
 	}
 
+	std::shared_ptr<IMsvLogging> spLogging;
+	if (MSV_FAILED(errorCode = m_spSys->GetMsvLogging(spLogging)))
+	{
+		MSV_LOG_ERROR(m_spLogger, "Get logging from SYS failed with error: {0:x}", errorCode);
+		return errorCode;
+	}
+
+	if (MSV_FAILED(errorCode = spLogging->GetLogLevelBinding(m_spLogLevelBinding, m_spActiveCfg)))
+	{
+		MSV_LOG_ERROR(m_spLogger, "Get log level binding failed with error: {0:x}", errorCode);
+		return errorCode;
+	}
+
+	if (MSV_FAILED(errorCode = m_spLogLevelBinding->BindLogger(m_spLogger, static_cast<int32_t>(MsvActiveCfgKey::MSV_MAIN_LOG_LEVEL))))
+	{
+		MSV_LOG_ERROR(m_spLogger, "Bind main logger log level failed with error: {0:x}", errorCode);
+		return errorCode;
+	}
+
 	MSV_LOG_INFO(m_spLogger, "Active config has been successfully initialized.");
 
 	return MSV_SUCCESS;
@@ -200,6 +200,12 @@ protected:
 	******************************************************************************************************/
 	std::shared_ptr<IMsvLoggerProvider> m_spLoggerProvider;
 
+	/**************************************************************************************************//**
+	* @brief		Log level binding.
+	* @details	Binds log level of main logger to active config (level might be changed without restart).
+	******************************************************************************************************/
+	std::shared_ptr<IMsvLogLevelBinding> m_spLogLevelBinding;
+
 	/**************************************************************************************************//**
 	* @brief		Main initializer.
 	* @details	Provides methods to get and initialize main.
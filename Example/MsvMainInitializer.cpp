@@ -197,6 +197,9 @@ MsvErrorCode MsvMainInitializer::InitializeAndGetActiveConfigKeyMap(std::shared_
 	MSV_RETURN_FAILED(InsertConfigKey(spTempActiveCfgKeyMap, MsvActiveCfgKey::MSV_DYNAMIC_MODULE2_INSTALLED, new (std::nothrow) MsvDefaultValue(true)));
 	MSV_RETURN_FAILED(InsertConfigKey(spTempActiveCfgKeyMap, MsvActiveCfgKey::MSV_DYNAMIC_MODULE2_ENABLED, new (std::nothrow) MsvDefaultValue(true)));
 
+	//logging
+	MSV_RETURN_FAILED(InsertConfigKey(spTempActiveCfgKeyMap, MsvActiveCfgKey::MSV_MAIN_LOG_LEVEL, new (std::nothrow) MsvDefaultValue(static_cast<int32_t>(spdlog::level::info))));
+
 	spActiveCfgKeyMap = spTempActiveCfgKeyMap;
 
 	return MSV_SUCCESS;
@@ -37,7 +37,7 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 
 #include "mmodule/MsvDllModuleBase.h"
 
-#include "mlogging/mlogging.h"
+#include "msys/logging/MsvLogMacros.h"
 
 
 /**************************************************************************************************//**
@@ -19,7 +19,22 @@ class MsvLogging_Mock:
 public:
 	MOCK_CONST_METHOD2(GetLogger, MsvErrorCode(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName = "MsvLogger"));
 	MOCK_CONST_METHOD2(GetLogger, MsvErrorCode(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles));
+	MOCK_CONST_METHOD2(GetLoggerHandle, MsvErrorCode(MsvLoggerHandle& handle, const char* loggerName = "MsvLogger"));
+	MOCK_CONST_METHOD2(GetLoggerByHandle, MsvErrorCode(std::shared_ptr<MsvLogger>& spLogger, MsvLoggerHandle handle));
 	MOCK_CONST_METHOD5(GetLoggerProvider, MsvErrorCode(std::shared_ptr<IMsvLoggerProvider>& spLoggerProvider, const char* logFolder = "", const char* logFile = "msvlog.txt", int maxLogFileSize = 10485760, int maxLogFiles = 3));
+	MOCK_CONST_METHOD7(GetAsyncLoggerProvider, MsvErrorCode(std::shared_ptr<IMsvAsyncLoggerProvider>& spLoggerProvider, const char* logFolder = "", const char* logFile = "msvlog.txt", int maxLogFileSize = 10485760, int maxLogFiles = 3, size_t queueSize = 8192, MsvLogOverflowPolicy overflowPolicy = MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_BLOCK));
+	MOCK_CONST_METHOD5(GetBinaryLogger, MsvErrorCode(std::shared_ptr<IMsvBinaryLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize = 10485760, int maxLogFiles = 3));
+	MOCK_CONST_METHOD5(GetStructuredLogger, MsvErrorCode(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize = 10485760, int maxLogFiles = 3));
+	MOCK_CONST_METHOD3(GetFlightRecorder, MsvErrorCode(std::shared_ptr<IMsvFlightRecorder>& spFlightRecorder, const char* recorderFile = "msvflight.rec", uint32_t recordsCount = 65536));
+	MOCK_CONST_METHOD6(GetLogShipper, MsvErrorCode(std::shared_ptr<IMsvLogShipper>& spLogShipper, const char* socketPath = "msvlog.sock", const char* spillFile = "msvlogspill.bin", size_t bufferSize = 4194304, size_t batchSize = 65536, uint64_t maxSpillSize = 67108864));
+	MOCK_CONST_METHOD3(GetLogLevelBinding, MsvErrorCode(std::shared_ptr<IMsvLogLevelBinding>& spLogLevelBinding, std::shared_ptr<IMsvActiveConfig> spActiveConfig, uint32_t refreshPeriod = 1000));
+	MOCK_METHOD1(SetLogCategories, void(uint32_t categories));
+	MOCK_CONST_METHOD0(GetLogCategories, uint32_t());
+	MOCK_CONST_METHOD0(GetLogCategoriesMask, const std::atomic<uint32_t>*());
+	MOCK_CONST_METHOD0(GetLogContext, IMsvLogContext*());
+	MOCK_CONST_METHOD0(GetLogRateLimitRegistry, IMsvLogRateLimitRegistry*());
+	MOCK_METHOD4(Subscribe, MsvErrorCode(uint32_t& subscriptionId, MsvLogSubscriber subscriber, MsvLogLevel minLevel = MsvLogLevel::trace, const char* loggerName = nullptr));
+	MOCK_METHOD1(Unsubscribe, MsvErrorCode(uint32_t subscriptionId));
 };
 
 
@@ -20,6 +20,7 @@ public:
 	MOCK_CONST_METHOD1(GetMsvConfiguration, MsvErrorCode(std::shared_ptr<IMsvConfiguration>& spConfiguration));
 	MOCK_CONST_METHOD1(GetMsvLogging, MsvErrorCode(std::shared_ptr<IMsvLogging>& spLogging));
 	MOCK_CONST_METHOD1(GetMsvThreading, MsvErrorCode(std::shared_ptr<IMsvThreading>& spThreading));
+	MOCK_CONST_METHOD1(GetMsvTimestamp, MsvErrorCode(std::shared_ptr<IMsvTimestamp>& spTimestamp));
 };
 
 
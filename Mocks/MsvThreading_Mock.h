@@ -18,10 +18,17 @@ class MsvThreading_Mock:
 {
 public:
 	MOCK_CONST_METHOD1(GetEvent, MsvErrorCode(std::shared_ptr<IMsvEvent>& spEvent));
+	MOCK_CONST_METHOD1(GetFiberScheduler, MsvErrorCode(std::shared_ptr<IMsvFiberScheduler>& spFiberScheduler));
+	MOCK_CONST_METHOD1(GetNotifier, MsvErrorCode(std::shared_ptr<IMsvNotifier>& spNotifier));
+	MOCK_CONST_METHOD1(GetPipeline, MsvErrorCode(std::shared_ptr<IMsvPipeline>& spPipeline));
+	MOCK_CONST_METHOD2(GetVirtualScheduler, MsvErrorCode(std::shared_ptr<IMsvVirtualScheduler>& spVirtualScheduler, uint64_t seed));
+	MOCK_CONST_METHOD2(GetVirtualThreading, MsvErrorCode(std::shared_ptr<IMsvThreading>& spVirtualThreading, std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler));
 	MOCK_CONST_METHOD1(GetSharedThreadPool, MsvErrorCode(std::shared_ptr<IMsvThreadPool>& spThreadPool));
 	MOCK_CONST_METHOD1(GetThreadPool, MsvErrorCode(std::shared_ptr<IMsvThreadPool>& spThreadPool));
 	MOCK_CONST_METHOD4(GetUniqueWorker, MsvErrorCode(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<std::condition_variable> spConditionVariable = nullptr, std::shared_ptr<std::mutex> spConditionVariableMutex = nullptr, std::shared_ptr<uint64_t> spConditionVariablePredicate = nullptr));
+	MOCK_CONST_METHOD2(GetUniqueWorker, MsvErrorCode(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<IMsvNotifier> spNotifier));
 	MOCK_CONST_METHOD4(GetWorker, MsvErrorCode(std::shared_ptr<IMsvWorker>& spWorker, std::shared_ptr<std::condition_variable> spConditionVariable = nullptr, std::shared_ptr<std::mutex> spConditionVariableMutex = nullptr, std::shared_ptr<uint64_t> spConditionVariablePredicate = nullptr));
+	MOCK_CONST_METHOD2(GetWorker, MsvErrorCode(std::shared_ptr<IMsvWorker>& spWorker, std::shared_ptr<IMsvNotifier> spNotifier));
 };
 
 
@@ -3,12 +3,44 @@
 
 #include "msys/msys_lib/MsvSys.h"
 
+#include "msys/logging/MsvBinaryLog.h"
+#include "msys/logging/MsvLogMacros.h"
+#include "msys/logging/MsvStructuredLog.h"
+
 #include "merror/MsvErrorCodes.h"
 
+MSV_DISABLE_ALL_WARNINGS
+
+#include <gmock\gmock.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
 
 using namespace ::testing;
 
 
+//key of logger level in active config
+#define MSV_TEST_LOG_LEVEL_KEY 1
+
+
+class MsvActiveConfig_Mock:
+	public IMsvActiveConfig
+{
+public:
+	MOCK_CONST_METHOD2(GetValue, MsvErrorCode(int32_t key, int32_t& value));
+};
+
+
 class MsvLogging_Integration:
 	public MsvSys_IntegrationBase
 {
@@ -24,10 +56,14 @@ public:
 
 		EXPECT_EQ(m_spSys->GetMsvLogging(m_spLogging), MSV_SUCCESS);
 		EXPECT_TRUE(m_spLogging != nullptr);
+
+		//bind log calls of test binary to msys library
+		MsvLogBind(m_spLogging);
 	}
 
 	virtual void TearDown()
 	{
+		MsvLogBind(nullptr);
 		m_spLogging.reset();
 		
 		UninitializeSys();
@@ -132,3 +168,841 @@ TEST_F(MsvLogging_Integration, ItShouldCreateTwoLoggersParams)
 
 	EXPECT_TRUE(spLogger1 != spLogger2);
 }
+
+TEST_F(MsvLogging_Integration, ItShouldCreateOneAsyncLoggerProviderInterface)
+{
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider2;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider2), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider2 != nullptr);
+
+	EXPECT_TRUE(spLoggerProvider1 == spLoggerProvider2);
+
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider3;
+	EXPECT_EQ(m_spLogging->GetLoggerProvider(spLoggerProvider3), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider3 == spLoggerProvider1);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldFailedToGetAsyncLoggerProviderWhenProviderExists)
+{
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetLoggerProvider(spLoggerProvider1), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider2;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider2), MSV_ALREADY_EXISTS_ERROR);
+	EXPECT_TRUE(spLoggerProvider2 == nullptr);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldLogAndFlushAsyncLogger)
+{
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "asynclog.txt", 10485760, 3, 16, MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_BLOCK), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "AsyncLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		spLogger1->info("Async log record {}.", i);
+	}
+
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+	EXPECT_EQ(spLoggerProvider1->GetDroppedRecordsCount(), 0u);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldWritePerThreadBuffersInTimeOrder)
+{
+	std::remove("perthreadlog.txt");
+
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "perthreadlog.txt"), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	EXPECT_EQ(spLoggerProvider1->EnablePerThreadBuffers(20, 64), MSV_SUCCESS);
+	EXPECT_EQ(spLoggerProvider1->EnablePerThreadBuffers(), MSV_ALREADY_INITIALIZED_INFO);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "PerThreadLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	std::vector<std::thread> threads;
+	for (int thread = 0; thread < 4; ++thread)
+	{
+		threads.push_back(std::thread([&spLogger1, thread]
+		{
+			for (int i = 0; i < 1000; ++i)
+			{
+				spLogger1->info("Thread {} log record {}.", thread, i);
+			}
+		}));
+	}
+
+	for (std::thread& thread: threads)
+	{
+		thread.join();
+	}
+
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+
+	//records start with time -> they must be sorted
+	std::ifstream file("perthreadlog.txt");
+	std::string line, previousTime;
+	int records = 0;
+	while (std::getline(file, line))
+	{
+		std::string time = line.substr(0, line.find(']'));
+		EXPECT_LE(previousTime, time);
+		previousTime = time;
+		++records;
+	}
+
+	EXPECT_EQ(records, 4000);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldWriteBatchedLogFile)
+{
+	std::remove("batchedlog.txt");
+
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "batchedlog.txt"), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	EXPECT_EQ(spLoggerProvider1->EnableBatchedWrites(0), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(spLoggerProvider1->EnableBatchedWrites(262144, MsvLogFsyncPolicy::MSV_LOG_FSYNC_ON_FLUSH), MSV_SUCCESS);
+	EXPECT_EQ(spLoggerProvider1->EnableBatchedWrites(), MSV_ALREADY_INITIALIZED_INFO);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "BatchedLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		spLogger1->info("Batched log record {}.", i);
+	}
+
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+
+	//reserved space is not visible (file contains records only)
+	std::ifstream file("batchedlog.txt");
+	std::string line;
+	int records = 0;
+	while (std::getline(file, line))
+	{
+		EXPECT_NE(line.find("Batched log record " + std::to_string(records) + "."), std::string::npos);
+		++records;
+	}
+
+	EXPECT_EQ(records, 10000);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldQueryIndexedLogFile)
+{
+	std::remove("indexedlog.txt");
+	std::remove("indexedlog.txt.idx");
+
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "indexedlog.txt"), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	EXPECT_EQ(spLoggerProvider1->EnableLogIndex(0), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(spLoggerProvider1->EnableLogIndex(4096), MSV_SUCCESS);
+	EXPECT_EQ(spLoggerProvider1->EnableLogIndex(), MSV_ALREADY_INITIALIZED_INFO);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "IndexedLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		if (i % 1000 == 0)
+		{
+			spLogger1->error("Indexed error record {}.", i);
+		}
+		else
+		{
+			spLogger1->info("Indexed log record {}.", i);
+		}
+	}
+
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+
+	std::ostringstream output;
+	EXPECT_EQ(spLoggerProvider1->QueryLogFile("indexedlog.txt", std::chrono::system_clock::now() - std::chrono::hours(1), std::chrono::system_clock::now(), MSV_LOG_LEVEL_MASK(MsvLogLevel::err), "IndexedLogger", output), MSV_SUCCESS);
+
+	std::istringstream input(output.str());
+	std::string line;
+	int records = 0;
+	while (std::getline(input, line))
+	{
+		EXPECT_NE(line.find("Indexed error record " + std::to_string(records * 1000) + "."), std::string::npos);
+		++records;
+	}
+
+	EXPECT_EQ(records, 10);
+
+	std::ostringstream otherLoggerOutput;
+	EXPECT_EQ(spLoggerProvider1->QueryLogFile("indexedlog.txt", std::chrono::system_clock::now() - std::chrono::hours(1), std::chrono::system_clock::now(), MSV_LOG_LEVEL_MASK_ALL, "OtherLogger", otherLoggerOutput), MSV_SUCCESS);
+	EXPECT_TRUE(otherLoggerOutput.str().empty());
+
+	EXPECT_EQ(spLoggerProvider1->QueryLogFile("missinglog.txt", std::chrono::system_clock::now() - std::chrono::hours(1), std::chrono::system_clock::now(), MSV_LOG_LEVEL_MASK_ALL, nullptr, otherLoggerOutput), MSV_NOT_FOUND_ERROR);
+
+	std::ofstream jsonFile("jsonlog.txt");
+	jsonFile << "{\"time\":\"2026-10-19T10:00:00.000\",\"level\":\"info\",\"msg\":\"JSON record.\"}" << std::endl;
+	jsonFile.close();
+	EXPECT_EQ(spLoggerProvider1->QueryLogFile("jsonlog.txt", std::chrono::system_clock::now() - std::chrono::hours(1), std::chrono::system_clock::now(), MSV_LOG_LEVEL_MASK_ALL, nullptr, otherLoggerOutput), MSV_INVALID_DATA_ERROR);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldDeduplicateRepeatedAsyncLogRecords)
+{
+	std::remove("deduplog.txt");
+
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "deduplog.txt"), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	EXPECT_EQ(spLoggerProvider1->EnableDeduplication(60000), MSV_SUCCESS);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "DedupLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		spLogger1->info("Executing task of module {}.", "MsvModule");
+	}
+
+	spLogger1->info("Module {} has been successfully stopped.", "MsvModule");
+
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+
+	std::ifstream file("deduplog.txt");
+	std::vector<std::string> lines;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		lines.push_back(line);
+	}
+
+	ASSERT_EQ(lines.size(), 3u);
+	EXPECT_NE(lines[0].find("Executing task of module MsvModule."), std::string::npos);
+	EXPECT_NE(lines[1].find("Last message repeated 999 times."), std::string::npos);
+	EXPECT_NE(lines[2].find("Module MsvModule has been successfully stopped."), std::string::npos);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldAppendThreadLogContextToAsyncLogRecords)
+{
+	std::remove("contextlog.txt");
+
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "contextlog.txt"), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "ContextLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	std::function<void(void*)> task;
+
+	{
+		MSV_LOG_CONTEXT("requestId", 42);
+		spLogger1->info("Request has been received.");
+
+		{
+			MSV_LOG_CONTEXT("module", "MsvModule");
+			spLogger1->info("Module is processing request.");
+
+			//context is propagated to other thread
+			task = MsvLogContextWrap([&spLogger1](void*) { spLogger1->info("Task of request has been executed."); });
+		}
+
+		spLogger1->info("Request has been processed.");
+	}
+
+	spLogger1->info("Waiting for next request.");
+
+	std::thread thread(task, nullptr);
+	thread.join();
+
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+
+	std::ifstream file("contextlog.txt");
+	std::vector<std::string> lines;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		lines.push_back(line);
+	}
+
+	ASSERT_EQ(lines.size(), 5u);
+	EXPECT_NE(lines[0].find("Request has been received. {requestId=42}"), std::string::npos);
+	EXPECT_NE(lines[1].find("Module is processing request. {requestId=42, module=MsvModule}"), std::string::npos);
+	EXPECT_NE(lines[2].find("Request has been processed. {requestId=42}"), std::string::npos);
+	EXPECT_EQ(lines[3].find("{"), std::string::npos);
+	EXPECT_NE(lines[4].find("Task of request has been executed. {requestId=42, module=MsvModule}"), std::string::npos);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldDeliverMatchingRecordsToSubscriber)
+{
+	uint32_t subscriptionId = 0;
+	EXPECT_EQ(m_spLogging->Subscribe(subscriptionId, [](const MsvLogEvent&) {}), MSV_DOES_NOT_EXIST_ERROR);
+
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "subscribedlog.txt"), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "SubscribedLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger2;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger2, "OtherLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger2 != nullptr);
+
+	//subscriber is called by background thread only (no synchronization is needed until flush)
+	std::vector<std::string> messages;
+	EXPECT_EQ(m_spLogging->Subscribe(subscriptionId, nullptr), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(m_spLogging->Subscribe(subscriptionId, [&messages](const MsvLogEvent& logEvent)
+	{
+		EXPECT_EQ(std::string(logEvent.loggerName.data(), logEvent.loggerName.size()), "SubscribedLogger");
+		EXPECT_GE(logEvent.level, MsvLogLevel::err);
+		messages.push_back(std::string(logEvent.message.data(), logEvent.message.size()));
+	}, MsvLogLevel::err, "SubscribedLogger"), MSV_SUCCESS);
+
+	for (int i = 0; i < 100; ++i)
+	{
+		spLogger1->info("Subscribed info record {}.", i);
+		spLogger2->error("Other error record {}.", i);
+
+		if (i % 10 == 0)
+		{
+			spLogger1->error("Subscribed error record {}.", i);
+		}
+	}
+
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+	ASSERT_EQ(messages.size(), 10u);
+	EXPECT_EQ(messages[0], "Subscribed error record 0.");
+	EXPECT_EQ(messages[9], "Subscribed error record 90.");
+
+	EXPECT_EQ(m_spLogging->Unsubscribe(subscriptionId), MSV_SUCCESS);
+	EXPECT_EQ(m_spLogging->Unsubscribe(subscriptionId), MSV_NOT_FOUND_ERROR);
+
+	spLogger1->error("Unsubscribed error record.");
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+	EXPECT_EQ(messages.size(), 10u);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldCreateOneBinaryLogger)
+{
+	std::shared_ptr<IMsvBinaryLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetBinaryLogger(spLogger1, "BinaryLogger", "binarylog.mblog"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	std::shared_ptr<IMsvBinaryLogger> spLogger2;
+	EXPECT_EQ(m_spLogging->GetBinaryLogger(spLogger2, "BinaryLogger", "binarylog.mblog"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger2 != nullptr);
+
+	EXPECT_TRUE(spLogger1 == spLogger2);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldWriteBinaryLogFile)
+{
+	std::shared_ptr<IMsvBinaryLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetBinaryLogger(spLogger1, "BinaryLogger_1", "binarylog_1.mblog"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		MSV_BLOG_INFO(spLogger1, "Module {} has been successfully started ({}).", "MsvModule", i);
+	}
+
+	EXPECT_EQ(spLogger1->Flush(), MSV_SUCCESS);
+
+	std::ifstream file("binarylog_1.mblog", std::ios::binary);
+	char magic[8] = {0};
+	file.read(magic, sizeof(magic));
+	EXPECT_EQ(std::memcmp(magic, "MSVBLOG", 7), 0);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldNotEvaluateArgumentsOfDisabledLogLevel)
+{
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetLoggerProvider(spLoggerProvider1), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "LevelLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	int evaluations = 0;
+
+	EXPECT_EQ(m_spLogging->SetLogLevel(spdlog::level::warn), MSV_SUCCESS);
+	MSV_LOG_INFO(spLogger1, "Evaluation {}.", ++evaluations);
+	EXPECT_EQ(evaluations, 0);
+
+	MSV_LOG_ERROR(spLogger1, "Evaluation {}.", ++evaluations);
+	EXPECT_EQ(evaluations, 1);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldResolveLoggerHandle)
+{
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetLoggerProvider(spLoggerProvider1), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	MsvLoggerHandle handle1 = 0;
+	EXPECT_EQ(m_spLogging->GetLoggerHandle(handle1, "HandleLogger_1"), MSV_SUCCESS);
+
+	MsvLoggerHandle handle2 = 0;
+	EXPECT_EQ(m_spLogging->GetLoggerHandle(handle2, "HandleLogger_2"), MSV_SUCCESS);
+	EXPECT_NE(handle1, handle2);
+
+	MsvLoggerHandle handle3 = 0;
+	EXPECT_EQ(m_spLogging->GetLoggerHandle(handle3, "HandleLogger_1"), MSV_SUCCESS);
+	EXPECT_EQ(handle1, handle3);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLoggerByHandle(spLogger1, handle1), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger2;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger2, "HandleLogger_1"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 == spLogger2);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldFailedToGetLoggerByInvalidHandle)
+{
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLoggerByHandle(spLogger1, MSV_LOGGER_HANDLES_MAX), MSV_INVALID_DATA_ERROR);
+	EXPECT_TRUE(spLogger1 == nullptr);
+
+	MsvLoggerHandle handle1 = 0;
+	EXPECT_EQ(m_spLogging->GetLoggerHandle(handle1, "HandleLogger"), MSV_DOES_NOT_EXIST_ERROR);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldSampleAndRateLimitLogCalls)
+{
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetLoggerProvider(spLoggerProvider1), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "RateLimitedLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	int sampledEvaluations = 0;
+	int limitedEvaluations = 0;
+
+	for (int i = 0; i < 100; ++i)
+	{
+		MSV_LOG_WARN_EVERY_N(spLogger1, 10, "Sampled {}.", ++sampledEvaluations);
+		MSV_LOG_WARN_RATE_LIMITED(spLogger1, 5, "Rate limited {}.", ++limitedEvaluations);
+	}
+
+	EXPECT_EQ(sampledEvaluations, 10);
+	EXPECT_EQ(limitedEvaluations, 5);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldWriteSuppressedCountOfRateLimitedLogCalls)
+{
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "ratelimitlog.txt", 10485760, 3, 16, MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_BLOCK), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "RateLimitSummaryLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	for (int i = 0; i < 100; ++i)
+	{
+		MSV_LOG_WARN_RATE_LIMITED(spLogger1, 5, "Rate limited {}.", i);
+	}
+
+	EXPECT_EQ(m_spLogging->GetLogRateLimitRegistry()->Flush(), MSV_SUCCESS);
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+
+	std::ifstream file("ratelimitlog.txt");
+	std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	EXPECT_NE(content.find("Message has been suppressed 95 times"), std::string::npos);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldRecordTraceLogsToFlightRecorder)
+{
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetLoggerProvider(spLoggerProvider1), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "FlightRecorderLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	std::shared_ptr<IMsvFlightRecorder> spFlightRecorder1;
+	EXPECT_EQ(m_spLogging->GetFlightRecorder(spFlightRecorder1, "flightrecorder.rec", 1024), MSV_SUCCESS);
+	EXPECT_TRUE(spFlightRecorder1 != nullptr);
+
+	std::shared_ptr<IMsvFlightRecorder> spFlightRecorder2;
+	EXPECT_EQ(m_spLogging->GetFlightRecorder(spFlightRecorder2), MSV_SUCCESS);
+	EXPECT_TRUE(spFlightRecorder1 == spFlightRecorder2);
+
+	//logger level is lowered to recorder level (default recorder level is TRACE)
+	EXPECT_FALSE(spLogger1->should_log(spdlog::level::trace));
+	EXPECT_EQ(spFlightRecorder1->AttachLogger(spLogger1), MSV_SUCCESS);
+	EXPECT_EQ(spFlightRecorder1->AttachLogger(spLogger1), MSV_ALREADY_EXISTS_ERROR);
+	EXPECT_TRUE(spLogger1->should_log(spdlog::level::trace));
+
+	for (int i = 0; i < 2000; ++i)
+	{
+		spLogger1->trace("Flight recorder record {}.", i);
+	}
+
+	EXPECT_EQ(spFlightRecorder1->Flush(), MSV_SUCCESS);
+
+	std::ifstream file("flightrecorder.rec", std::ios::binary);
+	char magic[8] = {0};
+	file.read(magic, sizeof(magic));
+	EXPECT_EQ(std::memcmp(magic, "MSVFLRC", 7), 0);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldRecordTraceLogsWithoutWritingThemToLogFile)
+{
+	std::remove("flightrecordertrace.rec");
+	std::remove("flightrecorderlog.txt");
+
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetLoggerProvider(spLoggerProvider1), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "FlightRecorderTraceLogger", "flightrecorderlog.txt", 10485760, 3), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	std::shared_ptr<IMsvFlightRecorder> spFlightRecorder1;
+	EXPECT_EQ(m_spLogging->GetFlightRecorder(spFlightRecorder1, "flightrecordertrace.rec", 1024), MSV_SUCCESS);
+	EXPECT_TRUE(spFlightRecorder1 != nullptr);
+
+	EXPECT_EQ(m_spLogging->SetLogLevel(spdlog::level::info), MSV_SUCCESS);
+	EXPECT_EQ(spFlightRecorder1->AttachLogger(spLogger1), MSV_SUCCESS);
+
+	spLogger1->trace("Flight recorder trace record.");
+	spLogger1->info("Flight recorder info record.");
+	spLogger1->flush();
+	EXPECT_EQ(spFlightRecorder1->Flush(), MSV_SUCCESS);
+
+	std::ifstream recorderFile("flightrecordertrace.rec", std::ios::binary);
+	std::string recorderContent((std::istreambuf_iterator<char>(recorderFile)), std::istreambuf_iterator<char>());
+	EXPECT_NE(recorderContent.find("Flight recorder trace record."), std::string::npos);
+	EXPECT_NE(recorderContent.find("Flight recorder info record."), std::string::npos);
+
+	std::ifstream logFile("flightrecorderlog.txt");
+	std::string logContent((std::istreambuf_iterator<char>(logFile)), std::istreambuf_iterator<char>());
+	EXPECT_EQ(logContent.find("Flight recorder trace record."), std::string::npos);
+	EXPECT_NE(logContent.find("Flight recorder info record."), std::string::npos);
+
+	//logger level is restored when recorder level is raised
+	spFlightRecorder1->SetRecorderLevel(spdlog::level::warn);
+	EXPECT_EQ(spLogger1->level(), spdlog::level::info);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldSpillShippedLogsWithoutCollector)
+{
+	std::remove("logshipper.spill");
+
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetLoggerProvider(spLoggerProvider1), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "LogShipperLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	//no collector listens on socket -> records are spilled to file
+	std::shared_ptr<IMsvLogShipper> spLogShipper1;
+	EXPECT_EQ(m_spLogging->GetLogShipper(spLogShipper1, "missingcollector.sock", "logshipper.spill"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogShipper1 != nullptr);
+
+	std::shared_ptr<IMsvLogShipper> spLogShipper2;
+	EXPECT_EQ(m_spLogging->GetLogShipper(spLogShipper2), MSV_SUCCESS);
+	EXPECT_TRUE(spLogShipper1 == spLogShipper2);
+
+	EXPECT_EQ(spLogShipper1->AttachLogger(spLogger1), MSV_SUCCESS);
+	EXPECT_EQ(spLogShipper1->AttachLogger(spLogger1), MSV_ALREADY_EXISTS_ERROR);
+
+	//logger which has not been created by logging has no forwarding sink
+	EXPECT_EQ(spLogShipper1->AttachLogger(std::make_shared<MsvLogger>("LogShipperPlainLogger")), MSV_NOT_FOUND_ERROR);
+
+	for (int i = 0; i < 100; ++i)
+	{
+		spLogger1->info("Shipped log record {}.", i);
+	}
+
+	EXPECT_EQ(spLogShipper1->Flush(), MSV_SUCCESS);
+	EXPECT_FALSE(spLogShipper1->IsConnected());
+	EXPECT_EQ(spLogShipper1->GetSpilledRecordsCount(), 100u);
+	EXPECT_EQ(spLogShipper1->GetDroppedRecordsCount(), 0u);
+
+	//spill file contains length prefixed records
+	std::ifstream file("logshipper.spill", std::ios::binary);
+	int records = 0;
+	unsigned char prefix[4];
+	while (file.read(reinterpret_cast<char*>(prefix), sizeof(prefix)))
+	{
+		std::string record(prefix[0] | (prefix[1] << 8) | (prefix[2] << 16) | (prefix[3] << 24), '\0');
+		EXPECT_TRUE(static_cast<bool>(file.read(&record[0], static_cast<std::streamsize>(record.size()))));
+		EXPECT_NE(record.find("Shipped log record " + std::to_string(records) + "."), std::string::npos);
+		++records;
+	}
+
+	EXPECT_EQ(records, 100);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldFailedToGetLogLevelBindingWithoutActiveConfig)
+{
+	std::shared_ptr<IMsvLogLevelBinding> spLogLevelBinding1;
+	EXPECT_EQ(m_spLogging->GetLogLevelBinding(spLogLevelBinding1, nullptr), MSV_INVALID_DATA_ERROR);
+	EXPECT_TRUE(spLogLevelBinding1 == nullptr);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldRefreshBoundLoggerLevelFromActiveConfig)
+{
+	int32_t configLevel = spdlog::level::warn;
+	std::shared_ptr<NiceMock<MsvActiveConfig_Mock>> spActiveConfig(new NiceMock<MsvActiveConfig_Mock>());
+	EXPECT_CALL(*spActiveConfig, GetValue(MSV_TEST_LOG_LEVEL_KEY, _)).WillRepeatedly(Invoke([&configLevel](int32_t, int32_t& value) { value = configLevel; return MSV_SUCCESS; }));
+
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetLoggerProvider(spLoggerProvider1), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "LevelBindingLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	//refresh thread does not run during test (values are refreshed explicitly)
+	std::shared_ptr<IMsvLogLevelBinding> spLogLevelBinding1;
+	EXPECT_EQ(m_spLogging->GetLogLevelBinding(spLogLevelBinding1, spActiveConfig, 3600000), MSV_SUCCESS);
+	EXPECT_TRUE(spLogLevelBinding1 != nullptr);
+
+	//current value is applied when logger is bound
+	EXPECT_EQ(spLogLevelBinding1->BindLogger(spLogger1, MSV_TEST_LOG_LEVEL_KEY), MSV_SUCCESS);
+	EXPECT_EQ(spLogger1->level(), spdlog::level::warn);
+
+	configLevel = spdlog::level::debug;
+	EXPECT_EQ(spLogLevelBinding1->Refresh(), MSV_SUCCESS);
+	EXPECT_EQ(spLogger1->level(), spdlog::level::debug);
+
+	//out of range values are ignored
+	configLevel = spdlog::level::off + 1;
+	EXPECT_EQ(spLogLevelBinding1->Refresh(), MSV_SUCCESS);
+	EXPECT_EQ(spLogger1->level(), spdlog::level::debug);
+
+	configLevel = spdlog::level::trace - 1;
+	EXPECT_EQ(spLogLevelBinding1->Refresh(), MSV_SUCCESS);
+	EXPECT_EQ(spLogger1->level(), spdlog::level::debug);
+
+	spLogLevelBinding1->UnbindAll();
+}
+
+TEST_F(MsvLogging_Integration, ItShouldCompressRotatedLogFiles)
+{
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "compressedlog.txt", 65536, 3), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	EXPECT_EQ(spLoggerProvider1->EnableLogCompression(), MSV_SUCCESS);
+	EXPECT_EQ(spLoggerProvider1->EnableLogCompression(), MSV_ALREADY_RUNNING_INFO);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "CompressedLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		spLogger1->info("Executing task of module {} ({}).", "MsvModule", i);
+	}
+
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+
+	std::ifstream file("compressedlog.1.txt.gz", std::ios::binary);
+	char magic[2] = {0};
+	file.read(magic, sizeof(magic));
+	EXPECT_EQ(static_cast<unsigned char>(magic[0]), 0x1fu);
+	EXPECT_EQ(static_cast<unsigned char>(magic[1]), 0x8bu);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldRotateLogFilesInBackground)
+{
+	std::remove("rotatedlog.txt");
+	std::remove("rotatedlog.1.txt");
+
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "rotatedlog.txt", 65536, 3), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	EXPECT_EQ(spLoggerProvider1->EnableBackgroundRotation(), MSV_SUCCESS);
+	EXPECT_EQ(spLoggerProvider1->EnableBackgroundRotation(), MSV_ALREADY_RUNNING_INFO);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "RotatedLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		spLogger1->info("Rotated log record {}.", i);
+	}
+
+	//flush waits until switched files are renamed
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+
+	std::ifstream rotatedFile("rotatedlog.1.txt");
+	EXPECT_TRUE(rotatedFile.good());
+
+	std::ifstream file("rotatedlog.txt");
+	std::string line;
+	std::string lastLine;
+	while (std::getline(file, line))
+	{
+		lastLine = line;
+	}
+
+	EXPECT_NE(lastLine.find("Rotated log record 9999."), std::string::npos);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldRecoverTemporaryLogFilesOfCrashedProcess)
+{
+	std::remove("recoveredlog.1.txt");
+	std::remove("recoveredlog.2.txt");
+
+	//files of process which crashed during rotation
+	std::ofstream("recoveredlog.txt") << "Full log record.\n";
+	std::ofstream("recoveredlog.txt.next.5") << "Switched log record.\n";
+	std::ofstream("recoveredlog.txt.rotated.4") << "Rotated log record.\n";
+
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "recoveredlog.txt", 65536, 3), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	EXPECT_EQ(spLoggerProvider1->EnableBackgroundRotation(), MSV_SUCCESS);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "RecoveredLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	spLogger1->info("Recovered log record.");
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+
+	//temporary files are rotated instead of removed
+	std::string line;
+	std::ifstream file("recoveredlog.txt");
+	EXPECT_TRUE(static_cast<bool>(std::getline(file, line)));
+	EXPECT_EQ(line, "Switched log record.");
+
+	std::ifstream rotatedFile1("recoveredlog.1.txt");
+	EXPECT_TRUE(static_cast<bool>(std::getline(rotatedFile1, line)));
+	EXPECT_EQ(line, "Full log record.");
+
+	std::ifstream rotatedFile2("recoveredlog.2.txt");
+	EXPECT_TRUE(static_cast<bool>(std::getline(rotatedFile2, line)));
+	EXPECT_EQ(line, "Rotated log record.");
+
+	EXPECT_FALSE(std::ifstream("recoveredlog.txt.next.5").good());
+	EXPECT_FALSE(std::ifstream("recoveredlog.txt.rotated.4").good());
+}
+
+TEST_F(MsvLogging_Integration, ItShouldEncodeStructuredLogRecord)
+{
+	MsvJsonBuffer buffer;
+	std::string module = "Msv\"Module\"";
+	MsvStructuredLogEncode(buffer, "Module has been started.", {{"module", module}, {"durationMs", 12}, {"ok", true}});
+
+	EXPECT_EQ(std::string(buffer.data() + 1, buffer.size() - 1), "\"msg\":\"Module has been started.\",\"module\":\"Msv\\\"Module\\\"\",\"durationMs\":12,\"ok\":true");
+}
+
+TEST_F(MsvLogging_Integration, ItShouldWriteStructuredLogAsJsonLines)
+{
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetLoggerProvider(spLoggerProvider1), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetStructuredLogger(spLogger1, "StructuredLogger", "structuredlog.jsonl"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	MSV_SLOG_WARN(spLogger1, "Module has been started.", {"module", "MsvModule"}, {"durationMs", 12});
+	spLogger1->flush();
+
+	std::ifstream file("structuredlog.jsonl");
+	std::string line;
+	std::getline(file, line);
+	EXPECT_EQ(line.front(), '{');
+	EXPECT_EQ(line.back(), '}');
+	EXPECT_NE(line.find("\"msg\":\"Module has been started.\",\"module\":\"MsvModule\",\"durationMs\":12"), std::string::npos);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldFailedToGetStructuredLoggerOfTextLogger)
+{
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetLoggerProvider(spLoggerProvider1), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "TextLogger", "textlog.txt", 10485760, 3), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger2;
+	EXPECT_EQ(m_spLogging->GetStructuredLogger(spLogger2, "TextLogger", "textlog.txt"), MSV_ALREADY_EXISTS_ERROR);
+	EXPECT_TRUE(spLogger2 == nullptr);
+
+	//logger created directly by provider is text logger too
+	std::shared_ptr<MsvLogger> spProviderLogger = spLoggerProvider1->GetLogger("ProviderTextLogger", "providertextlog.txt", 10485760, 3);
+	EXPECT_TRUE(spProviderLogger != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger5;
+	EXPECT_EQ(m_spLogging->GetStructuredLogger(spLogger5, "ProviderTextLogger", "providertextlog.txt"), MSV_ALREADY_EXISTS_ERROR);
+	EXPECT_TRUE(spLogger5 == nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger3;
+	EXPECT_EQ(m_spLogging->GetStructuredLogger(spLogger3, "StructuredLogger2", "structuredlog2.jsonl"), MSV_SUCCESS);
+	std::shared_ptr<MsvLogger> spLogger4;
+	EXPECT_EQ(m_spLogging->GetStructuredLogger(spLogger4, "StructuredLogger2", "structuredlog2.jsonl"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger3 == spLogger4);
+}
+
+TEST_F(MsvLogging_Integration, ItShouldLogEnabledCategoriesBelowLogLevel)
+{
+	std::remove("categorylog.txt");
+
+	std::shared_ptr<IMsvAsyncLoggerProvider> spLoggerProvider1;
+	EXPECT_EQ(m_spLogging->GetAsyncLoggerProvider(spLoggerProvider1, "", "categorylog.txt"), MSV_SUCCESS);
+	EXPECT_TRUE(spLoggerProvider1 != nullptr);
+
+	std::shared_ptr<MsvLogger> spLogger1;
+	EXPECT_EQ(m_spLogging->GetLogger(spLogger1, "CategoryLogger"), MSV_SUCCESS);
+	EXPECT_TRUE(spLogger1 != nullptr);
+	spLogger1->set_level(MsvLogLevel::info);
+
+	int evaluated = 0;
+	EXPECT_EQ(m_spLogging->GetLogCategories(), MSV_LOG_CAT_NONE);
+	MSV_LOG_CAT_DEBUG(spLogger1, MSV_LOG_CAT_DLL, "Disabled category record {}.", ++evaluated);
+	EXPECT_EQ(evaluated, 0);
+
+	m_spLogging->SetLogCategories(MSV_LOG_CAT_DLL | MSV_LOG_CAT_USER(0));
+	EXPECT_EQ(m_spLogging->GetLogCategories(), MSV_LOG_CAT_DLL | MSV_LOG_CAT_USER(0));
+	MSV_LOG_CAT_DEBUG(spLogger1, MSV_LOG_CAT_CONFIG, "Other category record {}.", ++evaluated);
+	MSV_LOG_CAT_DEBUG(spLogger1, MSV_LOG_CAT_DLL, "Enabled category record {}.", ++evaluated);
+	EXPECT_EQ(evaluated, 1);
+
+	m_spLogging->SetLogCategories(MSV_LOG_CAT_NONE);
+	EXPECT_EQ(spLoggerProvider1->Flush(), MSV_SUCCESS);
+
+	std::ifstream file("categorylog.txt");
+	std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	EXPECT_EQ(content.find("Disabled category record"), std::string::npos);
+	EXPECT_EQ(content.find("Other category record"), std::string::npos);
+	EXPECT_NE(content.find("Enabled category record 1."), std::string::npos);
+	EXPECT_NE(content.find("[debug]"), std::string::npos);
+}
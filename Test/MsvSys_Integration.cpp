@@ -64,3 +64,34 @@ TEST_F(MsvSys_Integration, ItShouldCreateOneThreadingInterface)
 
 	EXPECT_TRUE(spThreading1 == spThreading2);
 }
+
+TEST_F(MsvSys_Integration, ItShouldCreateOneTimestampInterface)
+{
+	std::shared_ptr<IMsvTimestamp> spTimestamp1;
+	EXPECT_EQ(m_spSys->GetMsvTimestamp(spTimestamp1), MSV_SUCCESS);
+	EXPECT_TRUE(spTimestamp1 != nullptr);
+
+	std::shared_ptr<IMsvTimestamp> spTimestamp2;
+	EXPECT_EQ(m_spSys->GetMsvTimestamp(spTimestamp2), MSV_SUCCESS);
+	EXPECT_TRUE(spTimestamp2 != nullptr);
+
+	EXPECT_TRUE(spTimestamp1 == spTimestamp2);
+}
+
+TEST_F(MsvSys_Integration, ItShouldConvertTimestampTicksToSystemTime)
+{
+	std::shared_ptr<IMsvTimestamp> spTimestamp;
+	EXPECT_EQ(m_spSys->GetMsvTimestamp(spTimestamp), MSV_SUCCESS);
+	ASSERT_TRUE(spTimestamp != nullptr);
+
+	EXPECT_GT(spTimestamp->GetTicksFrequency(), 0u);
+
+	uint64_t ticks1 = spTimestamp->GetTicks();
+	uint64_t ticks2 = spTimestamp->GetTicks();
+	EXPECT_LE(ticks1, ticks2);
+
+	std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+	std::chrono::system_clock::time_point time = spTimestamp->TicksToTime(spTimestamp->GetTicks());
+	EXPECT_LT(std::llabs(std::chrono::duration_cast<std::chrono::milliseconds>(time - now).count()), 10);
+	EXPECT_EQ(spTimestamp->Calibrate(), MSV_SUCCESS);
+}
@@ -5,6 +5,13 @@
 
 #include "merror/MsvErrorCodes.h"
 
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <thread>
+
+MSV_ENABLE_WARNINGS
+
 
 using namespace ::testing;
 
@@ -51,6 +58,320 @@ TEST_F(MsvThreading_Integration, ItShouldCreateTwoEventInterface)
 	EXPECT_TRUE(spEvent1 != spEvent2);
 }
 
+TEST_F(MsvThreading_Integration, ItShouldCreateTwoFiberSchedulerInterface)
+{
+	std::shared_ptr<IMsvFiberScheduler> spFiberScheduler1;
+	EXPECT_EQ(m_spThreading->GetFiberScheduler(spFiberScheduler1), MSV_SUCCESS);
+	EXPECT_TRUE(spFiberScheduler1 != nullptr);
+
+	std::shared_ptr<IMsvFiberScheduler> spFiberScheduler2;
+	EXPECT_EQ(m_spThreading->GetFiberScheduler(spFiberScheduler2), MSV_SUCCESS);
+	EXPECT_TRUE(spFiberScheduler2 != nullptr);
+
+	EXPECT_TRUE(spFiberScheduler1 != spFiberScheduler2);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldRunManyFibersWithFiberMutexAndEvent)
+{
+	std::shared_ptr<IMsvFiberScheduler> spFiberScheduler;
+	EXPECT_EQ(m_spThreading->GetFiberScheduler(spFiberScheduler), MSV_SUCCESS);
+	EXPECT_TRUE(spFiberScheduler != nullptr);
+
+	std::shared_ptr<IMsvFiberMutex> spMutex;
+	EXPECT_EQ(spFiberScheduler->GetMutex(spMutex), MSV_SUCCESS);
+	std::shared_ptr<IMsvFiberEvent> spEvent;
+	EXPECT_EQ(spFiberScheduler->GetEvent(spEvent), MSV_SUCCESS);
+
+	EXPECT_EQ(spFiberScheduler->Spawn([](void*) {}, nullptr), MSV_NOT_RUNNING_INFO);
+	EXPECT_EQ(spFiberScheduler->Start(4, 32 * 1024), MSV_SUCCESS);
+	EXPECT_EQ(spEvent->WaitForEvent(), MSV_INVALID_DATA_ERROR);
+
+	uint64_t counter = 0;
+	std::atomic<uint32_t> finished(0);
+	for (int i = 0; i < 10000; ++i)
+	{
+		EXPECT_EQ(spFiberScheduler->Spawn([&](void*)
+		{
+			//yield inside critical section -> other fibers must wait for mutex
+			spMutex->Lock();
+			uint64_t value = counter;
+			spFiberScheduler->YieldFiber();
+			counter = value + 1;
+			spMutex->Unlock();
+
+			spEvent->WaitForEvent();
+			++finished;
+		}, nullptr), MSV_SUCCESS);
+	}
+
+	while (finished < 10000)
+	{
+		spEvent->SetEvent(true);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	EXPECT_EQ(spFiberScheduler->Stop(), MSV_SUCCESS);
+	EXPECT_EQ(counter, 10000u);
+	EXPECT_EQ(spFiberScheduler->GetFibersCount(), 0u);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldCancelWaitingFibersWhenStopped)
+{
+	std::shared_ptr<IMsvFiberScheduler> spFiberScheduler;
+	EXPECT_EQ(m_spThreading->GetFiberScheduler(spFiberScheduler), MSV_SUCCESS);
+
+	std::shared_ptr<IMsvFiberMutex> spMutex;
+	EXPECT_EQ(spFiberScheduler->GetMutex(spMutex), MSV_SUCCESS);
+	std::shared_ptr<IMsvFiberEvent> spEvent;
+	EXPECT_EQ(spFiberScheduler->GetEvent(spEvent), MSV_SUCCESS);
+
+	EXPECT_EQ(spFiberScheduler->Start(2), MSV_SUCCESS);
+
+	std::atomic<uint32_t> cancelled(0);
+	for (int i = 0; i < 10; ++i)
+	{
+		EXPECT_EQ(spFiberScheduler->Spawn([&](void*)
+		{
+			//nothing sets event -> waits until scheduler is stopped (next wait is cancelled immediately)
+			if (spEvent->WaitForEvent() == MSV_NOT_INITIALIZED_ERROR && spEvent->WaitForEvent() == MSV_NOT_INITIALIZED_ERROR)
+			{
+				++cancelled;
+			}
+		}, nullptr), MSV_SUCCESS);
+	}
+
+	EXPECT_TRUE(spMutex->TryLock());
+	EXPECT_EQ(spFiberScheduler->Spawn([&](void*)
+	{
+		//mutex is never unlocked
+		if (spMutex->Lock() == MSV_NOT_INITIALIZED_ERROR)
+		{
+			++cancelled;
+		}
+	}, nullptr), MSV_SUCCESS);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+	EXPECT_EQ(spFiberScheduler->Stop(), MSV_SUCCESS);
+	EXPECT_EQ(cancelled, 11u);
+	EXPECT_EQ(spFiberScheduler->GetFibersCount(), 0u);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldCreateTwoNotifierInterface)
+{
+	std::shared_ptr<IMsvNotifier> spNotifier1;
+	EXPECT_EQ(m_spThreading->GetNotifier(spNotifier1), MSV_SUCCESS);
+	EXPECT_TRUE(spNotifier1 != nullptr);
+
+	std::shared_ptr<IMsvNotifier> spNotifier2;
+	EXPECT_EQ(m_spThreading->GetNotifier(spNotifier2), MSV_SUCCESS);
+	EXPECT_TRUE(spNotifier2 != nullptr);
+
+	EXPECT_TRUE(spNotifier1 != spNotifier2);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldConsumeOneNotificationPerWaiter)
+{
+	std::shared_ptr<IMsvNotifier> spNotifier;
+	EXPECT_EQ(m_spThreading->GetNotifier(spNotifier), MSV_SUCCESS);
+	EXPECT_TRUE(spNotifier != nullptr);
+
+	EXPECT_EQ(spNotifier->Notify(2), MSV_SUCCESS);
+	EXPECT_TRUE(spNotifier->WaitForNotification(1000));
+	EXPECT_TRUE(spNotifier->WaitForNotification(1000));
+	EXPECT_FALSE(spNotifier->WaitForNotification(1000));
+	EXPECT_EQ(spNotifier->Notify(0), MSV_INVALID_DATA_ERROR);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldWakeWaitingThread)
+{
+	std::shared_ptr<IMsvNotifier> spNotifier;
+	EXPECT_EQ(m_spThreading->GetNotifier(spNotifier), MSV_SUCCESS);
+	EXPECT_TRUE(spNotifier != nullptr);
+
+	std::thread waiter([spNotifier] { EXPECT_TRUE(spNotifier->WaitForNotification(10000000)); });
+
+	while (spNotifier->GetWaitersCount() == 0)
+	{
+		std::this_thread::yield();
+	}
+
+	EXPECT_EQ(spNotifier->NotifyOne(), MSV_SUCCESS);
+	waiter.join();
+
+	EXPECT_EQ(spNotifier->GetWaitersCount(), 0u);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldGiveNotificationToAttachedWorkerOnly)
+{
+	std::shared_ptr<IMsvNotifier> spNotifier;
+	EXPECT_EQ(m_spThreading->GetNotifier(spNotifier), MSV_SUCCESS);
+	EXPECT_TRUE(spNotifier != nullptr);
+
+	std::shared_ptr<IMsvWorker> spWorker;
+	EXPECT_EQ(m_spThreading->GetWorker(spWorker, spNotifier), MSV_SUCCESS);
+	EXPECT_TRUE(spWorker != nullptr);
+
+	//token belongs to worker (it is not left for next waiter)
+	EXPECT_EQ(spNotifier->NotifyOne(), MSV_SUCCESS);
+	EXPECT_FALSE(spNotifier->WaitForNotification(1000));
+
+	//destroyed worker is detached
+	spWorker.reset();
+	EXPECT_EQ(spNotifier->DetachWorker(), MSV_NOT_INITIALIZED_INFO);
+	EXPECT_EQ(spNotifier->NotifyOne(), MSV_SUCCESS);
+	EXPECT_TRUE(spNotifier->WaitForNotification(1000));
+}
+
+TEST_F(MsvThreading_Integration, ItShouldCreateTwoPipelineInterface)
+{
+	std::shared_ptr<IMsvPipeline> spPipeline1;
+	EXPECT_EQ(m_spThreading->GetPipeline(spPipeline1), MSV_SUCCESS);
+	EXPECT_TRUE(spPipeline1 != nullptr);
+
+	std::shared_ptr<IMsvPipeline> spPipeline2;
+	EXPECT_EQ(m_spThreading->GetPipeline(spPipeline2), MSV_SUCCESS);
+	EXPECT_TRUE(spPipeline2 != nullptr);
+
+	EXPECT_TRUE(spPipeline1 != spPipeline2);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldProcessAllItemsByPipeline)
+{
+	std::shared_ptr<IMsvPipeline> spPipeline;
+	EXPECT_EQ(m_spThreading->GetPipeline(spPipeline), MSV_SUCCESS);
+	EXPECT_TRUE(spPipeline != nullptr);
+
+	std::atomic<uint64_t> sum(0);
+	EXPECT_EQ(spPipeline->Start(), MSV_NOT_INITIALIZED_ERROR);
+	EXPECT_EQ(spPipeline->AddStage("double", [](std::shared_ptr<void>& spItem) { *std::static_pointer_cast<uint64_t>(spItem) *= 2; return true; }, 4, 8), MSV_SUCCESS);
+	EXPECT_EQ(spPipeline->AddStage("sum", [&sum](std::shared_ptr<void>& spItem) { sum += *std::static_pointer_cast<uint64_t>(spItem); return true; }, 1, 2), MSV_SUCCESS);
+	EXPECT_EQ(spPipeline->Start(), MSV_SUCCESS);
+
+	for (uint64_t i = 1; i <= 1000; ++i)
+	{
+		EXPECT_EQ(spPipeline->Push(std::make_shared<uint64_t>(i)), MSV_SUCCESS);
+	}
+
+	EXPECT_EQ(spPipeline->Stop(), MSV_SUCCESS);
+	EXPECT_EQ(sum, 1001000u);
+
+	std::vector<MsvPipelineStageStats> stats;
+	EXPECT_EQ(spPipeline->GetStageStats(stats), MSV_SUCCESS);
+	EXPECT_EQ(stats.size(), 2u);
+	EXPECT_EQ(stats[0].processed, 1000u);
+	EXPECT_EQ(stats[1].processed, 1000u);
+	EXPECT_EQ(stats[1].dropped, 0u);
+	EXPECT_EQ(spPipeline->Push(std::make_shared<uint64_t>(1)), MSV_NOT_RUNNING_INFO);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldCreateTwoVirtualSchedulerInterface)
+{
+	std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler1;
+	EXPECT_EQ(m_spThreading->GetVirtualScheduler(spVirtualScheduler1), MSV_SUCCESS);
+	EXPECT_TRUE(spVirtualScheduler1 != nullptr);
+
+	std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler2;
+	EXPECT_EQ(m_spThreading->GetVirtualScheduler(spVirtualScheduler2), MSV_SUCCESS);
+	EXPECT_TRUE(spVirtualScheduler2 != nullptr);
+
+	EXPECT_TRUE(spVirtualScheduler1 != spVirtualScheduler2);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldSimulateHourOfPeriodicTaskInVirtualTime)
+{
+	std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler;
+	EXPECT_EQ(m_spThreading->GetVirtualScheduler(spVirtualScheduler, 42), MSV_SUCCESS);
+	EXPECT_TRUE(spVirtualScheduler != nullptr);
+
+	uint64_t executions = 0;
+	uint64_t taskId = 0;
+	EXPECT_EQ(spVirtualScheduler->AddPeriodicTask(taskId, [&executions](void*) { ++executions; }, nullptr, 100000), MSV_SUCCESS);
+
+	spVirtualScheduler->RunFor(3600000000);
+	EXPECT_EQ(executions, 36000u);
+	EXPECT_EQ(spVirtualScheduler->GetTime(), 3600000000u);
+
+	EXPECT_EQ(spVirtualScheduler->RemovePeriodicTask(taskId), MSV_SUCCESS);
+	EXPECT_EQ(spVirtualScheduler->RemovePeriodicTask(taskId), MSV_NOT_FOUND_ERROR);
+	spVirtualScheduler->RunFor(1000000);
+	EXPECT_EQ(executions, 36000u);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldTimeoutVirtualEvent)
+{
+	std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler;
+	EXPECT_EQ(m_spThreading->GetVirtualScheduler(spVirtualScheduler), MSV_SUCCESS);
+	EXPECT_TRUE(spVirtualScheduler != nullptr);
+
+	std::shared_ptr<IMsvVirtualEvent> spEvent;
+	EXPECT_EQ(spVirtualScheduler->GetEvent(spEvent), MSV_SUCCESS);
+	EXPECT_TRUE(spEvent != nullptr);
+
+	int32_t signaled = -1;
+	uint64_t wakeTime = 0;
+	EXPECT_EQ(spEvent->WaitForEvent([&](void*, bool eventSignaled) { signaled = eventSignaled ? 1 : 0; wakeTime = spVirtualScheduler->GetTime(); }, nullptr, 5000), MSV_SUCCESS);
+	EXPECT_EQ(spVirtualScheduler->AddTask([&spEvent](void*) { spEvent->SetEvent(); }, nullptr, 10000), MSV_SUCCESS);
+
+	spVirtualScheduler->RunUntilIdle();
+	EXPECT_EQ(signaled, 0);
+	EXPECT_EQ(wakeTime, 5000u);
+	EXPECT_TRUE(spEvent->IsSet());
+}
+
+TEST_F(MsvThreading_Integration, ItShouldReproduceVirtualTaskOrderBySeed)
+{
+	auto runTasks = [this](uint64_t seed)
+	{
+		std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler;
+		EXPECT_EQ(m_spThreading->GetVirtualScheduler(spVirtualScheduler, seed), MSV_SUCCESS);
+
+		std::vector<int> order;
+		for (int i = 0; i < 16; ++i)
+		{
+			EXPECT_EQ(spVirtualScheduler->AddTask([&order, i](void*) { order.push_back(i); }, nullptr, 1000), MSV_SUCCESS);
+		}
+
+		EXPECT_EQ(spVirtualScheduler->RunUntilIdle(), 16u);
+		return order;
+	};
+
+	EXPECT_EQ(runTasks(7), runTasks(7));
+	EXPECT_NE(runTasks(7), runTasks(8));
+}
+
+TEST_F(MsvThreading_Integration, ItShouldRunUniqueWorkerAndEventInVirtualTime)
+{
+	std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler;
+	EXPECT_EQ(m_spThreading->GetVirtualScheduler(spVirtualScheduler), MSV_SUCCESS);
+
+	std::shared_ptr<IMsvThreading> spVirtualThreading;
+	EXPECT_EQ(m_spThreading->GetVirtualThreading(spVirtualThreading, nullptr), MSV_INVALID_DATA_ERROR);
+	EXPECT_EQ(m_spThreading->GetVirtualThreading(spVirtualThreading, spVirtualScheduler), MSV_SUCCESS);
+	EXPECT_TRUE(spVirtualThreading != nullptr);
+
+	std::shared_ptr<IMsvEvent> spEvent;
+	EXPECT_EQ(spVirtualThreading->GetEvent(spEvent), MSV_SUCCESS);
+
+	uint64_t executions = 0;
+	std::shared_ptr<IMsvUniqueWorker> spUniqueWorker;
+	EXPECT_EQ(spVirtualThreading->GetUniqueWorker(spUniqueWorker), MSV_SUCCESS);
+	EXPECT_EQ(spUniqueWorker->SetTask([&executions, &spEvent](void*) { if (++executions == 10) { spEvent->SetEvent(); } }, nullptr), MSV_SUCCESS);
+	EXPECT_EQ(spUniqueWorker->StartThread(60000000), MSV_SUCCESS);
+
+	//wait executes worker task in virtual time (10 minutes)
+	EXPECT_EQ(spEvent->WaitForEvent(), MSV_SUCCESS);
+	EXPECT_EQ(executions, 10u);
+	EXPECT_EQ(spVirtualScheduler->GetTime(), 600000000u);
+
+	EXPECT_EQ(spUniqueWorker->StopThread(), MSV_SUCCESS);
+	EXPECT_EQ(spUniqueWorker->WaitForThreadStop(), MSV_SUCCESS);
+
+	//nothing could set event anymore
+	EXPECT_EQ(spEvent->WaitForEvent(), MSV_NOT_FOUND_ERROR);
+	EXPECT_EQ(executions, 10u);
+}
+
 TEST_F(MsvThreading_Integration, ItShouldCreateOneThreadPoolInterface)
 {
 	std::shared_ptr<IMsvThreadPool> spThreadPool1;
@@ -90,6 +411,30 @@ TEST_F(MsvThreading_Integration, ItShouldCreateTwoUniqueWorkerInterface)
 	EXPECT_TRUE(spUniqueWorker1 != spUniqueWorker2);
 }
 
+TEST_F(MsvThreading_Integration, ItShouldCreateTwoUniqueWorkerInterfaceWithNotifier)
+{
+	std::shared_ptr<IMsvNotifier> spNotifier;
+	EXPECT_EQ(m_spThreading->GetNotifier(spNotifier), MSV_SUCCESS);
+	EXPECT_TRUE(spNotifier != nullptr);
+
+	std::shared_ptr<IMsvUniqueWorker> spUniqueWorker1;
+	EXPECT_EQ(m_spThreading->GetUniqueWorker(spUniqueWorker1, spNotifier), MSV_SUCCESS);
+	EXPECT_TRUE(spUniqueWorker1 != nullptr);
+
+	std::shared_ptr<IMsvUniqueWorker> spUniqueWorker2;
+	EXPECT_EQ(m_spThreading->GetUniqueWorker(spUniqueWorker2, spNotifier), MSV_SUCCESS);
+	EXPECT_TRUE(spUniqueWorker2 != nullptr);
+
+	EXPECT_TRUE(spUniqueWorker1 != spUniqueWorker2);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldFailedToCreateUniqueWorkerWithoutNotifier)
+{
+	std::shared_ptr<IMsvUniqueWorker> spUniqueWorker;
+	EXPECT_EQ(m_spThreading->GetUniqueWorker(spUniqueWorker, std::shared_ptr<IMsvNotifier>()), MSV_INVALID_DATA_ERROR);
+	EXPECT_TRUE(spUniqueWorker == nullptr);
+}
+
 TEST_F(MsvThreading_Integration, ItShouldCreateTwoWorkerInterface)
 {
 	std::shared_ptr<IMsvWorker> spWorker1;
@@ -102,3 +447,27 @@ TEST_F(MsvThreading_Integration, ItShouldCreateTwoWorkerInterface)
 
 	EXPECT_TRUE(spWorker1 != spWorker2);
 }
+
+TEST_F(MsvThreading_Integration, ItShouldCreateTwoWorkerInterfaceWithNotifier)
+{
+	std::shared_ptr<IMsvNotifier> spNotifier;
+	EXPECT_EQ(m_spThreading->GetNotifier(spNotifier), MSV_SUCCESS);
+	EXPECT_TRUE(spNotifier != nullptr);
+
+	std::shared_ptr<IMsvWorker> spWorker1;
+	EXPECT_EQ(m_spThreading->GetWorker(spWorker1, spNotifier), MSV_SUCCESS);
+	EXPECT_TRUE(spWorker1 != nullptr);
+
+	std::shared_ptr<IMsvWorker> spWorker2;
+	EXPECT_EQ(m_spThreading->GetWorker(spWorker2, spNotifier), MSV_SUCCESS);
+	EXPECT_TRUE(spWorker2 != nullptr);
+
+	EXPECT_TRUE(spWorker1 != spWorker2);
+}
+
+TEST_F(MsvThreading_Integration, ItShouldFailedToCreateWorkerWithoutNotifier)
+{
+	std::shared_ptr<IMsvWorker> spWorker;
+	EXPECT_EQ(m_spThreading->GetWorker(spWorker, std::shared_ptr<IMsvNotifier>()), MSV_INVALID_DATA_ERROR);
+	EXPECT_TRUE(spWorker == nullptr);
+}
@@ -0,0 +1,95 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Binary Log Decoder Tool
+* @details		Contains implementation of msysBlogDecoder @ref main function.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "msys/logging/MsvBinaryLogDecoder.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <fstream>
+#include <iostream>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief			Main function.
+* @details		Decodes binary log file (written by @ref IMsvBinaryLogger) to text.
+*					Usage: msysBlogDecoder binaryLogFile [textLogFile]
+*					Text is written to standard output when text log file is not set.
+* @param[in]	argc						Argument count.
+* @param[in]	argv						Arguments vector.
+* @returns		int
+* @retval		0							On success.
+* @retval		1							When arguments are invalid or output file could not be opened.
+* @retval		2							When binary log file could not be decoded.
+******************************************************************************************************/
+int main(int argc, char** argv)
+{
+	if (argc < 2 || argc > 3)
+	{
+		std::cerr << "Usage: msysBlogDecoder binaryLogFile [textLogFile]" << std::endl;
+		return 1;
+	}
+
+	std::ofstream outputFile;
+	if (argc == 3)
+	{
+		outputFile.open(argv[2]);
+		if (!outputFile)
+		{
+			std::cerr << "Output file " << argv[2] << " could not be opened." << std::endl;
+			return 1;
+		}
+	}
+
+	MsvBinaryLogDecoder decoder;
+	MsvErrorCode errorCode = decoder.DecodeFile(argv[1], argc == 3 ? outputFile : std::cout);
+
+	if (errorCode == MSV_NOT_FOUND_ERROR)
+	{
+		std::cerr << "Binary log file " << argv[1] << " could not be read." << std::endl;
+		return 2;
+	}
+
+	if (MSV_FAILED(errorCode))
+	{
+		std::cerr << "Binary log file " << argv[1] << " is corrupted (records before corrupted part have been decoded)." << std::endl;
+		return 2;
+	}
+
+	return 0;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,98 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Flight Recorder Dump Tool
+* @details		Contains implementation of msysFlightDump @ref main function.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "msys/logging/MsvFlightRecorderReader.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdlib>
+#include <iostream>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief			Main function.
+* @details		Dumps last records of flight recorder file (written by @ref IMsvFlightRecorder) to text.
+*					Usage: msysFlightDump recorderFile [lastSeconds]
+*					All records are dumped when last seconds are not set.
+* @param[in]	argc						Argument count.
+* @param[in]	argv						Arguments vector.
+* @returns		int
+* @retval		0							On success.
+* @retval		1							When arguments are invalid.
+* @retval		2							When flight recorder file could not be read.
+******************************************************************************************************/
+int main(int argc, char** argv)
+{
+	if (argc < 2 || argc > 3)
+	{
+		std::cerr << "Usage: msysFlightDump recorderFile [lastSeconds]" << std::endl;
+		return 1;
+	}
+
+	uint32_t lastSeconds = 0;
+	if (argc == 3)
+	{
+		char* pEnd = nullptr;
+		unsigned long value = std::strtoul(argv[2], &pEnd, 10);
+		if (pEnd == argv[2] || *pEnd != '\0' || value > UINT32_MAX)
+		{
+			std::cerr << "Last seconds " << argv[2] << " are invalid." << std::endl;
+			return 1;
+		}
+
+		lastSeconds = static_cast<uint32_t>(value);
+	}
+
+	MsvFlightRecorderReader reader;
+	MsvErrorCode errorCode = reader.DumpFile(argv[1], lastSeconds, std::cout);
+
+	if (errorCode == MSV_NOT_FOUND_ERROR)
+	{
+		std::cerr << "Flight recorder file " << argv[1] << " could not be read." << std::endl;
+		return 2;
+	}
+
+	if (MSV_FAILED(errorCode))
+	{
+		std::cerr << "File " << argv[1] << " is not flight recorder file." << std::endl;
+		return 2;
+	}
+
+	return 0;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,171 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Query Tool
+* @details		Contains implementation of msysLogQuery @ref main function.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "msys/logging/MsvLogIndexReader.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief			Parse time.
+* @details		Parses local time in format "YYYY-mm-dd HH:MM:SS".
+* @param[in]	text						Time text.
+* @param[out]	time						Parsed time.
+* @returns		bool
+* @retval		true						On success.
+* @retval		false						When text is not valid time.
+******************************************************************************************************/
+static bool ParseTime(const char* text, std::chrono::system_clock::time_point& time)
+{
+	std::tm localTime = {};
+	char end = '\0';
+	if (std::sscanf(text, "%d-%d-%d %d:%d:%d%c", &localTime.tm_year, &localTime.tm_mon, &localTime.tm_mday, &localTime.tm_hour, &localTime.tm_min, &localTime.tm_sec, &end) != 6)
+	{
+		return false;
+	}
+
+	localTime.tm_year -= 1900;
+	localTime.tm_mon -= 1;
+	localTime.tm_isdst = -1;
+
+	std::time_t seconds = std::mktime(&localTime);
+	if (seconds == static_cast<std::time_t>(-1))
+	{
+		return false;
+	}
+
+	time = std::chrono::system_clock::from_time_t(seconds);
+
+	return true;
+}
+
+/**************************************************************************************************//**
+* @brief			Main function.
+* @details		Writes records of log files which match time range, minimum level and logger. Only blocks
+*					matching sidecar index (written when @ref IMsvAsyncLoggerProvider::EnableLogIndex is called)
+*					are read, log files without index are scanned whole.
+*					Usage: msysLogQuery [-f from] [-t to] [-l minLevel] [-n logger] logFile...
+*					Times are local times in format "YYYY-mm-dd HH:MM:SS" (-t includes whole second), level is
+*					spdlog level name (trace, debug, info, warning, error, critical).
+* @param[in]	argc						Argument count.
+* @param[in]	argv						Arguments vector.
+* @returns		int
+* @retval		0							On success.
+* @retval		1							When arguments are invalid.
+* @retval		2							When any log file could not be read.
+******************************************************************************************************/
+int main(int argc, char** argv)
+{
+	std::chrono::system_clock::time_point from = (std::chrono::system_clock::time_point::min)();
+	std::chrono::system_clock::time_point to = (std::chrono::system_clock::time_point::max)();
+	uint32_t levelMask = MSV_LOG_LEVEL_MASK_ALL;
+	const char* loggerName = nullptr;
+
+	int argument = 1;
+	for (; argument + 1 < argc && argv[argument][0] == '-' && std::strlen(argv[argument]) == 2; argument += 2)
+	{
+		const char* value = argv[argument + 1];
+		switch (argv[argument][1])
+		{
+		case 'f':
+			if (!ParseTime(value, from))
+			{
+				std::cerr << "Time " << value << " is invalid." << std::endl;
+				return 1;
+			}
+			break;
+		case 't':
+			if (!ParseTime(value, to))
+			{
+				std::cerr << "Time " << value << " is invalid." << std::endl;
+				return 1;
+			}
+			to += std::chrono::seconds(1) - std::chrono::nanoseconds(1);
+			break;
+		case 'l':
+		{
+			MsvLogLevel minLevel = spdlog::level::from_str(value);
+			if (minLevel == MsvLogLevel::off)
+			{
+				std::cerr << "Level " << value << " is invalid." << std::endl;
+				return 1;
+			}
+
+			levelMask = MSV_LOG_LEVEL_MASK_ALL << static_cast<uint32_t>(minLevel);
+			break;
+		}
+		case 'n':
+			loggerName = value;
+			break;
+		default:
+			argument = argc;
+			break;
+		}
+	}
+
+	if (argument >= argc)
+	{
+		std::cerr << "Usage: msysLogQuery [-f \"YYYY-mm-dd HH:MM:SS\"] [-t \"YYYY-mm-dd HH:MM:SS\"] [-l minLevel] [-n logger] logFile..." << std::endl;
+		return 1;
+	}
+
+	int result = 0;
+	MsvLogIndexReader reader;
+	for (; argument < argc; ++argument)
+	{
+		MsvErrorCode errorCode = reader.Query(argv[argument], from, to, levelMask, loggerName, std::cout);
+		if (errorCode == MSV_INVALID_DATA_ERROR)
+		{
+			std::cerr << "Log file " << argv[argument] << " is not written with default pattern." << std::endl;
+			result = 2;
+		}
+		else if (MSV_FAILED(errorCode))
+		{
+			std::cerr << "Log file " << argv[argument] << " could not be read." << std::endl;
+			result = 2;
+		}
+	}
+
+	return result;
+}
+
+/** @} */	//End of group MSYS.
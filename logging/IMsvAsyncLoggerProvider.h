@@ -0,0 +1,267 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Async Logger Provider Interface
+* @details		Contains definition of @ref IMsvAsyncLoggerProvider interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_IASYNCLOGGERPROVIDER_H
+#define MARSTECH_IASYNCLOGGERPROVIDER_H
+
+
+#include "MsvLogSubscription.h"
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Log level mask.
+* @details	Bit of log level in level masks (see @ref IMsvAsyncLoggerProvider::QueryLogFile).
+******************************************************************************************************/
+#define MSV_LOG_LEVEL_MASK(level) (1u << static_cast<uint32_t>(level))
+
+/**************************************************************************************************//**
+* @brief		All log levels mask.
+******************************************************************************************************/
+#define MSV_LOG_LEVEL_MASK_ALL 0xFFFFFFFFu
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Overflow Policy.
+* @details	Behaviour of log call when log queue is full.
+******************************************************************************************************/
+enum class MsvLogOverflowPolicy: int32_t
+{
+	MSV_LOG_OVERFLOW_BLOCK = 0,				///< Log call waits until there is free space in queue.
+	MSV_LOG_OVERFLOW_DROP,						///< Log record is dropped.
+	MSV_LOG_OVERFLOW_DROP_AND_COUNT			///< Log record is dropped and counted (summary is written to log).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Fsync Policy.
+* @details	When written log records are synchronized to disk (by batched file sink).
+******************************************************************************************************/
+enum class MsvLogFsyncPolicy: int32_t
+{
+	MSV_LOG_FSYNC_NEVER = 0,					///< Log file is never synchronized (operating system decides).
+	MSV_LOG_FSYNC_ON_ROTATION,					///< Log file is synchronized before it is rotated.
+	MSV_LOG_FSYNC_ON_FLUSH,						///< Log file is synchronized on each flush (flush interval and error records).
+	MSV_LOG_FSYNC_ON_WRITE						///< Log file is synchronized after each batch write.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Async Logger Provider Interface.
+* @details	Logger provider which does not write log records in context of calling thread. Log calls
+*				just push records to lock-free queue and one background thread formats and writes them.
+* @see		IMsvLoggerProvider
+******************************************************************************************************/
+class IMsvAsyncLoggerProvider:
+	public IMsvLoggerProvider
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvAsyncLoggerProvider() {}
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Waits until all log records pushed before this call are written and flushed (and until
+	*					rotated files are compressed when log compression is enabled).
+	* @retval		MSV_NOT_RUNNING_INFO			When background thread is not running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Flush() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get dropped records count.
+	* @details		Returns number of log records dropped because of full queue (only for
+	*					@ref MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_DROP_AND_COUNT).
+	* @returns		uint64_t
+	******************************************************************************************************/
+	virtual uint64_t GetDroppedRecordsCount() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Enable log compression.
+	* @details		Rotated log files of loggers created after this call are compressed (gzip) in low priority
+	*					background thread, so log calls and background writer never wait for compression.
+	*					Compressed files are named "<name>.<index>.<ext>.gz" (1 is the newest) and the oldest ones
+	*					are removed when size of all compressed files of log file exceeds limit (instead of
+	*					maxLogFiles limit).
+	* @param[in]	maxCompressedLogsSize		Maximum size of all compressed files of one log file (in bytes).
+	*													Zero means maxLogFileSize * maxLogFiles of log file (same disk space
+	*													as uncompressed rotation, but much longer history).
+	* @retval		MSV_ALREADY_RUNNING_INFO		When log compression is already enabled.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Call it before loggers are created (default log file sink is not changed when it exists).
+	******************************************************************************************************/
+	virtual MsvErrorCode EnableLogCompression(uint64_t maxCompressedLogsSize = 0) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Enable per-thread buffers.
+	* @details		Each logging thread pushes records to its own queue, so threads logging by one logger do
+	*					not contend on shared queue. Background thread merges queues in time order (k-way merge)
+	*					and writes records to file in time order.
+	* @param[in]	maxStaleness						Maximum time (in milliseconds) between log call and flush of its
+	*														record to file (half of it is merge window).
+	* @param[in]	threadBufferSize					Capacity of thread queue (number of records). Overflow policy is
+	*														applied when it is full.
+	* @retval		MSV_INVALID_DATA_ERROR			When max staleness is lower than 2 ms or buffer size is zero.
+	* @retval		MSV_ALREADY_INITIALIZED_INFO	When per-thread buffers are already enabled.
+	* @retval		MSV_NOT_RUNNING_INFO				When background thread is not running.
+	* @retval		MSV_SUCCESS							On success.
+	* @note			It might be called at any time (records queued before are merged too).
+	******************************************************************************************************/
+	virtual MsvErrorCode EnablePerThreadBuffers(uint32_t maxStaleness = 100, size_t threadBufferSize = 1024) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Enable deduplication.
+	* @details		Identical consecutive records of one logger (same level and message, compared by hash and
+	*					then by content) are not written within dedup window after the first one. Background
+	*					thread writes "Last message repeated N times." instead of them when different record
+	*					comes, when window elapses or when log is flushed.
+	* @param[in]	window							Dedup window (in milliseconds, zero disables deduplication).
+	* @retval		MSV_NOT_RUNNING_INFO			When background thread is not running.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			It might be called at any time.
+	******************************************************************************************************/
+	virtual MsvErrorCode EnableDeduplication(uint32_t window = 1000) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Enable batched writes.
+	* @details		Log files of loggers created after this call are written by batched file sink. Formatted
+	*					records are coalesced into large aligned buffers which are written by one vectored write
+	*					(when buffers are full and on flush) and space for whole log file is preallocated when
+	*					file is opened, so file growth does not update file metadata on each write.
+	* @param[in]	batchSize						Size of batch buffers (in bytes).
+	* @param[in]	fsyncPolicy						When written records are synchronized to disk.
+	* @retval		MSV_INVALID_DATA_ERROR		When batch size is zero.
+	* @retval		MSV_ALREADY_INITIALIZED_INFO	When batched writes are already enabled.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Call it before loggers are created (default log file sink is not changed when it exists). It
+	*					might be combined with log compression.
+	******************************************************************************************************/
+	virtual MsvErrorCode EnableBatchedWrites(size_t batchSize = 1048576, MsvLogFsyncPolicy fsyncPolicy = MsvLogFsyncPolicy::MSV_LOG_FSYNC_NEVER) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Enable log index.
+	* @details		Log files of loggers created after this call are written with sidecar index ("<log
+	*					file>.idx"). Index contains offset, time range and level bitmap of each block of log
+	*					file, so @ref MsvLogIndexReader (and msysLogQuery tool) reads only blocks which match
+	*					searched time range and levels. Indexed files are written by batched file sink (with one
+	*					batch chunk when batched writes are not enabled).
+	* @param[in]	blockSize						Minimum size of indexed block (in bytes).
+	* @retval		MSV_INVALID_DATA_ERROR		When block size is zero.
+	* @retval		MSV_ALREADY_INITIALIZED_INFO	When log index is already enabled.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Call it before loggers are created (default log file sink is not changed when it exists).
+	*					Compressed rotated files are not indexed.
+	******************************************************************************************************/
+	virtual MsvErrorCode EnableLogIndex(uint32_t blockSize = 65536) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Enable background rotation.
+	* @details		Log files of loggers created after this call are rotated by background rotator thread.
+	*					Next log file is prepared (opened and preallocated) ahead of time, so rotation in backend
+	*					thread is just swap of file handles, and full files are closed, renamed and pruned (or
+	*					passed to compressor) by rotator. Rotated files are written by batched file sink (with one
+	*					batch chunk when batched writes are not enabled).
+	* @retval		MSV_ALREADY_RUNNING_INFO		When background rotation is already enabled.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Call it before loggers are created (default log file sink is not changed when it exists).
+	*					File is appended over maximum log file size until previous rotation is done.
+	******************************************************************************************************/
+	virtual MsvErrorCode EnableBackgroundRotation() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Subscribe.
+	* @details		Registers subscriber which receives records of loggers of this provider. Records are
+	*					delivered by background thread when they are written (log calls are not slowed down and
+	*					background thread skips delivery completely when there is no subscriber).
+	* @param[out]	subscriptionId					Subscription ID (it is passed to @ref Unsubscribe).
+	* @param[in]	subscriber						Subscriber.
+	* @param[in]	minLevel							Minimum log level of delivered records.
+	* @param[in]	loggerName						Logger name of delivered records (nullptr for all loggers).
+	* @retval		MSV_INVALID_DATA_ERROR		When subscriber is empty.
+	* @retval		MSV_NOT_RUNNING_INFO			When background thread is not running.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Repeated records suppressed by deduplication are delivered too.
+	******************************************************************************************************/
+	virtual MsvErrorCode Subscribe(uint32_t& subscriptionId, MsvLogSubscriber subscriber, MsvLogLevel minLevel = MsvLogLevel::trace, const char* loggerName = nullptr) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Unsubscribe.
+	* @details		Removes subscription. Subscriber is not called after this method returns.
+	* @param[in]	subscriptionId					Subscription ID.
+	* @retval		MSV_NOT_FOUND_ERROR			When subscription does not exist.
+	* @retval		MSV_NOT_RUNNING_INFO			When background thread is not running.
+	* @retval		MSV_SUCCESS						On success.
+	* @warning		It must not be called by subscriber.
+	******************************************************************************************************/
+	virtual MsvErrorCode Unsubscribe(uint32_t subscriptionId) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Query log file.
+	* @details		Writes records of log file which match time range, levels and logger to output. Only
+	*					matching blocks are read when log file has index (see @ref EnableLogIndex), whole file is
+	*					scanned other way.
+	* @param[in]	logFile							Log file name (in log folder, nullptr means default log file).
+	* @param[in]	from								The oldest matching log time.
+	* @param[in]	to									The newest matching log time.
+	* @param[in]	levelMask						Matching levels (see @ref MSV_LOG_LEVEL_MASK).
+	* @param[in]	loggerName						Matching logger name (nullptr or empty string means all loggers).
+	* @param[out]	output							Text output.
+	* @retval		MSV_NOT_FOUND_ERROR			When log file could not be read.
+	* @retval		MSV_INVALID_DATA_ERROR		When records are not written with default pattern (JSON lines or
+	*														custom pattern).
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Queued records are not in log file yet (call @ref Flush before query).
+	******************************************************************************************************/
+	virtual MsvErrorCode QueryLogFile(const char* logFile, std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, uint32_t levelMask, const char* loggerName, std::ostream& output) const = 0;
+};
+
+
+#endif // !MARSTECH_IASYNCLOGGERPROVIDER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,132 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Binary Logger Interface
+* @details		Contains definition of @ref IMsvBinaryLogger interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_IBINARYLOGGER_H
+#define MARSTECH_IBINARYLOGGER_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Binary Log Site.
+* @details	Static description of one binary log call site. It is registered once (when the call site
+*				logs first time) and log records refer to it by its ID.
+* @see		MSV_BLOG_INFO
+******************************************************************************************************/
+struct MsvBinaryLogSite
+{
+	const char* format;											///< Format string (fmt syntax).
+	const char* file;												///< Source file.
+	uint32_t line;													///< Source line.
+	MsvLogLevel level;											///< Log level.
+	std::atomic<uint32_t> id;									///< Site ID (0 when call site is not registered yet).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Binary Logger Interface.
+* @details	Logger which does not format log messages. Log record contains just call site ID, timestamp,
+*				thread ID and raw arguments. Log files are decoded to text by @ref MsvBinaryLogDecoder
+*				(msysBlogDecoder tool).
+* @note		Use MSV_BLOG_* macros (@ref MsvBinaryLog.h) instead of calling this interface directly.
+******************************************************************************************************/
+class IMsvBinaryLogger
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvBinaryLogger() {}
+
+	/**************************************************************************************************//**
+	* @brief			Should log.
+	* @details		Checks if log level is enabled.
+	* @param[in]	logLevel				Log level.
+	* @returns		bool
+	* @retval		true					When log level is enabled.
+	* @retval		false					When log level is disabled.
+	******************************************************************************************************/
+	virtual bool ShouldLog(MsvLogLevel logLevel) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Set log level.
+	* @details		Sets minimal log level of this logger. Default level is INFO.
+	* @param[in]	logLevel				Log level to set.
+	******************************************************************************************************/
+	virtual void SetLogLevel(MsvLogLevel logLevel) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Register site.
+	* @details		Assigns ID to call site. Site definition (format string, source location and argument
+	*					types) is written to log file before the first record of the site.
+	* @param[in]	site					Call site.
+	* @param[in]	argTypes				Argument types (one character per argument, see @ref MsvBinaryLogArg).
+	* @returns		uint32_t
+	* @retval		0						When memory allocation failed.
+	* @retval		other					Site ID.
+	******************************************************************************************************/
+	virtual uint32_t RegisterSite(MsvBinaryLogSite& site, const char* argTypes) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Log record.
+	* @details		Pushes encoded record (site ID and arguments) to async log backend.
+	* @param[in]	logLevel				Log level.
+	* @param[in]	pRecord				Encoded record.
+	* @param[in]	recordSize			Encoded record size (in bytes).
+	******************************************************************************************************/
+	virtual void Log(MsvLogLevel logLevel, const char* pRecord, size_t recordSize) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Waits until all log records pushed before this call are written and flushed.
+	* @retval		MSV_NOT_RUNNING_INFO			When background thread is not running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Flush() = 0;
+};
+
+
+#endif // !MARSTECH_IBINARYLOGGER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,102 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Flight Recorder Interface
+* @details		Contains definition of @ref IMsvFlightRecorder interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_IFLIGHTRECORDER_H
+#define MARSTECH_IFLIGHTRECORDER_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Flight Recorder Interface.
+* @details	Crash safe in-memory log. Log records are written by plain stores to fixed size ring in memory
+*				mapped file. Pages are kept by kernel when the process crashes, so last records might be
+*				extracted by msysFlightDump tool (@ref MsvFlightRecorderReader) post mortem.
+* @note		Recorder does not write to disk in context of logging thread (kernel writes dirty pages).
+******************************************************************************************************/
+class IMsvFlightRecorder
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvFlightRecorder() {}
+
+	/**************************************************************************************************//**
+	* @brief			Attach logger.
+	* @details		Attaches flight recorder sink to forwarding sink of logger (it might be called while logger is
+	*					used by other threads). Recorder records messages which are not below recorder level, even
+	*					when they are below configured log level (@ref IMsvLogging::SetLogLevel). Logger level is
+	*					lowered to recorder level, logger sinks (log files) keep configured log level.
+	* @param[in]	spLogger					Logger to attach.
+	* @retval		MSV_INVALID_DATA_ERROR		When logger is empty.
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When recorder is not initialized.
+	* @retval		MSV_NOT_FOUND_ERROR			When logger has not been created by @ref IMsvLogging (it has no
+	*														forwarding sink).
+	* @retval		MSV_ALREADY_EXISTS_ERROR	When logger has been already attached.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode AttachLogger(std::shared_ptr<MsvLogger> spLogger) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Set recorder level.
+	* @details		Sets minimal level of recorded log records. Default level is TRACE.
+	* @param[in]	logLevel					Recorder level.
+	* @note			Level of attached loggers is updated (it is the lowest of configured log level and recorder
+	*					level), level of their sinks is not changed.
+	******************************************************************************************************/
+	virtual void SetRecorderLevel(MsvLogLevel logLevel) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Synchronously writes mapped pages to disk (it is not required for process crash, just for
+	*					system crash or power failure).
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When recorder file is not mapped.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Flush() = 0;
+};
+
+
+#endif // !MARSTECH_IFLIGHTRECORDER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,377 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Context Interface
+* @details		Contains thread local mapped diagnostic context interface @ref IMsvLogContext of log records.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_ILOGCONTEXT_H
+#define MARSTECH_ILOGCONTEXT_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Log context slots.
+* @details	Maximum number of key/value fields in log context of one thread.
+******************************************************************************************************/
+#define MSV_LOG_CONTEXT_SLOTS 8
+
+/**************************************************************************************************//**
+* @brief		Log context value size.
+* @details	Maximum size of value (including terminating zero, longer values are truncated).
+******************************************************************************************************/
+#define MSV_LOG_CONTEXT_VALUE_SIZE 56
+
+#define MSV_LOG_CONTEXT_CONCAT_IMPL(name, id) name##id															///< Concatenates name and ID.
+#define MSV_LOG_CONTEXT_CONCAT(name, id) MSV_LOG_CONTEXT_CONCAT_IMPL(name, id)							///< @copydoc MSV_LOG_CONTEXT_CONCAT_IMPL
+
+/**************************************************************************************************//**
+* @brief		Log context macro.
+* @details	Adds key/value field to log context of calling thread until end of current scope.
+* @note		Key must be string literal (or other string with static storage), it is not copied.
+******************************************************************************************************/
+#define MSV_LOG_CONTEXT(key, value) MsvLogContextScope MSV_LOG_CONTEXT_CONCAT(msvLogContextScope, __COUNTER__)(key, value)
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Context Slot.
+* @details	One key/value field of log context.
+******************************************************************************************************/
+struct MsvLogContextSlot
+{
+	const char* key;												///< Key (static storage, it is not copied).
+	char value[MSV_LOG_CONTEXT_VALUE_SIZE];				///< Value (zero terminated).
+};
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Context Data.
+* @details	Immutable snapshot of log context. Log records capture it by pointer copy (and reference count
+*				increment), so fields are serialized by background thread when record is written.
+******************************************************************************************************/
+struct MsvLogContextData
+{
+	std::atomic<uint32_t> references;						///< Reference count.
+	uint32_t slotsCount;										///< Number of used slots.
+	MsvLogContextSlot slots[MSV_LOG_CONTEXT_SLOTS];		///< Key/value fields.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Context Interface.
+* @details	Thread local mapped diagnostic context. Each thread has pointer to its current context snapshot
+*				(nullptr when it is empty). Thread local pointer (and allocation of snapshots) lives in msys
+*				library only, other binaries change it through this interface (see @ref MsvLogContextScope).
+* @see		IMsvLogging::GetLogContext
+******************************************************************************************************/
+class IMsvLogContext
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvLogContext() {}
+
+	/**************************************************************************************************//**
+	* @brief			Acquire context.
+	* @details		Returns current context of calling thread with new reference.
+	* @returns		MsvLogContextData*
+	* @retval		nullptr								When context is empty.
+	* @note			Returned context must be released by @ref ReleaseContext.
+	******************************************************************************************************/
+	virtual MsvLogContextData* AcquireContext() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Release context.
+	* @details		Releases reference of context (context is deleted with its last reference).
+	* @param[in]	pContext								Context (it might be nullptr).
+	******************************************************************************************************/
+	virtual void ReleaseContext(MsvLogContextData* pContext) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Push context field.
+	* @details		Sets copy of current context of calling thread with added (or replaced) field as current
+	*					context. Current context is kept when memory allocation failed.
+	* @param[in]	key									Key (static storage).
+	* @param[in]	value									Value (truncated to @ref MSV_LOG_CONTEXT_VALUE_SIZE).
+	* @returns		MsvLogContextData*				Previous context (it is passed to @ref PopContext).
+	******************************************************************************************************/
+	virtual MsvLogContextData* PushContext(const char* key, spdlog::string_view_t value) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Push context.
+	* @details		Sets propagated context (with new reference) as current context of calling thread.
+	* @param[in]	pContext								Propagated context (it might be nullptr).
+	* @returns		MsvLogContextData*				Previous context (it is passed to @ref PopContext).
+	******************************************************************************************************/
+	virtual MsvLogContextData* PushContext(MsvLogContextData* pContext) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Pop context.
+	* @details		Restores previous context of calling thread (current context is released).
+	* @param[in]	pPrevious							Previous context returned by @ref PushContext.
+	******************************************************************************************************/
+	virtual void PopContext(MsvLogContextData* pPrevious) = 0;
+};
+
+
+/**************************************************************************************************//**
+* @brief			Log context binding.
+* @details		Returns cached log context interface which is used by log context scopes of this binary (EXE or
+*					DLL). Context scopes do nothing while this binary is not bound (nullptr).
+* @returns		std::atomic<IMsvLogContext*>&
+* @note			Each binary has its own copy of this function (and cached pointer).
+******************************************************************************************************/
+inline std::atomic<IMsvLogContext*>& MsvLogContextBinding()
+{
+	static std::atomic<IMsvLogContext*> pLogContext(nullptr);
+	return pLogContext;
+}
+
+/**************************************************************************************************//**
+* @brief			Bind log context.
+* @details		Caches log context interface for log context scopes of this binary.
+* @param[in]	pLogContext							Log context (@ref IMsvLogging::GetLogContext), nullptr unbinds
+*															this binary.
+* @warning		Binary must be unbound before @ref IMsvLogging is released.
+* @see			MsvLogBind
+******************************************************************************************************/
+inline void MsvLogContextBind(IMsvLogContext* pLogContext)
+{
+	MsvLogContextBinding().store(pLogContext, std::memory_order_release);
+}
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Context Reference.
+* @details	Shared reference of log context. It is used to propagate context of one thread to other threads
+*				(see @ref MsvLogContextWrap).
+******************************************************************************************************/
+class MsvLogContextRef
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @details		Captures current context of calling thread.
+	******************************************************************************************************/
+	MsvLogContextRef():
+		m_pLogContext(MsvLogContextBinding().load(std::memory_order_acquire)),
+		m_pContext(m_pLogContext ? m_pLogContext->AcquireContext() : nullptr)
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Copy constructor.
+	* @param[in]	origin								Original reference.
+	******************************************************************************************************/
+	MsvLogContextRef(const MsvLogContextRef& origin):
+		m_pLogContext(origin.m_pLogContext),
+		m_pContext(origin.m_pContext)
+	{
+		if (m_pContext)
+		{
+			m_pContext->references.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	* @details	Releases captured context.
+	******************************************************************************************************/
+	~MsvLogContextRef()
+	{
+		if (m_pContext)
+		{
+			m_pLogContext->ReleaseContext(m_pContext);
+		}
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Assign operator.
+	* @param[in]	origin								Original reference.
+	* @returns		MsvLogContextRef&
+	******************************************************************************************************/
+	MsvLogContextRef& operator=(const MsvLogContextRef& origin)
+	{
+		if (origin.m_pContext)
+		{
+			origin.m_pContext->references.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		if (m_pContext)
+		{
+			m_pLogContext->ReleaseContext(m_pContext);
+		}
+
+		m_pLogContext = origin.m_pLogContext;
+		m_pContext = origin.m_pContext;
+
+		return *this;
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Get context.
+	* @returns		MsvLogContextData*
+	* @retval		nullptr								When captured context is empty.
+	******************************************************************************************************/
+	MsvLogContextData* Get() const
+	{
+		return m_pContext;
+	}
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Log context.
+	* @details	Interface which owns captured context (or nullptr).
+	******************************************************************************************************/
+	IMsvLogContext* m_pLogContext;
+
+	/**************************************************************************************************//**
+	* @brief		Context.
+	* @details	Captured context (or nullptr).
+	******************************************************************************************************/
+	MsvLogContextData* m_pContext;
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Context Scope.
+* @details	Scope guard which changes log context of calling thread and restores previous context when it
+*				is destroyed.
+******************************************************************************************************/
+class MsvLogContextScope
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @details		Adds field to context of calling thread.
+	* @param[in]	key									Key (static storage, it is not copied).
+	* @param[in]	value									Value.
+	******************************************************************************************************/
+	MsvLogContextScope(const char* key, spdlog::string_view_t value):
+		m_pLogContext(MsvLogContextBinding().load(std::memory_order_acquire)),
+		m_pPrevious(m_pLogContext ? m_pLogContext->PushContext(key, value) : nullptr)
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @details		Adds integer field to context of calling thread.
+	* @param[in]	key									Key (static storage, it is not copied).
+	* @param[in]	value									Value.
+	******************************************************************************************************/
+	MsvLogContextScope(const char* key, int64_t value):
+		MsvLogContextScope(key, spdlog::string_view_t(std::to_string(value)))
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @details		Sets propagated context as context of calling thread.
+	* @param[in]	contextRef							Context reference.
+	******************************************************************************************************/
+	explicit MsvLogContextScope(const MsvLogContextRef& contextRef):
+		m_pLogContext(MsvLogContextBinding().load(std::memory_order_acquire)),
+		m_pPrevious(m_pLogContext ? m_pLogContext->PushContext(contextRef.Get()) : nullptr)
+	{
+
+	}
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	* @details	Restores previous context.
+	******************************************************************************************************/
+	~MsvLogContextScope()
+	{
+		if (m_pLogContext)
+		{
+			m_pLogContext->PopContext(m_pPrevious);
+		}
+	}
+
+	MsvLogContextScope(const MsvLogContextScope&) = delete;					///< Scope is not copyable.
+	MsvLogContextScope& operator=(const MsvLogContextScope&) = delete;		///< @copydoc MsvLogContextScope(const MsvLogContextScope&)
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Log context.
+	* @details	Interface which changes context of calling thread (nullptr when binary is not bound).
+	******************************************************************************************************/
+	IMsvLogContext* m_pLogContext;
+
+	/**************************************************************************************************//**
+	* @brief		Previous context.
+	* @details	Context which is restored when scope is destroyed (or nullptr).
+	******************************************************************************************************/
+	MsvLogContextData* m_pPrevious;
+};
+
+
+/**************************************************************************************************//**
+* @brief			Wrap task.
+* @details		Returns task which runs with log context of calling thread (use it for tasks added to thread
+*					pools and workers).
+* @param[in]	task									Task.
+* @returns		std::function<void(void*)>
+* @note			Task is returned unchanged when context is empty.
+******************************************************************************************************/
+inline std::function<void(void*)> MsvLogContextWrap(std::function<void(void*)> task)
+{
+	MsvLogContextRef contextRef;
+	if (!contextRef.Get())
+	{
+		return task;
+	}
+
+	return [contextRef, task](void* pContext)
+	{
+		MsvLogContextScope scope(contextRef);
+		task(pContext);
+	};
+}
+
+
+#endif // !MARSTECH_ILOGCONTEXT_H
+
+/** @} */	//End of group MSYS.
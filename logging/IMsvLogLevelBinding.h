@@ -0,0 +1,121 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Level Binding Interface
+* @details		Contains definition of @ref IMsvLogLevelBinding interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_ILOGLEVELBINDING_H
+#define MARSTECH_ILOGLEVELBINDING_H
+
+
+#include "IMsvBinaryLogger.h"
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Level Binding Interface.
+* @details	Binds log levels of loggers to active config keys. Bound keys are read periodically by
+*				background thread and changed values are stored to level words of loggers, which are
+*				atomic and log calls read them by relaxed load (no locking on logging path).
+*				Log level value in active config is int32 value of @ref MsvLogLevel (0 - trace, 1 - debug,
+*				2 - info, 3 - warning, 4 - error, 5 - critical, 6 - off).
+* @note		Level is changed only when config value changes, so @ref IMsvLogging::SetLogLevel is kept until
+*				next change of bound value.
+******************************************************************************************************/
+class IMsvLogLevelBinding
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvLogLevelBinding() {}
+
+	/**************************************************************************************************//**
+	* @brief			Bind logger.
+	* @details		Binds log level of logger to active config key and applies current value.
+	* @param[in]	spLogger							Logger.
+	* @param[in]	levelKey							Active config key of log level (int32 value).
+	* @retval		MSV_INVALID_DATA_ERROR		When logger is empty.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			One logger might be bound to more keys (the last changed value wins).
+	******************************************************************************************************/
+	virtual MsvErrorCode BindLogger(std::shared_ptr<MsvLogger> spLogger, int32_t levelKey) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Bind binary logger.
+	* @details		Binds log level of binary logger to active config key and applies current value.
+	* @param[in]	spLogger							Binary logger.
+	* @param[in]	levelKey							Active config key of log level (int32 value).
+	* @retval		MSV_INVALID_DATA_ERROR		When logger is empty.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode BindBinaryLogger(std::shared_ptr<IMsvBinaryLogger> spLogger, int32_t levelKey) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Bind log categories.
+	* @details		Binds global mask of enabled log categories (@ref IMsvLogging::GetLogCategoriesMask) to active config key
+	*					and applies current value.
+	* @param[in]	categoriesKey					Active config key of log categories (int32 value of bit mask).
+	* @retval		MSV_SUCCESS						On success.
+	* @see			MSV_LOG_CAT
+	******************************************************************************************************/
+	virtual MsvErrorCode BindLogCategories(int32_t categoriesKey) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Unbind all loggers.
+	* @details		Removes all bindings (levels of loggers are not changed). Call it before active config
+	*					is uninitialized.
+	******************************************************************************************************/
+	virtual void UnbindAll() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Refresh.
+	* @details		Reads all bound keys and applies changed values immediately (it is called periodically
+	*					by background thread).
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Keys which could not be read and invalid level values are ignored.
+	******************************************************************************************************/
+	virtual MsvErrorCode Refresh() = 0;
+};
+
+
+#endif // !MARSTECH_ILOGLEVELBINDING_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,105 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Rate Limit Registry Interface
+* @details		Contains registry interface @ref IMsvLogRateLimitRegistry of rate limited log call sites.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_ILOGRATELIMITREGISTRY_H
+#define MARSTECH_ILOGRATELIMITREGISTRY_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+struct MsvLogRateLimitSite;
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Rate Limit Registry Interface.
+* @details	Registry of rate limited log call sites which have suppressed calls. Count of suppressed calls is
+*				written by rate limited call site when its next window starts, so count of site which stops
+*				logging would never be written. Registry writes it by its background thread (once a second for
+*				sites without log calls in last window) and by @ref Flush.
+* @see		MSV_LOG_RATE_LIMITED
+* @see		IMsvLogging::GetLogRateLimitRegistry
+******************************************************************************************************/
+class IMsvLogRateLimitRegistry
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvLogRateLimitRegistry() {}
+
+	/**************************************************************************************************//**
+	* @brief			Register site.
+	* @details		Registers rate limited call site (it is called when site suppresses its first call).
+	*					Summary of suppressed calls is written to logger (when it still exists).
+	* @param[in]	site								Call site state (static storage of binary).
+	* @param[in]	pOwner							Binary which owns site (see @ref UnregisterSites).
+	* @param[in]	spLogger							Logger of summary.
+	* @param[in]	logLevel							Log level of summary.
+	* @param[in]	file								Source file of call site.
+	* @param[in]	line								Source line of call site.
+	* @retval		MSV_ALREADY_EXISTS_ERROR	When site is already registered.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode RegisterSite(MsvLogRateLimitSite& site, const void* pOwner, const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel, const char* file, uint32_t line) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Unregister sites.
+	* @details		Writes pending summaries and unregisters all sites of binary (it is called when binary is
+	*					unbound, registry does not access its static storage anymore).
+	* @param[in]	pOwner							Binary which owns sites.
+	******************************************************************************************************/
+	virtual void UnregisterSites(const void* pOwner) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Writes summaries of suppressed calls of all registered sites (it does not flush loggers).
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Flush() = 0;
+};
+
+
+#endif // !MARSTECH_ILOGRATELIMITREGISTRY_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,117 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Shipper Interface
+* @details		Contains definition of @ref IMsvLogShipper interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_ILOGSHIPPER_H
+#define MARSTECH_ILOGSHIPPER_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Shipper Interface.
+* @details	Streams log records of attached loggers to local collector daemon over UNIX domain socket.
+*				Records are sent in batches, each record is prefixed by its size (4 bytes, little endian).
+*				Logging threads only copy records to bounded buffer. Background thread sends them, reconnects
+*				to collector (it never blocks logging threads) and appends records to spill file (with the same
+*				framing) when collector is not connected or it is too slow. Spilled records (also spill file of
+*				previous run) are sent before new records when collector is connected again.
+* @note		Records are dropped (and counted) when buffer or spill file is full.
+******************************************************************************************************/
+class IMsvLogShipper
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvLogShipper() {}
+
+	/**************************************************************************************************//**
+	* @brief			Attach logger.
+	* @details		Attaches shipper sink to forwarding sink of logger (it might be called while logger is used by
+	*					other threads). Records of configured log level are shipped (flight recorder level does not
+	*					apply) and they are formatted by shipper pattern.
+	* @param[in]	spLogger					Logger to attach.
+	* @retval		MSV_INVALID_DATA_ERROR		When logger is empty.
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When shipper is not initialized.
+	* @retval		MSV_NOT_FOUND_ERROR			When logger has not been created by @ref IMsvLogging (it has no
+	*														forwarding sink).
+	* @retval		MSV_ALREADY_EXISTS_ERROR	When logger has been already attached.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode AttachLogger(std::shared_ptr<MsvLogger> spLogger) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Waits until buffered records are sent to collector or spilled to file.
+	* @retval		MSV_NOT_RUNNING_INFO			When shipper is not running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Flush() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Is connected.
+	* @details		Returns true when shipper is connected to collector.
+	* @returns		bool
+	******************************************************************************************************/
+	virtual bool IsConnected() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get spilled records count.
+	* @details		Returns number of records which have been written to spill file instead of collector.
+	* @returns		uint64_t
+	******************************************************************************************************/
+	virtual uint64_t GetSpilledRecordsCount() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get dropped records count.
+	* @details		Returns number of records which have been dropped because buffer was full (or spill file
+	*					could not be written).
+	* @returns		uint64_t
+	******************************************************************************************************/
+	virtual uint64_t GetDroppedRecordsCount() const = 0;
+};
+
+
+#endif // !MARSTECH_ILOGSHIPPER_H
+
+/** @} */	//End of group MSYS.
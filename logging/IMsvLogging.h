@@ -35,16 +35,43 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 #define MARSTECH_ILOGGING_SYS_H
 
 
+#include "IMsvAsyncLoggerProvider.h"
+#include "IMsvBinaryLogger.h"
+#include "IMsvFlightRecorder.h"
+#include "IMsvLogContext.h"
+#include "IMsvLogLevelBinding.h"
+#include "IMsvLogShipper.h"
+#include "MsvLogMacros.h"
+#include "MsvStructuredLog.h"
+
+#include "mconfig/mactivecfg/IMsvActiveConfig.h"
 #include "mlogging/mlogging.h"
 
 #include "merror/MsvError.h"
 MSV_DISABLE_ALL_WARNINGS
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 
 MSV_ENABLE_WARNINGS
 
 
+/**************************************************************************************************//**
+* @brief		Logger handle.
+* @details	Stable handle of logger returned by @ref IMsvLogging::GetLoggerHandle. It is resolved to logger
+*				by @ref IMsvLogging::GetLoggerByHandle without name lookup and without locking.
+******************************************************************************************************/
+typedef uint32_t MsvLoggerHandle;
+
+/**************************************************************************************************//**
+* @brief		Maximum logger handles.
+* @details	Maximum number of logger handles (loggers with handle) in one @ref IMsvLogging.
+******************************************************************************************************/
+#define MSV_LOGGER_HANDLES_MAX 1024
+
+
 /**************************************************************************************************//**
 * @brief		MarsTech Logging Interface.
 * @details	Logging interface for easy access to logging interfaces and its implementations.
@@ -96,6 +123,32 @@ public:
 	******************************************************************************************************/
 	virtual MsvErrorCode GetLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles) const = 0;
 
+	/**************************************************************************************************//**
+	* @brief			Get logger handle.
+	* @details		Resolves logger name to stable handle (creates new logger if new loggerName was received).
+	*					Each call with same loggerName returns same handle. It should be called once (at initialization)
+	*					and handle should be used by @ref GetLoggerByHandle then.
+	* @param[out]	handle					Logger handle.
+	* @param[in]	loggerName				Logger name which will be printed to log file.
+	* @retval		MSV_DOES_NOT_EXIST_ERROR	When @ref GetLoggerProvider and @ref SetLoggerProvider method was not called before.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed or all @ref MSV_LOGGER_HANDLES_MAX handles are used.
+	* @retval		MSV_SUCCESS						On success.
+	* @see			GetLoggerByHandle
+	******************************************************************************************************/
+	virtual MsvErrorCode GetLoggerHandle(MsvLoggerHandle& handle, const char* loggerName = "MsvLogger") const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get logger by handle.
+	* @details		Returns logger for logging. Handle is resolved in constant time without locking (and without
+	*					name lookup).
+	* @param[out]	spLogger					Shared pointer to logger implementation @ref MsvLogger.
+	* @param[in]	handle					Logger handle returned by @ref GetLoggerHandle.
+	* @retval		MSV_INVALID_DATA_ERROR		When handle is invalid.
+	* @retval		MSV_SUCCESS						On success.
+	* @see			GetLoggerHandle
+	******************************************************************************************************/
+	virtual MsvErrorCode GetLoggerByHandle(std::shared_ptr<MsvLogger>& spLogger, MsvLoggerHandle handle) const = 0;
+
 	/**************************************************************************************************//**
 	* @brief			Get logger provider interface.
 	* @details		Returns logger provider interface with get methods for logger.
@@ -118,6 +171,28 @@ public:
 	* @see			IMsvLoggerProvider
 	******************************************************************************************************/
 	virtual MsvErrorCode GetLoggerProvider(std::shared_ptr<IMsvLoggerProvider>& spLoggerProvider, const char* logFolder = "", const char* logFile = "msvlog.txt", int maxLogFileSize = 10485760, int maxLogFiles = 3) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get async logger provider interface.
+	* @details		Returns async logger provider interface. Loggers of this provider just push log records to
+	*					lock-free queue and one background thread writes them to log files.
+	*					Each call of this method returns same interface (same shared pointer).
+	* @param[out]	spLoggerProvider		Shared pointer to async logger interface @ref IMsvAsyncLoggerProvider.
+	* @param[in]	logFolder				Path to log folder where log files will be stored.
+	* @param[in]	logFile					Log file name.
+	* @param[in]	maxLogFileSize			Maximum size of one log file (in bytes).
+	* @param[in]	maxLogFiles				Maximum number of log files (rotating logger, the oldest file will be deleted).
+	* @param[in]	queueSize				Log queue capacity (number of records, rounded up to power of two).
+	* @param[in]	overflowPolicy			Behaviour of log call when queue is full.
+	* @retval		MSV_ALREADY_EXISTS_ERROR	When synchronous logger provider has been already created or set.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Async logger provider is used as shared logger provider (it is returned by @ref GetLoggerProvider too).
+	* @note			In parameters are used only when the method is called first. They are ignored
+	*					next time.
+	* @see			IMsvAsyncLoggerProvider
+	******************************************************************************************************/
+	virtual MsvErrorCode GetAsyncLoggerProvider(std::shared_ptr<IMsvAsyncLoggerProvider>& spLoggerProvider, const char* logFolder = "", const char* logFile = "msvlog.txt", int maxLogFileSize = 10485760, int maxLogFiles = 3, size_t queueSize = 8192, MsvLogOverflowPolicy overflowPolicy = MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_BLOCK) const = 0;
 	
 	/**************************************************************************************************//**
 	* @brief			Set logger provider.
@@ -129,13 +204,112 @@ public:
 	* @warning		This method should be called only once at the application start (in main function/class).
 	* @warning		This method is usefull when using @ref IMsvSys loaded from dynamic/shared library. There
 	*					is no reason to use it when using statically linked @ref IMsvSys.
+	* @note			Loggers of custom provider can not be attached to flight recorder and log shipper (they have
+	*					no forwarding sink).
 	* @see			IMsvLoggerProvider
 	******************************************************************************************************/
 	virtual MsvErrorCode SetLoggerProvider(std::shared_ptr<IMsvLoggerProvider> spLoggerProvider) = 0;
 
+	/**************************************************************************************************//**
+	* @brief			Get binary logger.
+	* @details		Returns binary logger (deferred formatting). Creates new logger if new loggerName was received.
+	*					Returns already created logger and in parameters are ignored other way.
+	*					Log records contain just call site ID, timestamp, thread ID and raw arguments. They are
+	*					written in background thread and decoded to text by msysBlogDecoder tool.
+	* @param[out]	spLogger					Shared pointer to binary logger interface @ref IMsvBinaryLogger.
+	* @param[in]	loggerName				Logger name which will be printed by decoder.
+	* @param[in]	logFile					Binary log file path.
+	* @param[in]	maxLogFileSize			Maximum size of one log file (in bytes).
+	* @param[in]	maxLogFiles				Maximum number of log files (rotating logger, the oldest file will be deleted).
+	* @retval		MSV_INVALID_DATA_ERROR		When log file could not be opened.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			It does not depend on logger provider.
+	* @note			Use MSV_BLOG_* macros (@ref MsvBinaryLog.h) for logging.
+	* @see			IMsvBinaryLogger
+	******************************************************************************************************/
+	virtual MsvErrorCode GetBinaryLogger(std::shared_ptr<IMsvBinaryLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize = 10485760, int maxLogFiles = 3) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get structured logger.
+	* @details		Returns logger (from logger provider) which writes JSON lines to its own log file. Use
+	*					MSV_SLOG_* macros (@ref MsvStructuredLog.h) to log messages with typed key-value fields.
+	*					Other log calls are written as JSON lines with escaped message.
+	* @param[out]	spLogger					Shared pointer to logger.
+	* @param[in]	loggerName				Logger name.
+	* @param[in]	logFile					Log file (JSON lines).
+	* @param[in]	maxLogFileSize			Maximum size of one log file (in bytes).
+	* @param[in]	maxLogFiles				Maximum number of log files (rotating logger, the oldest file will be deleted).
+	* @retval		MSV_DOES_NOT_EXIST_ERROR	When logger provider does not exist or it has been set by
+	*														@ref SetLoggerProvider (custom provider).
+	* @retval		MSV_ALREADY_EXISTS_ERROR	When logger with this name has been already created by logger
+	*														provider (as text logger).
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @see			MsvJsonLinesFormatter
+	******************************************************************************************************/
+	virtual MsvErrorCode GetStructuredLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize = 10485760, int maxLogFiles = 3) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get flight recorder.
+	* @details		Returns shared flight recorder. Creates it when it does not exist yet (parameters are
+	*					ignored other way). Records of attached loggers are written to ring in memory mapped file
+	*					which survives process crash. Last records are extracted by msysFlightDump tool.
+	* @param[out]	spFlightRecorder			Shared pointer to flight recorder interface @ref IMsvFlightRecorder.
+	* @param[in]	recorderFile				Flight recorder file path (previous file is renamed to "<file>.prev").
+	* @param[in]	recordsCount				Number of records kept in recorder (each record takes 256 bytes).
+	* @retval		MSV_INVALID_DATA_ERROR		When recorder file could not be created or mapped.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			It does not depend on logger provider.
+	* @see			IMsvFlightRecorder
+	******************************************************************************************************/
+	virtual MsvErrorCode GetFlightRecorder(std::shared_ptr<IMsvFlightRecorder>& spFlightRecorder, const char* recorderFile = "msvflight.rec", uint32_t recordsCount = 65536) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get log shipper.
+	* @details		Returns shared log shipper. Creates it when it does not exist yet (parameters are ignored
+	*					other way). Records of attached loggers are streamed in batches to local collector daemon
+	*					over UNIX domain socket (length prefixed records), so collector does not have to tail log
+	*					files. Records which can not be sent are appended to spill file and they are sent before new
+	*					records when collector is connected again.
+	* @param[out]	spLogShipper				Shared pointer to log shipper interface @ref IMsvLogShipper.
+	* @param[in]	socketPath					Path of collector UNIX domain socket.
+	* @param[in]	spillFile					Spill file path (records are appended when collector is not connected or it is slow).
+	* @param[in]	bufferSize					Maximum size of buffered records (in bytes, records are dropped when it is full).
+	* @param[in]	batchSize					Size of buffered records which are sent at once (in bytes).
+	* @param[in]	maxSpillSize				Maximum size of spill file (in bytes, 0 means unlimited). Records which
+	*													do not fit are dropped.
+	* @retval		MSV_INVALID_DATA_ERROR		When socket path is too long or buffer size is zero.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			It does not depend on logger provider. Collector does not have to run (shipper reconnects
+	*					in background).
+	* @see			IMsvLogShipper
+	******************************************************************************************************/
+	virtual MsvErrorCode GetLogShipper(std::shared_ptr<IMsvLogShipper>& spLogShipper, const char* socketPath = "msvlog.sock", const char* spillFile = "msvlogspill.bin", size_t bufferSize = 4194304, size_t batchSize = 65536, uint64_t maxSpillSize = 67108864) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get log level binding.
+	* @details		Creates new log level binding which binds log levels of loggers to keys of active config.
+	*					Changed values are applied by background thread with refresh period. Loggers keep their
+	*					level in atomic word which is read by relaxed load, so level change does not lock logging.
+	* @param[out]	spLogLevelBinding			Shared pointer to log level binding interface @ref IMsvLogLevelBinding.
+	* @param[in]	spActiveConfig				Active config with log level keys (int32 values of @ref MsvLogLevel).
+	* @param[in]	refreshPeriod				Refresh period (in milliseconds).
+	* @retval		MSV_INVALID_DATA_ERROR		When active config is empty or refresh period is zero.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @warning		Binding must be released (or @ref IMsvLogLevelBinding::UnbindAll must be called) before
+	*					active config is uninitialized (and before this interface is released).
+	* @see			IMsvLogLevelBinding
+	******************************************************************************************************/
+	virtual MsvErrorCode GetLogLevelBinding(std::shared_ptr<IMsvLogLevelBinding>& spLogLevelBinding, std::shared_ptr<IMsvActiveConfig> spActiveConfig, uint32_t refreshPeriod = 1000) const = 0;
+
 	/**************************************************************************************************//**
 	* @brief			Set log level.
-	* @details		Sets log level for logging to all loggers. Default level is INFO.
+	* @details		Sets log level for logging to all loggers. Default level is INFO. Log level is set to logger
+	*					sinks (log files), logger level might be lower when logger is attached to flight recorder.
 	* @param[in]	logLevel			Log level to set.
 	* @note			Default log level is set to info. It is not necessary to call this method when INFO log level
 	*					is required.
@@ -145,9 +319,111 @@ public:
 	* @see			IMsvLoggerProvider
 	******************************************************************************************************/
 	virtual MsvErrorCode SetLogLevel(MsvLogLevel logLevel) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Set log categories.
+	* @details		Sets global mask of enabled log categories (@ref GetLogCategoriesMask). Categorized log calls
+	*					(MSV_LOG_CAT_* macros) of enabled categories are written even when their level is disabled,
+	*					so verbose output of selected subsystems does not require raising level of whole logger.
+	* @param[in]	categories			Bit mask of enabled categories (MSV_LOG_CAT_NONE by default).
+	* @note			It might be called at any time (without logger provider). Mask is atomic word which is
+	*					read by relaxed load before arguments of log call are evaluated.
+	* @see			MSV_LOG_CAT
+	******************************************************************************************************/
+	virtual void SetLogCategories(uint32_t categories) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get log categories.
+	* @details		Returns global mask of enabled log categories.
+	* @returns		uint32_t
+	* @see			SetLogCategories
+	******************************************************************************************************/
+	virtual uint32_t GetLogCategories() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get log categories mask.
+	* @details		Returns address of global mask of enabled log categories. There is only one mask (owned by
+	*					this interface) for all binaries, log calls of each binary (EXE or DLL) read it by cached
+	*					address (see @ref MsvLogCategoryBind and @ref MsvLogBind).
+	* @returns		const std::atomic<uint32_t>*
+	* @note			Address is valid until this interface is released.
+	* @see			SetLogCategories
+	******************************************************************************************************/
+	virtual const std::atomic<uint32_t>* GetLogCategoriesMask() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get log context.
+	* @details		Returns log context interface. Thread local log context lives in msys library only, log
+	*					context scopes of each binary (EXE or DLL) change it through this interface (see
+	*					@ref MsvLogContextBind and @ref MsvLogBind).
+	* @returns		IMsvLogContext*
+	* @note			Interface is valid until this interface is released.
+	* @see			MSV_LOG_CONTEXT
+	******************************************************************************************************/
+	virtual IMsvLogContext* GetLogContext() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get log rate limit registry.
+	* @details		Returns registry of rate limited log call sites which writes counts of suppressed calls of
+	*					sites which stopped logging. Rate limited log calls of each binary (EXE or DLL) register their
+	*					sites to it (see @ref MsvLogRateLimitBind and @ref MsvLogBind).
+	* @returns		IMsvLogRateLimitRegistry*
+	* @note			Registry is valid until this interface is released.
+	* @see			MSV_LOG_RATE_LIMITED
+	******************************************************************************************************/
+	virtual IMsvLogRateLimitRegistry* GetLogRateLimitRegistry() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Subscribe.
+	* @details		Registers subscriber which receives structured records (@ref MsvLogEvent) of loggers
+	*					matching level and logger filter. Records are delivered asynchronously by background
+	*					thread of async logger provider, so diagnostic modules might count or inspect log events
+	*					without reading log files. There is no cost when there is no subscriber.
+	* @param[out]	subscriptionId					Subscription ID (it is passed to @ref Unsubscribe).
+	* @param[in]	subscriber						Subscriber (it should return quickly).
+	* @param[in]	minLevel							Minimum log level of delivered records.
+	* @param[in]	loggerName						Logger name of delivered records (nullptr for all loggers).
+	* @retval		MSV_DOES_NOT_EXIST_ERROR	When async logger provider does not exist.
+	* @retval		MSV_INVALID_DATA_ERROR		When subscriber is empty.
+	* @retval		MSV_SUCCESS						On success.
+	* @warning		Method @ref GetAsyncLoggerProvider must be called before (synchronous logger providers do not
+	*					have background thread).
+	* @see			IMsvAsyncLoggerProvider::Subscribe
+	******************************************************************************************************/
+	virtual MsvErrorCode Subscribe(uint32_t& subscriptionId, MsvLogSubscriber subscriber, MsvLogLevel minLevel = MsvLogLevel::trace, const char* loggerName = nullptr) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Unsubscribe.
+	* @details		Removes subscription. Subscriber is not called after this method returns.
+	* @param[in]	subscriptionId					Subscription ID.
+	* @retval		MSV_DOES_NOT_EXIST_ERROR	When async logger provider does not exist.
+	* @retval		MSV_NOT_FOUND_ERROR			When subscription does not exist.
+	* @retval		MSV_SUCCESS						On success.
+	* @warning		It must not be called by subscriber.
+	******************************************************************************************************/
+	virtual MsvErrorCode Unsubscribe(uint32_t subscriptionId) = 0;
 };
 
 
+/**************************************************************************************************//**
+* @brief			Bind logging.
+* @details		Binds log calls of calling binary (EXE or DLL) to global state of logging interface. Header
+*					helpers are compiled into each binary, so each binary caches addresses of state which is
+*					owned by logging interface (see @ref MsvLogCategoryBind, @ref MsvLogContextBind and
+*					@ref MsvLogRateLimitBind).
+* @param[in]	spLogging					Logging interface (nullptr unbinds calling binary).
+* @note			Logging interface binds its own binary. Other binaries bind themselves after they get logging
+*					interface.
+* @warning		Binary must be unbound before logging interface is released.
+******************************************************************************************************/
+inline void MsvLogBind(const std::shared_ptr<IMsvLogging>& spLogging)
+{
+	MsvLogCategoryBind(spLogging ? spLogging->GetLogCategoriesMask() : nullptr);
+	MsvLogContextBind(spLogging ? spLogging->GetLogContext() : nullptr);
+	MsvLogRateLimitBind(spLogging ? spLogging->GetLogRateLimitRegistry() : nullptr);
+}
+
+
 #endif // !MARSTECH_ILOGGING_SYS_H
 
 /** @} */	//End of group MSYS.
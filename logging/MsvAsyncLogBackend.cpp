@@ -0,0 +1,940 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Async Log Backend
+* @details		Contains implementation of async log backend.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvAsyncLogBackend.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <set>
+#include <utility>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Static variables
+********************************************************************************************************************************/
+
+
+/**************************************************************************************************//**
+* @brief		Backend IDs.
+* @details	Last assigned backend ID (IDs are not reused, so thread buffer of destroyed backend is never found
+*				by new backend with same address).
+******************************************************************************************************/
+static std::atomic<uint64_t> s_backendIds(0);
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Thread Buffer Reference.
+* @details	Thread buffer of one backend kept in thread local storage of logging thread.
+******************************************************************************************************/
+struct MsvLogThreadBufferRef
+{
+	uint64_t backendId;										///< Backend ID.
+	std::shared_ptr<MsvLogRingBuffer> spBuffer;		///< Thread buffer.
+};
+
+
+/**************************************************************************************************//**
+* @brief			Hash record.
+* @details		Computes FNV-1a hash of log level and payload.
+* @param[in]	level									Log level.
+* @param[in]	payload								Payload.
+* @returns		uint64_t
+******************************************************************************************************/
+static uint64_t HashRecord(MsvLogLevel level, spdlog::string_view_t payload)
+{
+	uint64_t hash = 14695981039346656037ULL ^ static_cast<uint64_t>(level);
+
+	for (size_t i = 0; i < payload.size(); ++i)
+	{
+		hash = (hash ^ static_cast<unsigned char>(payload.data()[i])) * 1099511628211ULL;
+	}
+
+	return hash;
+}
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvAsyncLogBackend::MsvAsyncLogBackend(size_t queueSize, MsvLogOverflowPolicy overflowPolicy, uint32_t flushInterval, std::shared_ptr<MsvTimestamp> spTimestamp):
+	m_queue(queueSize),
+	m_overflowPolicy(overflowPolicy),
+	m_flushInterval(flushInterval),
+	m_lastFormatterSwapId(0),
+	m_running(false),
+	m_stop(false),
+	m_flushRequests(0),
+	m_flushesDone(0),
+	m_unflushed(false),
+	m_flushNow(false),
+	m_droppedRecords(0),
+	m_reportedDroppedRecords(0),
+	m_backendId(++s_backendIds),
+	m_perThreadBuffers(false),
+	m_threadBufferSize(0),
+	m_mergeWindow(0),
+	m_threadBuffersVersion(0),
+	m_mergeSourcesVersion(0),
+	m_dedupWindow(0),
+	m_repeatedRecords(false),
+	m_subscribed(false),
+	m_lastSubscriptionId(0),
+	m_spTimestamp(spTimestamp ? spTimestamp : std::shared_ptr<MsvTimestamp>(new (std::nothrow) MsvTimestamp()))
+{
+
+}
+
+
+MsvAsyncLogBackend::~MsvAsyncLogBackend()
+{
+	Stop();
+}
+
+
+/********************************************************************************************************************************
+*															MsvAsyncLogBackend public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvAsyncLogBackend::Start()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_running)
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	if (!m_spTimestamp)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	//shared timestamp is already initialized
+	MSV_RETURN_FAILED(m_spTimestamp->Initialize());
+	MSV_RETURN_FAILED(m_queue.Initialize());
+
+	m_stop = false;
+	m_running = true;
+	m_thread = std::thread(&MsvAsyncLogBackend::BackendThread, this);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvAsyncLogBackend::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (!m_running)
+		{
+			return MSV_NOT_RUNNING_INFO;
+		}
+
+		//new records are dropped, queued records are written by background thread
+		m_running = false;
+		m_stop = true;
+	}
+
+	m_condition.notify_all();
+	m_thread.join();
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvAsyncLogBackend::AddTarget(uint32_t& targetId, const std::string& loggerName, const std::vector<spdlog::sink_ptr>& sinks)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	m_targets.push_back(MsvAsyncLogTarget{loggerName, sinks, MsvLogDedupState()});
+	targetId = static_cast<uint32_t>(m_targets.size() - 1);
+
+	return MSV_SUCCESS;
+}
+
+bool MsvAsyncLogBackend::Push(uint32_t targetId, uint64_t ticks, const spdlog::details::log_msg& msg)
+{
+	if (!m_running.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	return PushRecord(targetId, ticks, msg.thread_id, msg.level, msg.payload, MsvLogContext::Acquire());
+}
+
+bool MsvAsyncLogBackend::Push(uint32_t targetId, MsvLogLevel logLevel, const char* pPayload, size_t payloadSize)
+{
+	if (!m_running.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	//raw payload (binary records) is written as it is -> log context is not captured
+	return PushRecord(targetId, MsvTimestamp::ReadTicks(), spdlog::details::os::thread_id(), logLevel, spdlog::string_view_t(pPayload, payloadSize), nullptr);
+}
+
+MsvErrorCode MsvAsyncLogBackend::Flush()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	if (!m_running)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	uint64_t flushRequest = ++m_flushRequests;
+	m_condition.notify_all();
+	m_condition.wait(lock, [this, flushRequest] { return m_flushesDone >= flushRequest || m_stop; });
+
+	return MSV_SUCCESS;
+}
+
+uint64_t MsvAsyncLogBackend::GetDroppedRecordsCount() const
+{
+	return m_droppedRecords.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<MsvTimestamp> MsvAsyncLogBackend::GetTimestamp() const
+{
+	return m_spTimestamp;
+}
+
+MsvErrorCode MsvAsyncLogBackend::SetFormatter(uint32_t targetId, const spdlog::formatter& formatter)
+{
+	std::shared_ptr<spdlog::formatter> spFormatter(formatter.clone());
+	if (!spFormatter)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	uint64_t swapId = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (targetId >= m_targets.size())
+		{
+			return MSV_NOT_FOUND_ERROR;
+		}
+
+		if (!m_running && !m_stop)
+		{
+			//background thread has not been started -> sinks are not used
+			for (spdlog::sink_ptr& spSink: m_targets[targetId].sinks)
+			{
+				spSink->set_formatter(spFormatter->clone());
+			}
+
+			return MSV_SUCCESS;
+		}
+
+		swapId = ++m_lastFormatterSwapId;
+		m_formatterSwaps[swapId] = MsvLogFormatterSwap{targetId, m_running.load(), spFormatter};
+	}
+
+	//control record keeps order of swap and records of logging threads
+	if (!PushRecord(targetId, MsvTimestamp::ReadTicks(), spdlog::details::os::thread_id(), spdlog::level::off, spdlog::string_view_t(reinterpret_cast<const char*>(&swapId), sizeof(swapId)), nullptr))
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		std::map<uint64_t, MsvLogFormatterSwap>::iterator swap = m_formatterSwaps.find(swapId);
+		if (swap != m_formatterSwaps.end())
+		{
+			swap->second.queued = false;
+		}
+	}
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvAsyncLogBackend::EnablePerThreadBuffers(uint32_t maxStaleness, size_t threadBufferSize)
+{
+	if (maxStaleness < 2 || threadBufferSize == 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_perThreadBuffers)
+	{
+		return MSV_ALREADY_INITIALIZED_INFO;
+	}
+
+	m_threadBufferSize = threadBufferSize;
+	m_mergeWindow = maxStaleness / 2;
+	m_flushInterval = (std::min)(m_flushInterval, maxStaleness - m_mergeWindow);
+	m_perThreadBuffers = true;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvAsyncLogBackend::EnableDeduplication(uint32_t window)
+{
+	m_dedupWindow.store(window, std::memory_order_relaxed);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvAsyncLogBackend::AddSubscriber(uint32_t& subscriptionId, MsvLogSubscriber subscriber, MsvLogLevel minLevel, const std::string& loggerName)
+{
+	if (!subscriber)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::lock_guard<std::mutex> lock(m_subscriptionsLock);
+
+	subscriptionId = ++m_lastSubscriptionId;
+	m_subscriptions.push_back(MsvLogSubscription{subscriptionId, subscriber, minLevel, loggerName});
+	m_subscribed.store(true, std::memory_order_relaxed);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvAsyncLogBackend::RemoveSubscriber(uint32_t subscriptionId)
+{
+	//background thread holds lock while subscribers are called
+	std::lock_guard<std::mutex> lock(m_subscriptionsLock);
+
+	std::vector<MsvLogSubscription>::iterator it = std::find_if(m_subscriptions.begin(), m_subscriptions.end(), [subscriptionId](const MsvLogSubscription& subscription) { return subscription.subscriptionId == subscriptionId; });
+	if (it == m_subscriptions.end())
+	{
+		return MSV_NOT_FOUND_ERROR;
+	}
+
+	m_subscriptions.erase(it);
+	m_subscribed.store(!m_subscriptions.empty(), std::memory_order_relaxed);
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvAsyncLogBackend protected methods
+********************************************************************************************************************************/
+
+
+void MsvAsyncLogBackend::BackendThread()
+{
+	std::chrono::steady_clock::time_point lastFlush = std::chrono::steady_clock::now();
+
+	while (true)
+	{
+		size_t writtenRecords = WriteRecords();
+		WriteRepeatedSummaries(false);
+		WriteDroppedSummary();
+		ApplyFormatterSwaps(0);
+
+		std::unique_lock<std::mutex> lock(m_lock);
+		UpdateMergeSources();
+
+		uint64_t flushRequests = m_flushRequests;
+		if (flushRequests != m_flushesDone)
+		{
+			//records pushed before flush request are in queue now
+			lock.unlock();
+			WriteRecords(true);
+			WriteRepeatedSummaries(true);
+			FlushSinks();
+			lastFlush = std::chrono::steady_clock::now();
+			lock.lock();
+
+			m_flushesDone = flushRequests;
+			m_condition.notify_all();
+			continue;
+		}
+
+		if (m_stop)
+		{
+			lock.unlock();
+			WriteRecords(true);
+			lock.lock();
+
+			if (m_queue.IsEmpty() && !HasPendingRecords())
+			{
+				break;
+			}
+		}
+
+		if (m_flushNow || (m_unflushed && std::chrono::steady_clock::now() - lastFlush >= std::chrono::milliseconds(m_flushInterval)))
+		{
+			lock.unlock();
+			FlushSinks();
+			lastFlush = std::chrono::steady_clock::now();
+			continue;
+		}
+
+		if (writtenRecords == 0)
+		{
+			//log calls do not notify (it would cost syscall) -> poll queue
+			m_condition.wait_for(lock, std::chrono::milliseconds(1));
+		}
+	}
+
+	WriteRepeatedSummaries(true);
+	WriteDroppedSummary();
+	FlushSinks();
+	ApplyFormatterSwaps(0);
+
+	std::lock_guard<std::mutex> lock(m_lock);
+	m_condition.notify_all();
+}
+
+MsvLogRingBuffer* MsvAsyncLogBackend::GetThreadBuffer()
+{
+	thread_local std::vector<MsvLogThreadBufferRef> threadBuffers;
+
+	for (MsvLogThreadBufferRef& threadBuffer: threadBuffers)
+	{
+		if (threadBuffer.backendId == m_backendId)
+		{
+			return threadBuffer.spBuffer.get();
+		}
+	}
+
+	//first log call of thread -> release buffers of destroyed backends and create new buffer
+	threadBuffers.erase(std::remove_if(threadBuffers.begin(), threadBuffers.end(), [](const MsvLogThreadBufferRef& threadBuffer) { return threadBuffer.spBuffer.use_count() == 1; }), threadBuffers.end());
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	std::shared_ptr<MsvLogRingBuffer> spBuffer(new (std::nothrow) MsvLogRingBuffer(m_threadBufferSize));
+	if (!spBuffer || MSV_FAILED(spBuffer->Initialize()))
+	{
+		return nullptr;
+	}
+
+	m_threadBuffers.push_back(spBuffer);
+	++m_threadBuffersVersion;
+	threadBuffers.push_back(MsvLogThreadBufferRef{m_backendId, spBuffer});
+
+	return spBuffer.get();
+}
+
+bool MsvAsyncLogBackend::PushRecord(uint32_t targetId, uint64_t ticks, size_t threadId, MsvLogLevel logLevel, spdlog::string_view_t payload, MsvLogContextData* pContext)
+{
+	MsvLogRingBuffer* pQueue = &m_queue;
+	if (m_perThreadBuffers.load(std::memory_order_relaxed))
+	{
+		//shared queue is used when thread buffer could not be created
+		MsvLogRingBuffer* pThreadBuffer = GetThreadBuffer();
+		if (pThreadBuffer)
+		{
+			pQueue = pThreadBuffer;
+		}
+	}
+
+	MsvLogRingSlot* pSlot = pQueue->BeginPush();
+
+	while (!pSlot)
+	{
+		if (m_overflowPolicy == MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_DROP_AND_COUNT)
+		{
+			m_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+			MsvLogContext::Release(pContext);
+			return false;
+		}
+
+		if (m_overflowPolicy == MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_DROP || !m_running.load(std::memory_order_relaxed))
+		{
+			MsvLogContext::Release(pContext);
+			return false;
+		}
+
+		//block -> wait for background thread
+		std::this_thread::yield();
+		pSlot = pQueue->BeginPush();
+	}
+
+	MsvLogRecord& record = pSlot->record;
+	record.ticks = ticks;
+	record.threadId = threadId;
+	record.targetId = targetId;
+	record.level = logLevel;
+	record.payloadSize = static_cast<uint32_t>(payload.size());
+	record.pLongPayload = nullptr;
+	record.pContext = pContext;
+
+	if (payload.size() <= MSV_LOG_RECORD_PAYLOAD_SIZE)
+	{
+		std::memcpy(record.payload, payload.data(), payload.size());
+	}
+	else
+	{
+		record.pLongPayload = new (std::nothrow) char[payload.size()];
+		if (record.pLongPayload)
+		{
+			std::memcpy(record.pLongPayload, payload.data(), payload.size());
+		}
+		else
+		{
+			//allocation failed -> truncate payload
+			record.payloadSize = MSV_LOG_RECORD_PAYLOAD_SIZE;
+			std::memcpy(record.payload, payload.data(), MSV_LOG_RECORD_PAYLOAD_SIZE);
+		}
+	}
+
+	pQueue->EndPush(pSlot);
+
+	return true;
+}
+
+size_t MsvAsyncLogBackend::WriteRecords(bool writeAll)
+{
+	if (!m_mergeSources.empty())
+	{
+		return MergeRecords(writeAll);
+	}
+
+	size_t writtenRecords = 0;
+
+	while (MsvLogRingSlot* pSlot = m_queue.BeginPop())
+	{
+		WriteRecord(pSlot->record);
+
+		delete[] pSlot->record.pLongPayload;
+		pSlot->record.pLongPayload = nullptr;
+		MsvLogContext::Release(pSlot->record.pContext);
+		pSlot->record.pContext = nullptr;
+
+		m_queue.EndPop(pSlot);
+		++writtenRecords;
+	}
+
+	return writtenRecords;
+}
+
+void MsvAsyncLogBackend::UpdateMergeSources()
+{
+	if (!m_perThreadBuffers)
+	{
+		return;
+	}
+
+	if (m_mergeSources.empty())
+	{
+		//shared queue is merged too (records pushed before per-thread buffers have been enabled)
+		m_mergeSources.push_back(MsvLogMergeSource{nullptr, std::deque<MsvLogRecord>()});
+	}
+
+	if (m_mergeSourcesVersion != m_threadBuffersVersion)
+	{
+		for (std::shared_ptr<MsvLogRingBuffer>& spBuffer: m_threadBuffers)
+		{
+			if (std::none_of(m_mergeSources.begin(), m_mergeSources.end(), [&spBuffer](const MsvLogMergeSource& source) { return source.spBuffer == spBuffer; }))
+			{
+				m_mergeSources.push_back(MsvLogMergeSource{spBuffer, std::deque<MsvLogRecord>()});
+			}
+		}
+
+		m_mergeSourcesVersion = m_threadBuffersVersion;
+	}
+
+	//thread buffer is referenced by thread buffers and merge source only -> thread has finished
+	for (size_t i = 1; i < m_mergeSources.size();)
+	{
+		MsvLogMergeSource& source = m_mergeSources[i];
+		if (source.spBuffer.use_count() == 2 && source.records.empty() && source.spBuffer->IsEmpty())
+		{
+			m_threadBuffers.erase(std::find(m_threadBuffers.begin(), m_threadBuffers.end(), source.spBuffer));
+			m_mergeSources.erase(m_mergeSources.begin() + static_cast<std::ptrdiff_t>(i));
+		}
+		else
+		{
+			++i;
+		}
+	}
+}
+
+size_t MsvAsyncLogBackend::MergeRecords(bool writeAll)
+{
+	typedef std::pair<uint64_t, size_t> MsvMergeHead;
+
+	std::vector<MsvMergeHead> heads;
+	heads.reserve(m_mergeSources.size());
+
+	for (size_t i = 0; i < m_mergeSources.size(); ++i)
+	{
+		MsvLogMergeSource& source = m_mergeSources[i];
+		MsvLogRingBuffer& queue = source.spBuffer ? *source.spBuffer : m_queue;
+
+		while (MsvLogRingSlot* pSlot = queue.BeginPop())
+		{
+			//payload and context are owned by merge window now
+			source.records.push_back(pSlot->record);
+			pSlot->record.pLongPayload = nullptr;
+			pSlot->record.pContext = nullptr;
+			queue.EndPop(pSlot);
+		}
+
+		if (!source.records.empty())
+		{
+			heads.push_back(MsvMergeHead(source.records.front().ticks, i));
+		}
+	}
+
+	std::make_heap(heads.begin(), heads.end(), std::greater<MsvMergeHead>());
+
+	uint64_t windowStart = MsvTimestamp::ReadTicks() - m_spTimestamp->GetTicksFrequency() / 1000 * m_mergeWindow;
+	size_t writtenRecords = 0;
+
+	while (!heads.empty() && (writeAll || heads.front().first <= windowStart))
+	{
+		std::pop_heap(heads.begin(), heads.end(), std::greater<MsvMergeHead>());
+		std::deque<MsvLogRecord>& records = m_mergeSources[heads.back().second].records;
+
+		WriteRecord(records.front());
+		delete[] records.front().pLongPayload;
+		MsvLogContext::Release(records.front().pContext);
+		records.pop_front();
+		++writtenRecords;
+
+		if (records.empty())
+		{
+			heads.pop_back();
+		}
+		else
+		{
+			heads.back().first = records.front().ticks;
+			std::push_heap(heads.begin(), heads.end(), std::greater<MsvMergeHead>());
+		}
+	}
+
+	return writtenRecords;
+}
+
+bool MsvAsyncLogBackend::HasPendingRecords() const
+{
+	for (const MsvLogMergeSource& source: m_mergeSources)
+	{
+		if (!source.records.empty() || (source.spBuffer && !source.spBuffer->IsEmpty()))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void MsvAsyncLogBackend::WriteRecord(const MsvLogRecord& record)
+{
+	MsvAsyncLogTarget* pTarget = GetTarget(record.targetId);
+	if (!pTarget)
+	{
+		return;
+	}
+
+	spdlog::string_view_t payload(record.pLongPayload ? record.pLongPayload : record.payload, record.payloadSize);
+
+	if (record.level == spdlog::level::off)
+	{
+		//control record of formatter swap (it is not written)
+		uint64_t swapId = 0;
+		if (payload.size() == sizeof(swapId))
+		{
+			std::memcpy(&swapId, payload.data(), sizeof(swapId));
+			ApplyFormatterSwaps(swapId);
+		}
+
+		return;
+	}
+
+	if (record.pContext)
+	{
+		//log context is serialized here (log call has just captured its pointer)
+		m_contextPayload.assign(payload.data(), payload.size());
+		MsvLogContext::Format(record.pContext, m_contextPayload);
+		payload = spdlog::string_view_t(m_contextPayload.data(), m_contextPayload.size());
+	}
+
+	if (m_subscribed.load(std::memory_order_relaxed))
+	{
+		NotifySubscribers(*pTarget, record, payload);
+	}
+
+	uint32_t dedupWindow = m_dedupWindow.load(std::memory_order_relaxed);
+	if (dedupWindow && DeduplicateRecord(*pTarget, record, payload, m_spTimestamp->GetTicksFrequency() / 1000 * dedupWindow))
+	{
+		return;
+	}
+
+	spdlog::details::log_msg msg(m_spTimestamp->TicksToTime(record.ticks), spdlog::source_loc{}, pTarget->loggerName, record.level, payload);
+	msg.thread_id = record.threadId;
+
+	for (spdlog::sink_ptr& spSink: pTarget->sinks)
+	{
+		if (spSink->should_log(record.level))
+		{
+			spSink->log(msg);
+		}
+	}
+
+	m_unflushed = true;
+	if (record.level >= spdlog::level::err)
+	{
+		m_flushNow = true;
+	}
+}
+
+bool MsvAsyncLogBackend::DeduplicateRecord(MsvAsyncLogTarget& target, const MsvLogRecord& record, spdlog::string_view_t payload, uint64_t windowTicks)
+{
+	MsvLogDedupState& dedup = target.dedup;
+	uint64_t hash = HashRecord(record.level, payload);
+
+	//hash is compared first, payload comparison just excludes collisions
+	if (dedup.valid && dedup.hash == hash && dedup.level == record.level && record.ticks < dedup.windowStart + windowTicks
+		&& dedup.payload.size() == payload.size() && std::memcmp(dedup.payload.data(), payload.data(), payload.size()) == 0)
+	{
+		dedup.lastTicks = record.ticks;
+		dedup.threadId = record.threadId;
+		++dedup.repeatedCount;
+		m_repeatedRecords = true;
+
+		return true;
+	}
+
+	if (dedup.repeatedCount)
+	{
+		WriteRepeatedSummary(target);
+	}
+
+	//payload buffer is reused (no allocation for records of similar size)
+	dedup.valid = true;
+	dedup.hash = hash;
+	dedup.level = record.level;
+	dedup.payload.assign(payload.data(), payload.size());
+	dedup.windowStart = record.ticks;
+
+	return false;
+}
+
+void MsvAsyncLogBackend::WriteRepeatedSummaries(bool writeAll)
+{
+	if (!m_repeatedRecords)
+	{
+		return;
+	}
+
+	uint32_t dedupWindow = m_dedupWindow.load(std::memory_order_relaxed);
+	uint64_t windowTicks = m_spTimestamp->GetTicksFrequency() / 1000 * dedupWindow;
+	uint64_t ticks = MsvTimestamp::ReadTicks();
+
+	//disabled deduplication -> write all remaining summaries
+	writeAll = writeAll || dedupWindow == 0;
+	m_repeatedRecords = false;
+
+	for (MsvAsyncLogTarget* pTarget: m_targetCache)
+	{
+		MsvLogDedupState& dedup = pTarget->dedup;
+		if (!dedup.repeatedCount)
+		{
+			continue;
+		}
+
+		if (writeAll || ticks >= dedup.windowStart + windowTicks)
+		{
+			WriteRepeatedSummary(*pTarget);
+		}
+		else
+		{
+			m_repeatedRecords = true;
+		}
+	}
+}
+
+void MsvAsyncLogBackend::WriteRepeatedSummary(MsvAsyncLogTarget& target)
+{
+	MsvLogDedupState& dedup = target.dedup;
+
+	std::string payload = "Last message repeated " + std::to_string(dedup.repeatedCount) + " times.";
+	spdlog::details::log_msg msg(m_spTimestamp->TicksToTime(dedup.lastTicks), spdlog::source_loc{}, target.loggerName, dedup.level, payload);
+	msg.thread_id = dedup.threadId;
+
+	for (spdlog::sink_ptr& spSink: target.sinks)
+	{
+		if (spSink->should_log(dedup.level))
+		{
+			spSink->log(msg);
+		}
+	}
+
+	//next identical record starts new window (it is written again)
+	dedup.valid = false;
+	dedup.repeatedCount = 0;
+	m_unflushed = true;
+}
+
+void MsvAsyncLogBackend::WriteDroppedSummary()
+{
+	uint64_t droppedRecords = m_droppedRecords.load(std::memory_order_relaxed);
+	if (droppedRecords == m_reportedDroppedRecords)
+	{
+		return;
+	}
+
+	std::string payload = std::to_string(droppedRecords - m_reportedDroppedRecords) + " log records have been dropped (log queue is full).";
+	m_reportedDroppedRecords = droppedRecords;
+
+	spdlog::details::log_msg msg(spdlog::source_loc{}, "MsvAsyncLogBackend", spdlog::level::warn, payload);
+
+	//more loggers might share one sink -> write summary once per sink
+	std::set<spdlog::sinks::sink*> writtenSinks;
+
+	std::lock_guard<std::mutex> lock(m_lock);
+	for (MsvAsyncLogTarget& target: m_targets)
+	{
+		for (spdlog::sink_ptr& spSink: target.sinks)
+		{
+			if (writtenSinks.insert(spSink.get()).second)
+			{
+				spSink->log(msg);
+			}
+		}
+	}
+
+	m_unflushed = true;
+}
+
+void MsvAsyncLogBackend::FlushSinks()
+{
+	std::set<spdlog::sinks::sink*> flushedSinks;
+
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		for (MsvAsyncLogTarget& target: m_targets)
+		{
+			for (spdlog::sink_ptr& spSink: target.sinks)
+			{
+				if (flushedSinks.insert(spSink.get()).second)
+				{
+					spSink->flush();
+				}
+			}
+		}
+	}
+
+	m_unflushed = false;
+	m_flushNow = false;
+}
+
+void MsvAsyncLogBackend::NotifySubscribers(const MsvAsyncLogTarget& target, const MsvLogRecord& record, spdlog::string_view_t payload)
+{
+	MsvLogEvent logEvent{std::chrono::system_clock::time_point(), record.level, record.threadId, spdlog::string_view_t(target.loggerName.data(), target.loggerName.size()), payload};
+	bool timeConverted = false;
+
+	std::lock_guard<std::mutex> lock(m_subscriptionsLock);
+
+	for (const MsvLogSubscription& subscription: m_subscriptions)
+	{
+		if (record.level < subscription.minLevel || (!subscription.loggerName.empty() && subscription.loggerName != target.loggerName))
+		{
+			continue;
+		}
+
+		//ticks are converted only when any subscriber wants record
+		if (!timeConverted)
+		{
+			logEvent.time = m_spTimestamp->TicksToTime(record.ticks);
+			timeConverted = true;
+		}
+
+		subscription.subscriber(logEvent);
+	}
+}
+
+MsvAsyncLogTarget* MsvAsyncLogBackend::GetTarget(uint32_t targetId)
+{
+	if (targetId >= m_targetCache.size())
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		for (size_t i = m_targetCache.size(); i < m_targets.size(); ++i)
+		{
+			m_targetCache.push_back(&m_targets[i]);
+		}
+
+		if (targetId >= m_targetCache.size())
+		{
+			return nullptr;
+		}
+	}
+
+	return m_targetCache[targetId];
+}
+
+void MsvAsyncLogBackend::ApplyFormatterSwaps(uint64_t swapId)
+{
+	std::vector<MsvLogFormatterSwap> swaps;
+
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		for (std::map<uint64_t, MsvLogFormatterSwap>::iterator swap = m_formatterSwaps.begin(); swap != m_formatterSwaps.end();)
+		{
+			if (swapId ? swap->first == swapId : !swap->second.queued)
+			{
+				swaps.push_back(swap->second);
+				swap = m_formatterSwaps.erase(swap);
+			}
+			else
+			{
+				++swap;
+			}
+		}
+	}
+
+	for (MsvLogFormatterSwap& swap: swaps)
+	{
+		MsvAsyncLogTarget* pTarget = GetTarget(swap.targetId);
+		if (!pTarget)
+		{
+			continue;
+		}
+
+		for (spdlog::sink_ptr& spSink: pTarget->sinks)
+		{
+			spSink->set_formatter(swap.spFormatter->clone());
+		}
+	}
+}
+
+/** @} */	//End of group MSYS.
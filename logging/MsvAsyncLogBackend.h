@@ -0,0 +1,634 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Async Log Backend
+* @details		Contains definition of async log backend.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_ASYNCLOGBACKEND_H
+#define MARSTECH_ASYNCLOGBACKEND_H
+
+
+#include "IMsvAsyncLoggerProvider.h"
+#include "MsvLogRingBuffer.h"
+#include "MsvLogSubscription.h"
+
+#include "msys/timestamp/MsvTimestamp.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <spdlog/formatter.h>
+#include <spdlog/sinks/sink.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Dedup State.
+* @details	Last written record of one logger and number of its suppressed repetitions (background thread
+*				only).
+******************************************************************************************************/
+struct MsvLogDedupState
+{
+	bool valid;													///< True when last record is stored.
+	uint64_t hash;												///< Hash of last record (level and payload).
+	MsvLogLevel level;										///< Log level of last record.
+	std::string payload;										///< Payload of last record.
+	uint64_t windowStart;									///< Ticks of last written record (start of dedup window).
+	uint64_t lastTicks;										///< Ticks of last suppressed record.
+	size_t threadId;											///< Thread ID of last suppressed record.
+	uint64_t repeatedCount;									///< Number of suppressed records.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Async Log Target.
+* @details	Logger name and sinks to which records of one logger are written by background thread.
+******************************************************************************************************/
+struct MsvAsyncLogTarget
+{
+	std::string loggerName;								///< Logger name.
+	std::vector<spdlog::sink_ptr> sinks;				///< Destination sinks (they are used by background thread only).
+	MsvLogDedupState dedup;								///< Dedup state (background thread only).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Formatter Swap.
+* @details	Formatter which is set to sinks of target by background thread (see
+*				@ref MsvAsyncLogBackend::SetFormatter).
+******************************************************************************************************/
+struct MsvLogFormatterSwap
+{
+	uint32_t targetId;										///< Target ID.
+	bool queued;												///< True when control record of swap is in queue.
+	std::shared_ptr<spdlog::formatter> spFormatter;	///< Formatter (it is cloned to each sink).
+};
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Merge Source.
+* @details	Log queue read by background thread and its records which have not been written yet (they wait
+*				in merge window for older records of other threads).
+******************************************************************************************************/
+struct MsvLogMergeSource
+{
+	std::shared_ptr<MsvLogRingBuffer> spBuffer;		///< Thread buffer (nullptr for shared queue).
+	std::deque<MsvLogRecord> records;					///< Read records (ordered by ticks).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Async Log Backend.
+* @details	Lock-free queue of log records and background thread which formats and writes them to
+*				target sinks. Log calls (see @ref MsvAsyncSink) just copy record to queue. Records store
+*				timestamp ticks which are converted to wall time when records are written.
+*				When per-thread buffers are enabled (@ref EnablePerThreadBuffers), each logging thread pushes
+*				records to its own queue (no shared cache line is touched by more threads) and background
+*				thread merges queues by k-way merge in time order.
+******************************************************************************************************/
+class MsvAsyncLogBackend
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	queueSize				Log queue capacity (number of records).
+	* @param[in]	overflowPolicy			Behaviour of log call when queue is full.
+	* @param[in]	flushInterval			Maximum time (in milliseconds) before written records are flushed.
+	* @param[in]	spTimestamp				Timestamp (shared timestamp of SYS, backend creates its own when it is
+	*												nullptr).
+	******************************************************************************************************/
+	MsvAsyncLogBackend(size_t queueSize, MsvLogOverflowPolicy overflowPolicy, uint32_t flushInterval = 100, std::shared_ptr<MsvTimestamp> spTimestamp = nullptr);
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	* @details	Stops background thread (all queued records are written).
+	******************************************************************************************************/
+	~MsvAsyncLogBackend();
+
+	/**************************************************************************************************//**
+	* @brief			Start backend.
+	* @details		Allocates queue, initializes timestamp and starts background thread.
+	* @retval		MSV_ALREADY_RUNNING_INFO		When backend is already running.
+	* @retval		MSV_ALLOCATION_ERROR				When memory allocation failed.
+	* @retval		MSV_SUCCESS							On success.
+	******************************************************************************************************/
+	MsvErrorCode Start();
+
+	/**************************************************************************************************//**
+	* @brief			Stop backend.
+	* @details		Writes all queued records, flushes sinks and stops background thread.
+	* @retval		MSV_NOT_RUNNING_INFO				When backend is not running.
+	* @retval		MSV_SUCCESS							On success.
+	******************************************************************************************************/
+	MsvErrorCode Stop();
+
+	/**************************************************************************************************//**
+	* @brief			Add target.
+	* @details		Registers logger and its sinks. Targets are never removed.
+	* @param[out]	targetId								ID of target (it is passed to @ref Push).
+	* @param[in]	loggerName							Logger name.
+	* @param[in]	sinks									Destination sinks.
+	* @retval		MSV_SUCCESS							On success.
+	******************************************************************************************************/
+	MsvErrorCode AddTarget(uint32_t& targetId, const std::string& loggerName, const std::vector<spdlog::sink_ptr>& sinks);
+
+	/**************************************************************************************************//**
+	* @brief			Push log record.
+	* @details		Copies log message to queue and captures log context of logging thread (fields are
+	*					appended to message when record is written). It is called in context of logging thread.
+	* @param[in]	targetId								Target ID (see @ref AddTarget).
+	* @param[in]	ticks									Log time (raw ticks read by @ref MsvTimestamp::ReadTicks, wall
+	*															time of message is not converted in log call).
+	* @param[in]	msg									Log message.
+	* @returns		bool
+	* @retval		true									When record has been queued.
+	* @retval		false									When record has been dropped.
+	******************************************************************************************************/
+	bool Push(uint32_t targetId, uint64_t ticks, const spdlog::details::log_msg& msg);
+
+	/**************************************************************************************************//**
+	* @brief			Push raw log record.
+	* @details		Copies payload to queue with current timestamp ticks (no wall clock is read and no log
+	*					message is created). It is called in context of logging thread.
+	* @param[in]	targetId								Target ID (see @ref AddTarget).
+	* @param[in]	logLevel								Log level.
+	* @param[in]	pPayload								Payload.
+	* @param[in]	payloadSize							Payload size (in bytes).
+	* @returns		bool
+	* @retval		true									When record has been queued.
+	* @retval		false									When record has been dropped.
+	******************************************************************************************************/
+	bool Push(uint32_t targetId, MsvLogLevel logLevel, const char* pPayload, size_t payloadSize);
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Waits until all records pushed before this call are written and sinks are flushed.
+	* @retval		MSV_NOT_RUNNING_INFO				When backend is not running.
+	* @retval		MSV_SUCCESS							On success.
+	******************************************************************************************************/
+	MsvErrorCode Flush();
+
+	/**************************************************************************************************//**
+	* @brief			Get dropped records count.
+	* @returns		uint64_t
+	******************************************************************************************************/
+	uint64_t GetDroppedRecordsCount() const;
+
+	/**************************************************************************************************//**
+	* @brief			Get timestamp.
+	* @details		Returns timestamp which converts ticks of records to wall time.
+	* @returns		std::shared_ptr<MsvTimestamp>
+	******************************************************************************************************/
+	std::shared_ptr<MsvTimestamp> GetTimestamp() const;
+
+	/**************************************************************************************************//**
+	* @brief			Set formatter.
+	* @details		Sets clone of formatter to all sinks of target. Sinks are used by background thread only, so
+	*					when it is running, control record is pushed to queue and background thread swaps formatter
+	*					when it reaches it (records logged before this call are formatted by previous formatter).
+	* @param[in]	targetId								Target ID.
+	* @param[in]	formatter							Formatter.
+	* @retval		MSV_NOT_FOUND_ERROR				When target does not exist.
+	* @retval		MSV_ALLOCATION_ERROR				When memory allocation failed.
+	* @retval		MSV_SUCCESS							On success.
+	* @note			When control record is dropped (full queue), formatter is swapped by next loop of background
+	*					thread.
+	******************************************************************************************************/
+	MsvErrorCode SetFormatter(uint32_t targetId, const spdlog::formatter& formatter);
+
+	/**************************************************************************************************//**
+	* @brief			Enable per-thread buffers.
+	* @details		Each logging thread gets its own queue (it is created with first log call of thread and
+	*					released when thread exits and queue is empty). Background thread keeps read records in
+	*					merge window (half of max staleness) and writes them ordered by time, so records of
+	*					different threads are written in time order. Remaining half of max staleness is used as
+	*					flush interval.
+	* @param[in]	maxStaleness						Maximum time (in milliseconds) between log call and flush of its
+	*														record to file.
+	* @param[in]	threadBufferSize					Capacity of thread queue (number of records, overflow policy is
+	*														applied when it is full).
+	* @retval		MSV_INVALID_DATA_ERROR			When max staleness is lower than 2 ms or buffer size is zero.
+	* @retval		MSV_ALREADY_INITIALIZED_INFO	When per-thread buffers are already enabled.
+	* @retval		MSV_SUCCESS							On success.
+	* @note			Records are ordered only when delay between log call and push of its record is shorter
+	*					than merge window (it might not be true when logging thread is preempted in log call).
+	******************************************************************************************************/
+	MsvErrorCode EnablePerThreadBuffers(uint32_t maxStaleness, size_t threadBufferSize);
+
+	/**************************************************************************************************//**
+	* @brief			Enable deduplication.
+	* @details		Identical consecutive records of one target are suppressed within dedup window and
+	*					"Last message repeated N times." is written instead of them. Records are compared by
+	*					hash of level and payload (formatted message or call site ID and raw arguments) first.
+	* @param[in]	window								Dedup window (in milliseconds, zero disables deduplication).
+	* @retval		MSV_SUCCESS							On success.
+	* @warning		Repetition summary is text record, do not enable it for binary sinks.
+	******************************************************************************************************/
+	MsvErrorCode EnableDeduplication(uint32_t window);
+
+	/**************************************************************************************************//**
+	* @brief			Add subscriber.
+	* @details		Registers subscriber which receives written records (before deduplication) matching
+	*					its filter. It is called by background thread.
+	* @param[out]	subscriptionId						Subscription ID (it is passed to @ref RemoveSubscriber).
+	* @param[in]	subscriber							Subscriber.
+	* @param[in]	minLevel								Minimum log level of delivered records.
+	* @param[in]	loggerName							Logger name of delivered records (empty for all loggers).
+	* @retval		MSV_INVALID_DATA_ERROR			When subscriber is empty.
+	* @retval		MSV_SUCCESS							On success.
+	******************************************************************************************************/
+	MsvErrorCode AddSubscriber(uint32_t& subscriptionId, MsvLogSubscriber subscriber, MsvLogLevel minLevel, const std::string& loggerName);
+
+	/**************************************************************************************************//**
+	* @brief			Remove subscriber.
+	* @details		Removes subscription. Subscriber is not called after this method returns.
+	* @param[in]	subscriptionId						Subscription ID.
+	* @retval		MSV_NOT_FOUND_ERROR				When subscription does not exist.
+	* @retval		MSV_SUCCESS							On success.
+	* @warning		It must not be called by subscriber (it waits for running subscriber).
+	******************************************************************************************************/
+	MsvErrorCode RemoveSubscriber(uint32_t subscriptionId);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Background thread.
+	* @details		Writes queued records until backend is stopped.
+	******************************************************************************************************/
+	void BackendThread();
+
+	/**************************************************************************************************//**
+	* @brief			Get thread buffer.
+	* @details		Returns queue of calling thread (it is created when it does not exist).
+	* @returns		MsvLogRingBuffer*
+	* @retval		nullptr									When queue could not be created.
+	******************************************************************************************************/
+	MsvLogRingBuffer* GetThreadBuffer();
+
+	/**************************************************************************************************//**
+	* @brief			Push record.
+	* @details		Copies record to queue (thread buffer or shared queue) and applies overflow policy when
+	*					queue is full.
+	* @param[in]	targetId									Target ID.
+	* @param[in]	ticks										Log time (timestamp ticks).
+	* @param[in]	threadId									ID of logging thread.
+	* @param[in]	logLevel									Log level.
+	* @param[in]	payload									Payload.
+	* @param[in]	pContext									Captured log context (record owns its reference, it is
+	*																released when record is dropped).
+	* @returns		bool
+	* @retval		true										When record has been queued.
+	* @retval		false										When record has been dropped.
+	******************************************************************************************************/
+	bool PushRecord(uint32_t targetId, uint64_t ticks, size_t threadId, MsvLogLevel logLevel, spdlog::string_view_t payload, MsvLogContextData* pContext);
+
+	/**************************************************************************************************//**
+	* @brief			Write queued records.
+	* @details		Writes all records which are in queue right now. When per-thread buffers are enabled,
+	*					records are read to merge window and only records older than merge window are written.
+	* @param[in]	writeAll									True when merge window is ignored (flush and stop).
+	* @returns		size_t									Number of written records.
+	******************************************************************************************************/
+	size_t WriteRecords(bool writeAll = false);
+
+	/**************************************************************************************************//**
+	* @brief			Update merge sources.
+	* @details		Adds new thread buffers to merge sources and removes empty buffers of finished threads.
+	* @warning		It must be called under lock (background thread only).
+	******************************************************************************************************/
+	void UpdateMergeSources();
+
+	/**************************************************************************************************//**
+	* @brief			Merge records.
+	* @details		Reads queued records of all merge sources and writes them in time order (k-way merge).
+	* @param[in]	writeAll									True when all records are written, false when only
+	*																records older than merge window are written.
+	* @returns		size_t									Number of written records.
+	******************************************************************************************************/
+	size_t MergeRecords(bool writeAll);
+
+	/**************************************************************************************************//**
+	* @brief			Has pending records.
+	* @details		Returns true when any queue or merge window has unwritten records.
+	* @returns		bool
+	******************************************************************************************************/
+	bool HasPendingRecords() const;
+
+	/**************************************************************************************************//**
+	* @brief			Write record.
+	* @details		Formats log record (with fields of its log context) and writes it to all sinks of its target.
+	* @param[in]	record								Log record.
+	******************************************************************************************************/
+	void WriteRecord(const MsvLogRecord& record);
+
+	/**************************************************************************************************//**
+	* @brief			Deduplicate record.
+	* @details		Checks whether record repeats last record of target within dedup window. Writes repetition
+	*					summary of previous record and stores record as last record when it does not.
+	* @param[in]	target								Target of record.
+	* @param[in]	record								Log record.
+	* @param[in]	payload								Payload of record.
+	* @param[in]	windowTicks							Dedup window (in ticks).
+	* @returns		bool
+	* @retval		true									When record is repetition (it must not be written).
+	* @retval		false									When record must be written.
+	******************************************************************************************************/
+	bool DeduplicateRecord(MsvAsyncLogTarget& target, const MsvLogRecord& record, spdlog::string_view_t payload, uint64_t windowTicks);
+
+	/**************************************************************************************************//**
+	* @brief			Write repeated summaries.
+	* @details		Writes repetition summaries of targets whose dedup window has elapsed.
+	* @param[in]	writeAll								True when summaries of all targets are written (flush and stop).
+	******************************************************************************************************/
+	void WriteRepeatedSummaries(bool writeAll);
+
+	/**************************************************************************************************//**
+	* @brief			Write repeated summary.
+	* @details		Writes "Last message repeated N times." to sinks of target and resets its dedup state.
+	* @param[in]	target								Target.
+	******************************************************************************************************/
+	void WriteRepeatedSummary(MsvAsyncLogTarget& target);
+
+	/**************************************************************************************************//**
+	* @brief			Write dropped records summary.
+	* @details		Writes warning with number of dropped records (since last summary) to all sinks.
+	******************************************************************************************************/
+	void WriteDroppedSummary();
+
+	/**************************************************************************************************//**
+	* @brief			Flush sinks.
+	* @details		Flushes all sinks of all targets.
+	******************************************************************************************************/
+	void FlushSinks();
+
+	/**************************************************************************************************//**
+	* @brief			Get target.
+	* @details		Returns target from cache (cache is refreshed when target is not cached yet).
+	* @param[in]	targetId								Target ID.
+	* @returns		MsvAsyncLogTarget*
+	* @retval		nullptr								When target does not exist.
+	******************************************************************************************************/
+	MsvAsyncLogTarget* GetTarget(uint32_t targetId);
+
+	/**************************************************************************************************//**
+	* @brief			Notify subscribers.
+	* @details		Delivers written record to subscribers whose filter it matches.
+	* @param[in]	target								Target of record.
+	* @param[in]	record								Log record.
+	* @param[in]	payload								Payload of record (with log context fields).
+	******************************************************************************************************/
+	void NotifySubscribers(const MsvAsyncLogTarget& target, const MsvLogRecord& record, spdlog::string_view_t payload);
+
+	/**************************************************************************************************//**
+	* @brief			Apply formatter swaps.
+	* @details		Sets formatters of swaps to sinks of their targets (background thread only).
+	* @param[in]	swapId								ID of swap whose control record is written (0 applies all swaps
+	*															whose control record is not in queue).
+	******************************************************************************************************/
+	void ApplyFormatterSwaps(uint64_t swapId);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks start, stop, targets and flush requests. It is never locked by log call.
+	******************************************************************************************************/
+	mutable std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Condition variable.
+	* @details	Wakes background thread (stop and flush requests) and flush waiters.
+	******************************************************************************************************/
+	std::condition_variable m_condition;
+
+	/**************************************************************************************************//**
+	* @brief		Queue.
+	* @details	Lock-free queue of log records.
+	******************************************************************************************************/
+	MsvLogRingBuffer m_queue;
+
+	/**************************************************************************************************//**
+	* @brief		Overflow policy.
+	* @details	Behaviour of log call when queue is full.
+	******************************************************************************************************/
+	MsvLogOverflowPolicy m_overflowPolicy;
+
+	/**************************************************************************************************//**
+	* @brief		Flush interval.
+	* @details	Maximum time (in milliseconds) before written records are flushed.
+	******************************************************************************************************/
+	uint32_t m_flushInterval;
+
+	/**************************************************************************************************//**
+	* @brief		Targets.
+	* @details	Registered loggers and their sinks (index is target ID, deque keeps references valid).
+	******************************************************************************************************/
+	std::deque<MsvAsyncLogTarget> m_targets;
+
+	/**************************************************************************************************//**
+	* @brief		Formatter swaps.
+	* @details	Formatters which wait for background thread (key is swap ID passed in payload of control record).
+	******************************************************************************************************/
+	std::map<uint64_t, MsvLogFormatterSwap> m_formatterSwaps;
+
+	/**************************************************************************************************//**
+	* @brief		Last formatter swap ID.
+	******************************************************************************************************/
+	uint64_t m_lastFormatterSwapId;
+
+	/**************************************************************************************************//**
+	* @brief		Background thread.
+	******************************************************************************************************/
+	std::thread m_thread;
+
+	/**************************************************************************************************//**
+	* @brief		Running flag.
+	* @details	True when background thread is running (log calls drop records when it is not running).
+	******************************************************************************************************/
+	std::atomic<bool> m_running;
+
+	/**************************************************************************************************//**
+	* @brief		Stop flag.
+	* @details	True when background thread should stop.
+	******************************************************************************************************/
+	bool m_stop;
+
+	/**************************************************************************************************//**
+	* @brief		Flush requests.
+	* @details	Number of requested flushes.
+	******************************************************************************************************/
+	uint64_t m_flushRequests;
+
+	/**************************************************************************************************//**
+	* @brief		Done flushes.
+	* @details	Number of requested flushes which have been done.
+	******************************************************************************************************/
+	uint64_t m_flushesDone;
+
+	/**************************************************************************************************//**
+	* @brief		Target cache.
+	* @details	Pointers to targets used by background thread without locking (targets are never removed).
+	******************************************************************************************************/
+	std::vector<MsvAsyncLogTarget*> m_targetCache;
+
+	/**************************************************************************************************//**
+	* @brief		Unflushed flag.
+	* @details	True when records have been written and sinks have not been flushed (background thread only).
+	******************************************************************************************************/
+	bool m_unflushed;
+
+	/**************************************************************************************************//**
+	* @brief		Immediate flush flag.
+	* @details	True when error (or more severe) record has been written (background thread only).
+	******************************************************************************************************/
+	bool m_flushNow;
+
+	/**************************************************************************************************//**
+	* @brief		Dropped records.
+	* @details	Number of records dropped because of full queue.
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_droppedRecords;
+
+	/**************************************************************************************************//**
+	* @brief		Reported dropped records.
+	* @details	Number of dropped records which have been reported by summary (background thread only).
+	******************************************************************************************************/
+	uint64_t m_reportedDroppedRecords;
+
+	/**************************************************************************************************//**
+	* @brief		Backend ID.
+	* @details	Unique ID of backend (thread buffers of backend are found by it in thread local storage).
+	******************************************************************************************************/
+	uint64_t m_backendId;
+
+	/**************************************************************************************************//**
+	* @brief		Per-thread buffers flag.
+	* @details	True when log calls push records to thread buffers.
+	******************************************************************************************************/
+	std::atomic<bool> m_perThreadBuffers;
+
+	/**************************************************************************************************//**
+	* @brief		Thread buffer size.
+	* @details	Capacity of thread queue (number of records).
+	******************************************************************************************************/
+	size_t m_threadBufferSize;
+
+	/**************************************************************************************************//**
+	* @brief		Merge window.
+	* @details	Time (in milliseconds) for which read records wait for older records of other threads.
+	******************************************************************************************************/
+	uint32_t m_mergeWindow;
+
+	/**************************************************************************************************//**
+	* @brief		Thread buffers.
+	* @details	Queues of logging threads.
+	******************************************************************************************************/
+	std::vector<std::shared_ptr<MsvLogRingBuffer>> m_threadBuffers;
+
+	/**************************************************************************************************//**
+	* @brief		Thread buffers version.
+	* @details	It is incremented when thread buffer is added (merge sources are updated by it).
+	******************************************************************************************************/
+	uint64_t m_threadBuffersVersion;
+
+	/**************************************************************************************************//**
+	* @brief		Merge sources.
+	* @details	Shared queue and thread buffers read by k-way merge (background thread only, it is empty
+	*				when per-thread buffers are not enabled).
+	******************************************************************************************************/
+	std::vector<MsvLogMergeSource> m_mergeSources;
+
+	/**************************************************************************************************//**
+	* @brief		Merge sources version.
+	* @details	Version of thread buffers in merge sources (background thread only).
+	******************************************************************************************************/
+	uint64_t m_mergeSourcesVersion;
+
+	/**************************************************************************************************//**
+	* @brief		Dedup window.
+	* @details	Time (in milliseconds) within which identical consecutive records are suppressed (zero means
+	*				disabled deduplication).
+	******************************************************************************************************/
+	std::atomic<uint32_t> m_dedupWindow;
+
+	/**************************************************************************************************//**
+	* @brief		Repeated records.
+	* @details	True when any target has suppressed records which have not been summarized yet (background
+	*				thread only).
+	******************************************************************************************************/
+	bool m_repeatedRecords;
+
+	/**************************************************************************************************//**
+	* @brief		Context payload.
+	* @details	Payload of record with appended log context (buffer is reused, background thread only).
+	******************************************************************************************************/
+	std::string m_contextPayload;
+
+	/**************************************************************************************************//**
+	* @brief		Subscriptions mutex.
+	* @details	Locks subscriptions. Background thread locks it only when there is any subscription.
+	******************************************************************************************************/
+	std::mutex m_subscriptionsLock;
+
+	/**************************************************************************************************//**
+	* @brief		Subscriptions.
+	* @details	Registered log subscribers and their filters.
+	******************************************************************************************************/
+	std::vector<MsvLogSubscription> m_subscriptions;
+
+	/**************************************************************************************************//**
+	* @brief		Subscribed flag.
+	* @details	True when there is any subscription (background thread reads it by relaxed load, so records
+	*				cost nothing when there is no subscriber).
+	******************************************************************************************************/
+	std::atomic<bool> m_subscribed;
+
+	/**************************************************************************************************//**
+	* @brief		Last subscription ID.
+	* @details	IDs are not reused.
+	******************************************************************************************************/
+	uint32_t m_lastSubscriptionId;
+
+	/**************************************************************************************************//**
+	* @brief		Timestamp.
+	* @details	Ticks of records are read by it and converted to wall time when records are written.
+	******************************************************************************************************/
+	std::shared_ptr<MsvTimestamp> m_spTimestamp;
+};
+
+
+#endif // !MARSTECH_ASYNCLOGBACKEND_H
+
+/** @} */	//End of group MSYS.
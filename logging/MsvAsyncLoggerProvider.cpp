@@ -0,0 +1,486 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Async Logger Provider Implementation
+* @details		Contains implementation of async logger provider.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvAsyncLoggerProvider.h"
+#include "MsvAsyncSink.h"
+#include "MsvBatchedFileSink.h"
+#include "MsvCompressingFileSink.h"
+#include "MsvJsonLinesFormatter.h"
+#include "MsvLogForwardingSink.h"
+#include "MsvLogIndexReader.h"
+#include "MsvLogTicks.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <spdlog/sinks/rotating_file_sink.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvAsyncLoggerProvider::MsvAsyncLoggerProvider(const char* logFolder, const char* logFile, int maxLogFileSize, int maxLogFiles, size_t queueSize, MsvLogOverflowPolicy overflowPolicy, std::shared_ptr<MsvTimestamp> spTimestamp):
+	m_spBackend(new (std::nothrow) MsvAsyncLogBackend(queueSize, overflowPolicy, 100, spTimestamp)),
+	m_maxCompressedLogsSize(0),
+	m_batchSize(0),
+	m_fsyncPolicy(MsvLogFsyncPolicy::MSV_LOG_FSYNC_NEVER),
+	m_indexBlockSize(0),
+	m_logFolder(logFolder ? logFolder : ""),
+	m_logFile(logFile ? logFile : "msvlog.txt"),
+	m_maxLogFileSize(maxLogFileSize),
+	m_maxLogFiles(maxLogFiles),
+	m_logLevel(spdlog::level::info)
+{
+
+}
+
+
+MsvAsyncLoggerProvider::~MsvAsyncLoggerProvider()
+{
+	if (m_spBackend)
+	{
+		m_spBackend->Stop();
+	}
+
+	//backend might rotate files while it writes queued records (rotator passes them to compressor)
+	if (m_spRotator)
+	{
+		m_spRotator->Stop();
+	}
+
+	if (m_spCompressor)
+	{
+		m_spCompressor->Stop();
+	}
+}
+
+
+/********************************************************************************************************************************
+*															MsvAsyncLoggerProvider public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvAsyncLoggerProvider::Initialize()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!m_spBackend)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	MsvErrorCode errorCode = m_spBackend->Start();
+	if (errorCode == MSV_ALREADY_RUNNING_INFO)
+	{
+		return MSV_SUCCESS;
+	}
+
+	return errorCode;
+}
+
+MsvErrorCode MsvAsyncLoggerProvider::GetStructuredLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	//logger might have been returned as text logger (its formatter is not changed)
+	if (m_loggers.find(loggerName) != m_loggers.end())
+	{
+		return MSV_ALREADY_EXISTS_ERROR;
+	}
+
+	std::unique_ptr<spdlog::formatter> spFormatter(new (std::nothrow) MsvJsonLinesFormatter());
+	if (!spFormatter)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spdlog::sink_ptr spFileSink = CreateFileSink(logFile, maxLogFileSize, maxLogFiles);
+	if (!spFileSink)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	//logger is not returned by other calls until lock is released
+	std::shared_ptr<MsvLogger> spNewLogger = CreateLogger(loggerName, spFileSink);
+	if (!spNewLogger)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spNewLogger->set_formatter(std::move(spFormatter));
+	spLogger = spNewLogger;
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															IMsvLoggerProvider public methods
+********************************************************************************************************************************/
+
+
+std::shared_ptr<MsvLogger> MsvAsyncLoggerProvider::GetLogger(const char* loggerName)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	std::map<std::string, std::shared_ptr<MsvLogger>>::iterator logger = m_loggers.find(loggerName);
+	if (logger != m_loggers.end())
+	{
+		return logger->second;
+	}
+
+	if (!m_spDefaultFileSink)
+	{
+		m_spDefaultFileSink = CreateFileSink(m_logFile.c_str(), m_maxLogFileSize, m_maxLogFiles);
+		if (!m_spDefaultFileSink)
+		{
+			return nullptr;
+		}
+	}
+
+	return CreateLogger(loggerName, m_spDefaultFileSink);
+}
+
+std::shared_ptr<MsvLogger> MsvAsyncLoggerProvider::GetLogger(const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	std::map<std::string, std::shared_ptr<MsvLogger>>::iterator logger = m_loggers.find(loggerName);
+	if (logger != m_loggers.end())
+	{
+		return logger->second;
+	}
+
+	spdlog::sink_ptr spFileSink = CreateFileSink(logFile, maxLogFileSize, maxLogFiles);
+	if (!spFileSink)
+	{
+		return nullptr;
+	}
+
+	return CreateLogger(loggerName, spFileSink);
+}
+
+void MsvAsyncLoggerProvider::SetLogLevel(MsvLogLevel logLevel)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	m_logLevel = logLevel;
+
+	for (std::pair<const std::string, std::shared_ptr<MsvLogger>>& logger: m_loggers)
+	{
+		MsvLogForwardingSink::SetLoggerLevel(logger.second, logLevel);
+	}
+}
+
+
+/********************************************************************************************************************************
+*															IMsvAsyncLoggerProvider public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvAsyncLoggerProvider::Flush()
+{
+	if (!m_spBackend)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	MSV_RETURN_FAILED(m_spBackend->Flush());
+
+	std::shared_ptr<MsvLogRotator> spRotator;
+	std::shared_ptr<MsvLogCompressor> spCompressor;
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_lock);
+		spRotator = m_spRotator;
+		spCompressor = m_spCompressor;
+	}
+
+	if (spRotator)
+	{
+		MSV_RETURN_FAILED(spRotator->WaitForIdle());
+	}
+
+	if (spCompressor)
+	{
+		return spCompressor->WaitForIdle();
+	}
+
+	return MSV_SUCCESS;
+}
+
+uint64_t MsvAsyncLoggerProvider::GetDroppedRecordsCount() const
+{
+	if (!m_spBackend)
+	{
+		return 0;
+	}
+
+	return m_spBackend->GetDroppedRecordsCount();
+}
+
+MsvErrorCode MsvAsyncLoggerProvider::EnableLogCompression(uint64_t maxCompressedLogsSize)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (m_spCompressor)
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	std::shared_ptr<MsvLogCompressor> spCompressor(new (std::nothrow) MsvLogCompressor());
+	if (!spCompressor)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	MSV_RETURN_FAILED(spCompressor->Start());
+
+	m_spCompressor = spCompressor;
+	m_maxCompressedLogsSize = maxCompressedLogsSize;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvAsyncLoggerProvider::EnablePerThreadBuffers(uint32_t maxStaleness, size_t threadBufferSize)
+{
+	if (!m_spBackend)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	return m_spBackend->EnablePerThreadBuffers(maxStaleness, threadBufferSize);
+}
+
+MsvErrorCode MsvAsyncLoggerProvider::EnableDeduplication(uint32_t window)
+{
+	if (!m_spBackend)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	return m_spBackend->EnableDeduplication(window);
+}
+
+MsvErrorCode MsvAsyncLoggerProvider::EnableBatchedWrites(size_t batchSize, MsvLogFsyncPolicy fsyncPolicy)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (batchSize == 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (m_batchSize)
+	{
+		return MSV_ALREADY_INITIALIZED_INFO;
+	}
+
+	m_batchSize = batchSize;
+	m_fsyncPolicy = fsyncPolicy;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvAsyncLoggerProvider::EnableLogIndex(uint32_t blockSize)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (blockSize == 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (m_indexBlockSize)
+	{
+		return MSV_ALREADY_INITIALIZED_INFO;
+	}
+
+	m_indexBlockSize = blockSize;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvAsyncLoggerProvider::EnableBackgroundRotation()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (m_spRotator)
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	std::shared_ptr<MsvLogRotator> spRotator(new (std::nothrow) MsvLogRotator());
+	if (!spRotator)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	MSV_RETURN_FAILED(spRotator->Start());
+
+	m_spRotator = spRotator;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvAsyncLoggerProvider::Subscribe(uint32_t& subscriptionId, MsvLogSubscriber subscriber, MsvLogLevel minLevel, const char* loggerName)
+{
+	if (!m_spBackend)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	return m_spBackend->AddSubscriber(subscriptionId, subscriber, minLevel, loggerName ? loggerName : "");
+}
+
+MsvErrorCode MsvAsyncLoggerProvider::Unsubscribe(uint32_t subscriptionId)
+{
+	if (!m_spBackend)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	return m_spBackend->RemoveSubscriber(subscriptionId);
+}
+
+MsvErrorCode MsvAsyncLoggerProvider::QueryLogFile(const char* logFile, std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, uint32_t levelMask, const char* loggerName, std::ostream& output) const
+{
+	MsvLogIndexReader reader;
+	return reader.Query(GetLogFilePath(logFile).c_str(), from, to, levelMask, loggerName, output);
+}
+
+
+/********************************************************************************************************************************
+*															MsvAsyncLoggerProvider protected methods
+********************************************************************************************************************************/
+
+
+std::shared_ptr<MsvLogger> MsvAsyncLoggerProvider::CreateLogger(const std::string& loggerName, spdlog::sink_ptr spFileSink)
+{
+	if (!m_spBackend)
+	{
+		return nullptr;
+	}
+
+	uint32_t targetId = 0;
+	if (MSV_FAILED(m_spBackend->AddTarget(targetId, loggerName, std::vector<spdlog::sink_ptr>{spFileSink})))
+	{
+		return nullptr;
+	}
+
+	std::shared_ptr<spdlog::sinks::sink> spAsyncSink(new (std::nothrow) MsvAsyncSink(m_spBackend, targetId));
+	if (!spAsyncSink)
+	{
+		return nullptr;
+	}
+
+	//forwarding sink converts ticks of log time to wall time for attached sinks
+	std::shared_ptr<spdlog::sinks::sink> spForwardingSink(new (std::nothrow) MsvLogForwardingSink(m_spBackend->GetTimestamp()));
+	if (!spForwardingSink)
+	{
+		return nullptr;
+	}
+
+	//sinks are not changed after logger is returned (flight recorder and log shipper attach to forwarding sink)
+	std::shared_ptr<MsvLogger> spLogger(new (std::nothrow) MsvLogger(loggerName, {spAsyncSink, spForwardingSink}));
+	if (!spLogger)
+	{
+		return nullptr;
+	}
+
+	//log macros pass timestamp ticks as log time to this logger (wall clock is not read by hot path)
+	spLogger->flush_on(MSV_LOG_TICKS_FLUSH_LEVEL);
+	MsvLogForwardingSink::SetLoggerLevel(spLogger, m_logLevel);
+	m_loggers[loggerName] = spLogger;
+
+	return spLogger;
+}
+
+spdlog::sink_ptr MsvAsyncLoggerProvider::CreateFileSink(const char* logFile, int maxLogFileSize, int maxLogFiles)
+{
+	std::string logFilePath = GetLogFilePath(logFile);
+
+	//sink is used by background thread only -> single threaded sink
+	uint64_t maxCompressedLogsSize = m_maxCompressedLogsSize ? m_maxCompressedLogsSize : static_cast<uint64_t>(maxLogFileSize) * static_cast<uint64_t>(maxLogFiles);
+
+	//index and background rotation are supported by batched file sink only
+	if (m_batchSize || m_indexBlockSize || m_spRotator)
+	{
+		size_t batchSize = m_batchSize ? m_batchSize : MSV_LOG_BATCH_CHUNK_SIZE;
+		std::shared_ptr<MsvBatchedFileSink> spBatchedSink(new (std::nothrow) MsvBatchedFileSink(logFilePath, static_cast<size_t>(maxLogFileSize), static_cast<size_t>(maxLogFiles), batchSize, m_fsyncPolicy, m_spCompressor, maxCompressedLogsSize, m_indexBlockSize, m_spRotator));
+		if (!spBatchedSink || MSV_FAILED(spBatchedSink->Initialize()))
+		{
+			return nullptr;
+		}
+
+		return spBatchedSink;
+	}
+
+	if (m_spCompressor)
+	{
+		std::shared_ptr<MsvCompressingFileSink> spCompressingSink(new (std::nothrow) MsvCompressingFileSink(logFilePath, static_cast<size_t>(maxLogFileSize), maxCompressedLogsSize, m_spCompressor));
+		if (!spCompressingSink || MSV_FAILED(spCompressingSink->Initialize()))
+		{
+			return nullptr;
+		}
+
+		return spCompressingSink;
+	}
+
+	try
+	{
+		return std::make_shared<spdlog::sinks::rotating_file_sink_st>(logFilePath, static_cast<size_t>(maxLogFileSize), static_cast<size_t>(maxLogFiles));
+	}
+	catch (const spdlog::spdlog_ex&)
+	{
+		return nullptr;
+	}
+}
+
+std::string MsvAsyncLoggerProvider::GetLogFilePath(const char* logFile) const
+{
+	std::string logFilePath = m_logFolder;
+	if (!logFilePath.empty() && logFilePath.back() != '/' && logFilePath.back() != '\\')
+	{
+		logFilePath += "/";
+	}
+	logFilePath += logFile ? logFile : m_logFile.c_str();
+
+	return logFilePath;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,300 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Async Logger Provider Implementation
+* @details		Contains definition of async logger provider.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_ASYNCLOGGERPROVIDER_H
+#define MARSTECH_ASYNCLOGGERPROVIDER_H
+
+
+#include "IMsvAsyncLoggerProvider.h"
+#include "MsvAsyncLogBackend.h"
+#include "MsvLogCompressor.h"
+#include "MsvLogRotator.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <map>
+#include <mutex>
+#include <string>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Async Logger Provider Implementation.
+* @details	Implementation of async logger provider interface. Loggers write to @ref MsvAsyncSink and
+*				one @ref MsvAsyncLogBackend (shared by all loggers) writes records to rotating files.
+* @see		IMsvAsyncLoggerProvider
+******************************************************************************************************/
+class MsvAsyncLoggerProvider:
+	public IMsvAsyncLoggerProvider
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	logFolder				Path to log folder where log files will be stored.
+	* @param[in]	logFile					Default log file name.
+	* @param[in]	maxLogFileSize			Maximum size of one log file (in bytes).
+	* @param[in]	maxLogFiles				Maximum number of log files (rotating logger, the oldest file will be deleted).
+	* @param[in]	queueSize				Log queue capacity (number of records).
+	* @param[in]	overflowPolicy			Behaviour of log call when queue is full.
+	* @param[in]	spTimestamp				Timestamp of log records (backend creates its own when it is nullptr).
+	******************************************************************************************************/
+	MsvAsyncLoggerProvider(const char* logFolder = "", const char* logFile = "msvlog.txt", int maxLogFileSize = 10485760, int maxLogFiles = 3, size_t queueSize = 8192, MsvLogOverflowPolicy overflowPolicy = MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_BLOCK, std::shared_ptr<MsvTimestamp> spTimestamp = nullptr);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Stops backend (all queued records are written).
+	******************************************************************************************************/
+	virtual ~MsvAsyncLoggerProvider();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize provider.
+	* @details		Starts async log backend.
+	* @retval		MSV_ALLOCATION_ERROR		When memory allocation failed.
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize();
+
+	/**************************************************************************************************//**
+	* @brief			Get structured logger.
+	* @details		Creates logger which writes JSON lines (@ref MsvJsonLinesFormatter) to its own log file.
+	*					Formatter is set before logger is returned.
+	* @param[out]	spLogger					Shared pointer to logger.
+	* @param[in]	loggerName				Logger name.
+	* @param[in]	logFile					Log file (JSON lines).
+	* @param[in]	maxLogFileSize			Maximum size of one log file (in bytes).
+	* @param[in]	maxLogFiles				Maximum number of log files.
+	* @retval		MSV_ALREADY_EXISTS_ERROR	When logger with this name has been already created.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode GetStructuredLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles);
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLoggerProvider::GetLogger(const char* loggerName)
+	******************************************************************************************************/
+	virtual std::shared_ptr<MsvLogger> GetLogger(const char* loggerName = "MsvLogger") override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLoggerProvider::GetLogger(const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles)
+	******************************************************************************************************/
+	virtual std::shared_ptr<MsvLogger> GetLogger(const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLoggerProvider::SetLogLevel(MsvLogLevel logLevel)
+	******************************************************************************************************/
+	virtual void SetLogLevel(MsvLogLevel logLevel) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvAsyncLoggerProvider::Flush()
+	******************************************************************************************************/
+	virtual MsvErrorCode Flush() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvAsyncLoggerProvider::GetDroppedRecordsCount() const
+	******************************************************************************************************/
+	virtual uint64_t GetDroppedRecordsCount() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvAsyncLoggerProvider::EnableLogCompression(uint64_t maxCompressedLogsSize)
+	******************************************************************************************************/
+	virtual MsvErrorCode EnableLogCompression(uint64_t maxCompressedLogsSize = 0) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvAsyncLoggerProvider::EnablePerThreadBuffers(uint32_t maxStaleness = 100, size_t threadBufferSize = 1024)
+	******************************************************************************************************/
+	virtual MsvErrorCode EnablePerThreadBuffers(uint32_t maxStaleness = 100, size_t threadBufferSize = 1024) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvAsyncLoggerProvider::EnableDeduplication(uint32_t window = 1000)
+	******************************************************************************************************/
+	virtual MsvErrorCode EnableDeduplication(uint32_t window = 1000) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvAsyncLoggerProvider::EnableBatchedWrites(size_t batchSize = 1048576, MsvLogFsyncPolicy fsyncPolicy = MsvLogFsyncPolicy::MSV_LOG_FSYNC_NEVER)
+	******************************************************************************************************/
+	virtual MsvErrorCode EnableBatchedWrites(size_t batchSize = 1048576, MsvLogFsyncPolicy fsyncPolicy = MsvLogFsyncPolicy::MSV_LOG_FSYNC_NEVER) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvAsyncLoggerProvider::EnableLogIndex(uint32_t blockSize = 65536)
+	******************************************************************************************************/
+	virtual MsvErrorCode EnableLogIndex(uint32_t blockSize = 65536) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvAsyncLoggerProvider::EnableBackgroundRotation()
+	******************************************************************************************************/
+	virtual MsvErrorCode EnableBackgroundRotation() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvAsyncLoggerProvider::Subscribe(uint32_t& subscriptionId, MsvLogSubscriber subscriber, MsvLogLevel minLevel = MsvLogLevel::trace, const char* loggerName = nullptr)
+	******************************************************************************************************/
+	virtual MsvErrorCode Subscribe(uint32_t& subscriptionId, MsvLogSubscriber subscriber, MsvLogLevel minLevel = MsvLogLevel::trace, const char* loggerName = nullptr) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvAsyncLoggerProvider::Unsubscribe(uint32_t subscriptionId)
+	******************************************************************************************************/
+	virtual MsvErrorCode Unsubscribe(uint32_t subscriptionId) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvAsyncLoggerProvider::QueryLogFile(const char* logFile, std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, uint32_t levelMask, const char* loggerName, std::ostream& output) const
+	******************************************************************************************************/
+	virtual MsvErrorCode QueryLogFile(const char* logFile, std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, uint32_t levelMask, const char* loggerName, std::ostream& output) const override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Create logger.
+	* @details		Registers target in backend and creates logger with async sink and forwarding sink.
+	* @param[in]	loggerName				Logger name.
+	* @param[in]	spFileSink				Destination file sink.
+	* @returns		std::shared_ptr<MsvLogger>
+	* @retval		nullptr					When memory allocation failed.
+	******************************************************************************************************/
+	std::shared_ptr<MsvLogger> CreateLogger(const std::string& loggerName, spdlog::sink_ptr spFileSink);
+
+	/**************************************************************************************************//**
+	* @brief			Create file sink.
+	* @details		Creates rotating file sink (it is used by background thread only). Creates batched file
+	*					sink when batched writes or log index are enabled and compressing file sink when log
+	*					compression is enabled.
+	* @param[in]	logFile					Log file name (in log folder).
+	* @param[in]	maxLogFileSize			Maximum size of one log file (in bytes).
+	* @param[in]	maxLogFiles				Maximum number of log files.
+	* @returns		spdlog::sink_ptr
+	* @retval		nullptr					When file sink creation failed.
+	******************************************************************************************************/
+	spdlog::sink_ptr CreateFileSink(const char* logFile, int maxLogFileSize, int maxLogFiles);
+
+	/**************************************************************************************************//**
+	* @brief			Get log file path.
+	* @details		Joins log folder and log file name.
+	* @param[in]	logFile					Log file name (default log file when it is nullptr).
+	* @returns		std::string
+	******************************************************************************************************/
+	std::string GetLogFilePath(const char* logFile) const;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	mutable std::recursive_mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Backend.
+	* @details	Async log backend shared by all loggers.
+	******************************************************************************************************/
+	std::shared_ptr<MsvAsyncLogBackend> m_spBackend;
+
+	/**************************************************************************************************//**
+	* @brief		Log compressor.
+	* @details	Compresses rotated files of all loggers (nullptr when log compression is disabled).
+	******************************************************************************************************/
+	std::shared_ptr<MsvLogCompressor> m_spCompressor;
+
+	/**************************************************************************************************//**
+	* @brief		Log rotator.
+	* @details	Rotates files of all loggers in background (nullptr when background rotation is disabled).
+	******************************************************************************************************/
+	std::shared_ptr<MsvLogRotator> m_spRotator;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum compressed logs size.
+	* @details	Maximum size of all compressed files of one log file (0 means maxLogFileSize * maxLogFiles).
+	******************************************************************************************************/
+	uint64_t m_maxCompressedLogsSize;
+
+	/**************************************************************************************************//**
+	* @brief		Batch size.
+	* @details	Size of batch of batched file sinks (in bytes, 0 means batched writes are disabled).
+	******************************************************************************************************/
+	size_t m_batchSize;
+
+	/**************************************************************************************************//**
+	* @brief		Fsync policy.
+	* @details	When batched file sinks synchronize written records to disk.
+	******************************************************************************************************/
+	MsvLogFsyncPolicy m_fsyncPolicy;
+
+	/**************************************************************************************************//**
+	* @brief		Index block size.
+	* @details	Minimum size of indexed block of log files (in bytes, 0 means log index is disabled).
+	******************************************************************************************************/
+	uint32_t m_indexBlockSize;
+
+	/**************************************************************************************************//**
+	* @brief		Loggers.
+	* @details	Created loggers (key is logger name).
+	******************************************************************************************************/
+	std::map<std::string, std::shared_ptr<MsvLogger>> m_loggers;
+
+	/**************************************************************************************************//**
+	* @brief		Default file sink.
+	* @details	File sink of loggers created without log file.
+	******************************************************************************************************/
+	spdlog::sink_ptr m_spDefaultFileSink;
+
+	/**************************************************************************************************//**
+	* @brief		Log folder.
+	* @details	Path to log folder where log files are stored.
+	******************************************************************************************************/
+	std::string m_logFolder;
+
+	/**************************************************************************************************//**
+	* @brief		Default log file.
+	* @details	Log file name of loggers created without log file.
+	******************************************************************************************************/
+	std::string m_logFile;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum log file size.
+	* @details	Maximum size of one default log file (in bytes).
+	******************************************************************************************************/
+	int m_maxLogFileSize;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum log files.
+	* @details	Maximum number of default log files.
+	******************************************************************************************************/
+	int m_maxLogFiles;
+
+	/**************************************************************************************************//**
+	* @brief		Log level.
+	* @details	Log level of all loggers.
+	******************************************************************************************************/
+	MsvLogLevel m_logLevel;
+};
+
+
+#endif // !MARSTECH_ASYNCLOGGERPROVIDER_H
+
+/** @} */	//End of group MSYS.
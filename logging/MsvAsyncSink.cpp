@@ -0,0 +1,98 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Async Sink
+* @details		Contains implementation of async sink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvAsyncSink.h"
+#include "MsvLogTicks.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <spdlog/pattern_formatter.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvAsyncSink::MsvAsyncSink(std::shared_ptr<MsvAsyncLogBackend> spBackend, uint32_t targetId):
+	m_spBackend(spBackend),
+	m_targetId(targetId)
+{
+
+}
+
+
+MsvAsyncSink::~MsvAsyncSink()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															spdlog::sinks::sink public methods
+********************************************************************************************************************************/
+
+
+void MsvAsyncSink::log(const spdlog::details::log_msg& msg)
+{
+	//log macros pass raw ticks as log time (other log calls read wall time, ticks are read here then)
+	uint64_t ticks = 0;
+	if (!MsvLogTimeToTicks(msg.time, ticks))
+	{
+		ticks = MsvTimestamp::ReadTicks();
+	}
+
+	m_spBackend->Push(m_targetId, ticks, msg);
+}
+
+void MsvAsyncSink::flush()
+{
+	m_spBackend->Flush();
+}
+
+void MsvAsyncSink::set_pattern(const std::string& pattern)
+{
+	m_spBackend->SetFormatter(m_targetId, spdlog::pattern_formatter(pattern));
+}
+
+void MsvAsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+{
+	if (sink_formatter)
+	{
+		m_spBackend->SetFormatter(m_targetId, *sink_formatter);
+	}
+}
+
+/** @} */	//End of group MSYS.
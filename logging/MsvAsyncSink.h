@@ -0,0 +1,115 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Async Sink
+* @details		Contains definition of async sink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_ASYNCSINK_H
+#define MARSTECH_ASYNCSINK_H
+
+
+#include "MsvAsyncLogBackend.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Async Sink.
+* @details	Spdlog sink which pushes log messages to @ref MsvAsyncLogBackend. It does not lock, format
+*				nor write in context of logging thread.
+* @note		Formatting pattern is applied by destination sinks (in background thread).
+******************************************************************************************************/
+class MsvAsyncSink:
+	public spdlog::sinks::sink
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spBackend				Async log backend.
+	* @param[in]	targetId					Target ID (logger and its destination sinks) in backend.
+	******************************************************************************************************/
+	MsvAsyncSink(std::shared_ptr<MsvAsyncLogBackend> spBackend, uint32_t targetId);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvAsyncSink();
+
+	/**************************************************************************************************//**
+	* @brief			Log message.
+	* @details		Pushes message to backend queue.
+	* @param[in]	msg						Log message.
+	******************************************************************************************************/
+	virtual void log(const spdlog::details::log_msg& msg) override;
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Waits until queued messages are written and flushed by backend.
+	******************************************************************************************************/
+	virtual void flush() override;
+
+	/**************************************************************************************************//**
+	* @brief			Set pattern.
+	* @details		Sets pattern to destination sinks (formatting is done by background thread).
+	*					It should be called before logger is used.
+	* @param[in]	pattern					Formatting pattern.
+	******************************************************************************************************/
+	virtual void set_pattern(const std::string& pattern) override;
+
+	/**************************************************************************************************//**
+	* @brief			Set formatter.
+	* @details		Sets formatter to destination sinks (formatting is done by background thread).
+	*					It should be called before logger is used.
+	* @param[in]	sink_formatter			Formatter.
+	******************************************************************************************************/
+	virtual void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Backend.
+	* @details	Async log backend.
+	******************************************************************************************************/
+	std::shared_ptr<MsvAsyncLogBackend> m_spBackend;
+
+	/**************************************************************************************************//**
+	* @brief		Target ID.
+	* @details	Target ID (logger and its destination sinks) in backend.
+	******************************************************************************************************/
+	uint32_t m_targetId;
+};
+
+
+#endif // !MARSTECH_ASYNCSINK_H
+
+/** @} */	//End of group MSYS.
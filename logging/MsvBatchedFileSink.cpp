@@ -0,0 +1,466 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Batched File Sink
+* @details		Contains implementation of @ref MsvBatchedFileSink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvBatchedFileSink.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+#include <spdlog/details/os.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <climits>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif // _WIN32
+
+MSV_ENABLE_WARNINGS
+
+
+#if !defined(_WIN32) && !defined(IOV_MAX)
+#define IOV_MAX 1024
+#endif
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvBatchedFileSink::MsvBatchedFileSink(const std::string& logFile, size_t maxLogFileSize, size_t maxLogFiles, size_t batchSize, MsvLogFsyncPolicy fsyncPolicy, std::shared_ptr<MsvLogCompressor> spCompressor, uint64_t maxCompressedLogsSize, uint32_t indexBlockSize, std::shared_ptr<MsvLogRotator> spRotator):
+	m_logFile(logFile),
+	m_maxLogFileSize(maxLogFileSize),
+	m_maxLogFiles(maxLogFiles),
+	m_fsyncPolicy(fsyncPolicy),
+	m_spCompressor(spCompressor),
+	m_maxCompressedLogsSize(maxCompressedLogsSize),
+	m_chunks((std::max)(static_cast<size_t>(1), (batchSize + MSV_LOG_BATCH_CHUNK_SIZE - 1) / MSV_LOG_BATCH_CHUNK_SIZE)),
+	m_currentChunk(0),
+	m_batchedSize(0),
+	m_fileSize(0),
+	m_rotationSize(maxLogFileSize),
+	m_unsynced(false),
+	m_rotationsCount(0),
+	m_indexBlockSize(indexBlockSize),
+	m_spRotator(spRotator),
+	m_indexPending(false),
+	m_hFile(MSV_LOG_INVALID_FILE_HANDLE)
+{
+
+}
+
+
+MsvBatchedFileSink::~MsvBatchedFileSink()
+{
+	WriteBatch();
+	if (m_fsyncPolicy != MsvLogFsyncPolicy::MSV_LOG_FSYNC_NEVER)
+	{
+		SyncFile();
+	}
+
+	CloseFile();
+
+	//pending rotation renames file which has just been closed
+	if (m_spNextFile)
+	{
+		m_spRotator->WaitForIdle();
+		if (m_spNextFile->ready.load(std::memory_order_acquire) && m_spNextFile->hFile != MSV_LOG_INVALID_FILE_HANDLE)
+		{
+			MsvLogRotator::CloseFile(m_spNextFile->hFile, 0);
+			spdlog::details::os::remove_if_exists(m_spNextFile->file);
+		}
+	}
+}
+
+
+/********************************************************************************************************************************
+*															MsvBatchedFileSink public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvBatchedFileSink::Initialize()
+{
+	if (m_hFile != MSV_LOG_INVALID_FILE_HANDLE)
+	{
+		return MSV_ALREADY_INITIALIZED_INFO;
+	}
+
+	for (MsvLogBatchChunk& chunk: m_chunks)
+	{
+		if (chunk.spMemory)
+		{
+			continue;
+		}
+
+		//chunks are aligned to their size (page aligned, they might be used for unbuffered writes)
+		chunk.spMemory.reset(new (std::nothrow) char[2 * MSV_LOG_BATCH_CHUNK_SIZE]);
+		if (!chunk.spMemory)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+
+		uintptr_t address = reinterpret_cast<uintptr_t>(chunk.spMemory.get());
+		chunk.pData = chunk.spMemory.get() + (MSV_LOG_BATCH_CHUNK_SIZE - address % MSV_LOG_BATCH_CHUNK_SIZE) % MSV_LOG_BATCH_CHUNK_SIZE;
+		chunk.size = 0;
+	}
+
+	if (m_indexBlockSize && !m_spIndexWriter)
+	{
+		m_spIndexWriter.reset(new (std::nothrow) MsvLogIndexWriter(m_indexBlockSize));
+		if (!m_spIndexWriter)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+	}
+
+	//temporary files of crashed process are rotated (rotations continue with their numbers)
+	m_rotationsCount = MsvLogRotator::RecoverFiles(m_logFile, m_maxLogFiles, m_spCompressor, m_maxCompressedLogsSize);
+
+	MsvErrorCode errorCode = OpenFile();
+	if (MSV_FAILED(errorCode))
+	{
+		return errorCode;
+	}
+
+	//next file is prepared ahead of first rotation
+	if (m_spRotator && !m_spNextFile)
+	{
+		m_spNextFile.reset(new (std::nothrow) MsvLogNextFile());
+		if (!m_spNextFile)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+
+		m_spNextFile->ready = false;
+		m_spNextFile->hFile = MSV_LOG_INVALID_FILE_HANDLE;
+		m_spNextFile->currentRenamed = false;
+		PrepareNextFile();
+	}
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvBatchedFileSink protected methods
+********************************************************************************************************************************/
+
+
+void MsvBatchedFileSink::sink_it_(const spdlog::details::log_msg& msg)
+{
+	m_formatted.clear();
+	formatter_->format(msg, m_formatted);
+
+	if (m_indexPending && m_spNextFile->ready.load(std::memory_order_acquire))
+	{
+		//index of switched file is opened when it has been renamed to log file
+		m_indexPending = false;
+		if (m_spNextFile->currentRenamed)
+		{
+			m_spIndexWriter->Open(m_logFile, m_fileSize);
+		}
+	}
+
+	if (m_fileSize > 0 && m_fileSize + m_formatted.size() > m_rotationSize)
+	{
+		if (!m_spNextFile)
+		{
+			RotateFile();
+		}
+		else if (m_spNextFile->ready.load(std::memory_order_acquire))
+		{
+			SwitchFile();
+		}
+
+		//file is appended until previous rotation is done
+	}
+
+	const char* pData = m_formatted.data();
+	size_t size = m_formatted.size();
+
+	if (m_spIndexWriter)
+	{
+		m_spIndexWriter->AddRecord(m_fileSize, size, std::chrono::duration_cast<std::chrono::nanoseconds>(msg.time.time_since_epoch()).count(), msg.level);
+	}
+
+	//record is split to chunks (file is just stream of bytes)
+	while (size > 0)
+	{
+		MsvLogBatchChunk& chunk = m_chunks[m_currentChunk];
+		size_t copySize = (std::min)(size, static_cast<size_t>(MSV_LOG_BATCH_CHUNK_SIZE) - chunk.size);
+
+		std::memcpy(chunk.pData + chunk.size, pData, copySize);
+		chunk.size += copySize;
+		m_batchedSize += copySize;
+		m_fileSize += copySize;
+		pData += copySize;
+		size -= copySize;
+
+		if (chunk.size == MSV_LOG_BATCH_CHUNK_SIZE && ++m_currentChunk == m_chunks.size())
+		{
+			WriteBatch();
+		}
+	}
+}
+
+void MsvBatchedFileSink::flush_()
+{
+	WriteBatch();
+
+	if (m_fsyncPolicy == MsvLogFsyncPolicy::MSV_LOG_FSYNC_ON_FLUSH)
+	{
+		SyncFile();
+	}
+
+	if (m_spIndexWriter)
+	{
+		m_spIndexWriter->Flush();
+	}
+}
+
+MsvErrorCode MsvBatchedFileSink::OpenFile()
+{
+	m_hFile = MsvLogRotator::OpenFile(m_logFile, m_maxLogFileSize, m_fileSize);
+	if (m_hFile == MSV_LOG_INVALID_FILE_HANDLE)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	//log file is written without index when index could not be opened
+	if (m_spIndexWriter)
+	{
+		m_spIndexWriter->Open(m_logFile, m_fileSize);
+	}
+
+	return MSV_SUCCESS;
+}
+
+void MsvBatchedFileSink::CloseFile()
+{
+	if (m_spIndexWriter)
+	{
+		m_spIndexWriter->Close();
+	}
+
+	MsvLogRotator::CloseFile(m_hFile, m_fileSize);
+	m_hFile = MSV_LOG_INVALID_FILE_HANDLE;
+}
+
+void MsvBatchedFileSink::WriteBatch()
+{
+	if (m_batchedSize == 0)
+	{
+		return;
+	}
+
+	size_t chunksCount = (std::min)(m_currentChunk + 1, m_chunks.size());
+
+#ifdef _WIN32
+	for (size_t i = 0; i < chunksCount && m_hFile != MSV_LOG_INVALID_FILE_HANDLE; ++i)
+	{
+		DWORD written = 0;
+		if (m_chunks[i].size && !WriteFile(m_hFile, m_chunks[i].pData, static_cast<DWORD>(m_chunks[i].size), &written, nullptr))
+		{
+			//write failed -> records are lost
+			break;
+		}
+	}
+#else
+	std::vector<struct iovec> iovecs(chunksCount);
+	for (size_t i = 0; i < chunksCount; ++i)
+	{
+		iovecs[i].iov_base = m_chunks[i].pData;
+		iovecs[i].iov_len = m_chunks[i].size;
+	}
+
+	//partial write continues from first unwritten byte
+	size_t first = 0;
+	while (m_hFile != MSV_LOG_INVALID_FILE_HANDLE && first < chunksCount)
+	{
+		ssize_t written = writev(m_hFile, &iovecs[first], static_cast<int>((std::min)(chunksCount - first, static_cast<size_t>(IOV_MAX))));
+		if (written < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			//write failed -> records are lost
+			break;
+		}
+
+		size_t remaining = static_cast<size_t>(written);
+		while (first < chunksCount && remaining >= iovecs[first].iov_len)
+		{
+			remaining -= iovecs[first].iov_len;
+			++first;
+		}
+
+		if (remaining)
+		{
+			iovecs[first].iov_base = static_cast<char*>(iovecs[first].iov_base) + remaining;
+			iovecs[first].iov_len -= remaining;
+		}
+	}
+#endif // _WIN32
+
+	for (size_t i = 0; i < chunksCount; ++i)
+	{
+		m_chunks[i].size = 0;
+	}
+
+	m_currentChunk = 0;
+	m_batchedSize = 0;
+	m_unsynced = true;
+
+	if (m_fsyncPolicy == MsvLogFsyncPolicy::MSV_LOG_FSYNC_ON_WRITE)
+	{
+		SyncFile();
+	}
+}
+
+void MsvBatchedFileSink::SyncFile()
+{
+	if (!m_unsynced)
+	{
+		return;
+	}
+
+	if (m_hFile == MSV_LOG_INVALID_FILE_HANDLE)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	FlushFileBuffers(m_hFile);
+#elif defined(__linux__)
+	fdatasync(m_hFile);
+#else
+	fsync(m_hFile);
+#endif // _WIN32
+
+	m_unsynced = false;
+}
+
+void MsvBatchedFileSink::RotateFile()
+{
+	WriteBatch();
+	if (m_fsyncPolicy != MsvLogFsyncPolicy::MSV_LOG_FSYNC_NEVER)
+	{
+		SyncFile();
+	}
+
+	CloseFile();
+	MsvLogRotator::RenameRotatedFiles(m_logFile, m_maxLogFiles, m_spCompressor, m_maxCompressedLogsSize, ++m_rotationsCount);
+
+	//file which could not be renamed is appended (rotation is tried again after next maxLogFileSize bytes)
+	bool rotated = !spdlog::details::os::path_exists(m_logFile);
+	if (MSV_FAILED(OpenFile()))
+	{
+		m_fileSize = 0;
+	}
+
+	m_rotationSize = rotated ? m_maxLogFileSize : m_fileSize + m_maxLogFileSize;
+}
+
+void MsvBatchedFileSink::SwitchFile()
+{
+	MsvLogNextFile& nextFile = *m_spNextFile;
+	if (nextFile.hFile == MSV_LOG_INVALID_FILE_HANDLE)
+	{
+		//next file could not be prepared -> rotation is synchronous and preparation is tried again
+		RotateFile();
+		PrepareNextFile();
+		return;
+	}
+
+	WriteBatch();
+	if (m_fsyncPolicy != MsvLogFsyncPolicy::MSV_LOG_FSYNC_NEVER)
+	{
+		SyncFile();
+	}
+
+	if (m_spIndexWriter)
+	{
+		m_spIndexWriter->Close();
+		m_indexPending = true;
+	}
+
+	//switchover is just swap of handles, full file is closed and renamed by rotator
+	MsvLogRotatorJob job;
+	job.hRotatedFile = m_hFile;
+	job.rotatedFileSize = m_fileSize;
+	job.currentFile = nextFile.file;
+
+	m_hFile = nextFile.hFile;
+	m_fileSize = 0;
+	m_rotationSize = m_maxLogFileSize;
+	++m_rotationsCount;
+
+	nextFile.ready.store(false, std::memory_order_relaxed);
+	job.spNextFile = m_spNextFile;
+	job.logFile = m_logFile;
+	job.maxLogFileSize = m_maxLogFileSize;
+	job.maxLogFiles = m_maxLogFiles;
+	job.spCompressor = m_spCompressor;
+	job.maxCompressedLogsSize = m_maxCompressedLogsSize;
+	job.rotationsCount = m_rotationsCount;
+	m_spRotator->AddJob(job);
+}
+
+void MsvBatchedFileSink::PrepareNextFile()
+{
+	MsvLogRotatorJob job;
+	job.spNextFile = m_spNextFile;
+	job.logFile = m_logFile;
+	job.maxLogFileSize = m_maxLogFileSize;
+	job.maxLogFiles = m_maxLogFiles;
+	job.hRotatedFile = MSV_LOG_INVALID_FILE_HANDLE;
+	job.rotatedFileSize = 0;
+	job.maxCompressedLogsSize = m_maxCompressedLogsSize;
+	job.rotationsCount = m_rotationsCount;
+
+	m_spNextFile->ready.store(false, std::memory_order_relaxed);
+	m_spRotator->AddJob(job);
+}
+
+/** @} */	//End of group MSYS.
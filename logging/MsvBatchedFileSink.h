@@ -0,0 +1,314 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Batched File Sink
+* @details		Contains definition of @ref MsvBatchedFileSink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_BATCHEDFILESINK_H
+#define MARSTECH_BATCHEDFILESINK_H
+
+
+#include "IMsvAsyncLoggerProvider.h"
+#include "MsvLogCompressor.h"
+#include "MsvLogIndexWriter.h"
+#include "MsvLogRotator.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <spdlog/details/null_mutex.h>
+#include <spdlog/sinks/base_sink.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Batch chunk size.
+* @details	Size (and alignment) of one batch buffer chunk. Batch consists of batchSize / chunk size chunks
+*				written by one vectored write.
+******************************************************************************************************/
+#define MSV_LOG_BATCH_CHUNK_SIZE 65536
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Batch Chunk.
+* @details	Aligned part of batch buffer.
+******************************************************************************************************/
+struct MsvLogBatchChunk
+{
+	std::unique_ptr<char[]> spMemory;					///< Allocated memory (it is larger than chunk because of alignment).
+	char* pData;												///< Aligned chunk data.
+	size_t size;												///< Size of data in chunk (in bytes).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Batched File Sink.
+* @details	Rotating file sink which coalesces formatted records into aligned batch chunks. Full batch is
+*				written by one vectored write (writev, WriteFile for each chunk on Windows) and space for whole
+*				log file is reserved when file is opened (fallocate with keep size, file allocation info on
+*				Windows), so writes do not allocate file blocks and do not update file metadata.
+*				Rotated files are renamed like by spdlog rotating file sink or they are passed to
+*				@ref MsvLogCompressor when compressor is set. Sink writes sidecar index of log file (see
+*				@ref MsvLogIndexWriter) when index block size is set.
+*				When @ref MsvLogRotator is set, next log file is prepared ahead of time and rotation is just
+*				swap of file handles - full file is closed and renamed by rotator thread and new file is
+*				renamed to log file name while it is written.
+* @note		It is single threaded sink (it is used by async log backend thread only).
+******************************************************************************************************/
+class MsvBatchedFileSink:
+	public spdlog::sinks::base_sink<spdlog::details::null_mutex>
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	logFile							Log file path.
+	* @param[in]	maxLogFileSize					Maximum size of log file (in bytes).
+	* @param[in]	maxLogFiles						Maximum number of rotated log files (when compressor is not set).
+	* @param[in]	batchSize						Size of batch (in bytes, it is rounded up to chunk size).
+	* @param[in]	fsyncPolicy						When written records are synchronized to disk.
+	* @param[in]	spCompressor					Log compressor (nullptr when rotated files are not compressed).
+	* @param[in]	maxCompressedLogsSize		Maximum size of all compressed rotated files (in bytes).
+	* @param[in]	indexBlockSize					Minimum size of indexed block (in bytes, 0 means log file is not indexed).
+	* @param[in]	spRotator						Log rotator (nullptr when files are rotated by sink).
+	******************************************************************************************************/
+	MsvBatchedFileSink(const std::string& logFile, size_t maxLogFileSize, size_t maxLogFiles, size_t batchSize, MsvLogFsyncPolicy fsyncPolicy, std::shared_ptr<MsvLogCompressor> spCompressor = nullptr, uint64_t maxCompressedLogsSize = 0, uint32_t indexBlockSize = 0, std::shared_ptr<MsvLogRotator> spRotator = nullptr);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Writes batched records and closes log file (it waits for pending rotation and removes prepared
+	*				next file).
+	******************************************************************************************************/
+	virtual ~MsvBatchedFileSink();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize sink.
+	* @details		Allocates batch chunks, recovers temporary files of crashed process (see
+	*					@ref MsvLogRotator::RecoverFiles) and opens log file (records are appended to existing file).
+	*					Next log file is prepared by rotator when it is set.
+	* @retval		MSV_ALREADY_INITIALIZED_INFO	When sink is already initialized.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_INVALID_DATA_ERROR		When log file could not be opened.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Sink it.
+	* @details		Formats message and copies it to batch (batch is written when it is full and file is
+	*					rotated or switched when record does not fit to it).
+	* @param[in]	msg								Log message.
+	******************************************************************************************************/
+	virtual void sink_it_(const spdlog::details::log_msg& msg) override;
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Writes batch and synchronizes file (depends on fsync policy).
+	******************************************************************************************************/
+	virtual void flush_() override;
+
+	/**************************************************************************************************//**
+	* @brief			Open file.
+	* @details		Opens log file for appending and reserves space up to maximum log file size. Opens index of
+	*					log file when it is enabled.
+	* @retval		MSV_INVALID_DATA_ERROR		When log file could not be opened.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode OpenFile();
+
+	/**************************************************************************************************//**
+	* @brief			Close file.
+	* @details		Releases reserved space behind end of file and closes it.
+	******************************************************************************************************/
+	void CloseFile();
+
+	/**************************************************************************************************//**
+	* @brief			Write batch.
+	* @details		Writes all chunks of batch by one vectored write and clears batch.
+	******************************************************************************************************/
+	void WriteBatch();
+
+	/**************************************************************************************************//**
+	* @brief			Sync file.
+	* @details		Synchronizes written data of log file to disk.
+	******************************************************************************************************/
+	void SyncFile();
+
+	/**************************************************************************************************//**
+	* @brief			Rotate file.
+	* @details		Writes batch, closes and renames full log file with its index (or passes it to compressor
+	*					and removes index) and opens new log file.
+	******************************************************************************************************/
+	void RotateFile();
+
+	/**************************************************************************************************//**
+	* @brief			Switch file.
+	* @details		Writes batch, swaps log file with prepared next file and passes full file to rotator (it is
+	*					rotated synchronously when next file could not be prepared).
+	******************************************************************************************************/
+	void SwitchFile();
+
+	/**************************************************************************************************//**
+	* @brief			Prepare next file.
+	* @details		Asks rotator to prepare next log file.
+	******************************************************************************************************/
+	void PrepareNextFile();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Log file.
+	* @details	Log file path.
+	******************************************************************************************************/
+	std::string m_logFile;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum log file size.
+	* @details	Maximum size of log file (in bytes).
+	******************************************************************************************************/
+	size_t m_maxLogFileSize;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum log files.
+	* @details	Maximum number of rotated log files (when compressor is not set).
+	******************************************************************************************************/
+	size_t m_maxLogFiles;
+
+	/**************************************************************************************************//**
+	* @brief		Fsync policy.
+	* @details	When written records are synchronized to disk.
+	******************************************************************************************************/
+	MsvLogFsyncPolicy m_fsyncPolicy;
+
+	/**************************************************************************************************//**
+	* @brief		Log compressor.
+	* @details	Compresses rotated files in background (nullptr when rotated files are just renamed).
+	******************************************************************************************************/
+	std::shared_ptr<MsvLogCompressor> m_spCompressor;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum compressed logs size.
+	* @details	Maximum size of all compressed rotated files (in bytes).
+	******************************************************************************************************/
+	uint64_t m_maxCompressedLogsSize;
+
+	/**************************************************************************************************//**
+	* @brief		Batch chunks.
+	* @details	Aligned buffers of formatted records which have not been written yet.
+	******************************************************************************************************/
+	std::vector<MsvLogBatchChunk> m_chunks;
+
+	/**************************************************************************************************//**
+	* @brief		Current chunk.
+	* @details	Index of chunk to which records are copied.
+	******************************************************************************************************/
+	size_t m_currentChunk;
+
+	/**************************************************************************************************//**
+	* @brief		Batched size.
+	* @details	Size of records in batch (in bytes).
+	******************************************************************************************************/
+	size_t m_batchedSize;
+
+	/**************************************************************************************************//**
+	* @brief		Formatted record.
+	* @details	Reusable buffer of formatted record.
+	******************************************************************************************************/
+	spdlog::memory_buf_t m_formatted;
+
+	/**************************************************************************************************//**
+	* @brief		File size.
+	* @details	Size of log file including batched records (in bytes).
+	******************************************************************************************************/
+	size_t m_fileSize;
+
+	/**************************************************************************************************//**
+	* @brief		Rotation size.
+	* @details	File size at which file is rotated (maximum log file size or more when rotated file could not
+	*				be renamed).
+	******************************************************************************************************/
+	size_t m_rotationSize;
+
+	/**************************************************************************************************//**
+	* @brief		Unsynced flag.
+	* @details	True when data have been written since last sync.
+	******************************************************************************************************/
+	bool m_unsynced;
+
+	/**************************************************************************************************//**
+	* @brief		Rotations count.
+	* @details	Number of rotations (it makes names of rotated files passed to compressor unique).
+	******************************************************************************************************/
+	uint64_t m_rotationsCount;
+
+	/**************************************************************************************************//**
+	* @brief		Index block size.
+	* @details	Minimum size of indexed block (in bytes, 0 means log file is not indexed).
+	******************************************************************************************************/
+	uint32_t m_indexBlockSize;
+
+	/**************************************************************************************************//**
+	* @brief		Index writer.
+	* @details	Writes sidecar index of log file (nullptr when log file is not indexed).
+	******************************************************************************************************/
+	std::unique_ptr<MsvLogIndexWriter> m_spIndexWriter;
+
+	/**************************************************************************************************//**
+	* @brief		Log rotator.
+	* @details	Prepares next files and rotates full files in background (nullptr when files are rotated by sink).
+	******************************************************************************************************/
+	std::shared_ptr<MsvLogRotator> m_spRotator;
+
+	/**************************************************************************************************//**
+	* @brief		Next file.
+	* @details	Log file prepared by rotator (nullptr when rotator is not set).
+	******************************************************************************************************/
+	std::shared_ptr<MsvLogNextFile> m_spNextFile;
+
+	/**************************************************************************************************//**
+	* @brief		Index pending flag.
+	* @details	True when index of switched file waits for rename of file (it is opened when rotation is done).
+	******************************************************************************************************/
+	bool m_indexPending;
+
+	/**************************************************************************************************//**
+	* @brief		File handle.
+	* @details	Handle of written log file (file descriptor on other platforms).
+	******************************************************************************************************/
+	MsvLogFileHandle m_hFile;
+};
+
+
+#endif // !MARSTECH_BATCHEDFILESINK_H
+
+/** @} */	//End of group MSYS.
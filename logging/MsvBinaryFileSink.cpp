@@ -0,0 +1,231 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Binary File Sink
+* @details		Contains implementation of binary file sink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvBinaryFileSink.h"
+#include "MsvBinaryLog.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <spdlog/details/os.h>
+#include <spdlog/sinks/rotating_file_sink.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvBinaryFileSink::MsvBinaryFileSink(const std::string& loggerName, const std::string& logFile, size_t maxLogFileSize, size_t maxLogFiles, std::shared_ptr<MsvBinaryLogSiteRegistry> spSiteRegistry):
+	m_loggerName(loggerName),
+	m_logFile(logFile),
+	m_maxLogFileSize(maxLogFileSize),
+	m_maxLogFiles(maxLogFiles),
+	m_spSiteRegistry(spSiteRegistry),
+	m_fileSize(0),
+	m_previousTime(0)
+{
+
+}
+
+
+MsvBinaryFileSink::~MsvBinaryFileSink()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvBinaryFileSink public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvBinaryFileSink::Initialize()
+{
+	try
+	{
+		OpenFile();
+	}
+	catch (const spdlog::spdlog_ex&)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	return MSV_SUCCESS;
+}
+
+void MsvBinaryFileSink::log(const spdlog::details::log_msg& msg)
+{
+	const char* pPayload = msg.payload.data();
+	const char* pPayloadEnd = pPayload + msg.payload.size();
+
+	uint64_t siteId = 0;
+	if (!MsvBinaryLogReadVarint(pPayload, pPayloadEnd, siteId) || siteId > UINT32_MAX)
+	{
+		return;
+	}
+
+	try
+	{
+		if (m_fileSize >= m_maxLogFileSize)
+		{
+			RotateFiles();
+		}
+
+		m_buffer.clear();
+
+		if (!WriteSite(static_cast<uint32_t>(siteId)))
+		{
+			return;
+		}
+
+		int64_t time = std::chrono::duration_cast<std::chrono::nanoseconds>(msg.time.time_since_epoch()).count();
+
+		m_buffer.push_back(MSV_BLOG_RECORD_TAG);
+		WriteVarint(siteId);
+		WriteVarint(MsvBinaryLogZigzagEncode(time - m_previousTime));
+		WriteVarint(msg.thread_id);
+		WriteString(pPayload, static_cast<size_t>(pPayloadEnd - pPayload));
+		m_previousTime = time;
+
+		m_file.write(m_buffer);
+		m_fileSize += m_buffer.size();
+	}
+	catch (const spdlog::spdlog_ex&)
+	{
+		//write failed -> record is lost
+	}
+}
+
+void MsvBinaryFileSink::flush()
+{
+	m_file.flush();
+}
+
+void MsvBinaryFileSink::set_pattern(const std::string& /*pattern*/)
+{
+
+}
+
+void MsvBinaryFileSink::set_formatter(std::unique_ptr<spdlog::formatter> /*sink_formatter*/)
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvBinaryFileSink protected methods
+********************************************************************************************************************************/
+
+
+void MsvBinaryFileSink::OpenFile()
+{
+	m_file.open(m_logFile, true);
+
+	m_buffer.clear();
+	m_buffer.append(MSV_BLOG_FILE_MAGIC, MSV_BLOG_FILE_MAGIC + MSV_BLOG_FILE_MAGIC_SIZE);
+	WriteString(m_loggerName.data(), m_loggerName.size());
+	m_file.write(m_buffer);
+
+	m_fileSize = m_buffer.size();
+	m_writtenSites.clear();
+	m_previousTime = 0;
+}
+
+void MsvBinaryFileSink::RotateFiles()
+{
+	m_file.close();
+
+	//log.mblog -> log.1.mblog -> log.2.mblog...
+	for (size_t i = m_maxLogFiles; i > 0; --i)
+	{
+		spdlog::filename_t source = spdlog::sinks::rotating_file_sink_st::calc_filename(m_logFile, i - 1);
+		if (!spdlog::details::os::path_exists(source))
+		{
+			continue;
+		}
+
+		spdlog::filename_t target = spdlog::sinks::rotating_file_sink_st::calc_filename(m_logFile, i);
+		spdlog::details::os::remove_if_exists(target);
+		spdlog::details::os::rename(source, target);
+	}
+
+	OpenFile();
+}
+
+bool MsvBinaryFileSink::WriteSite(uint32_t siteId)
+{
+	if (siteId < m_writtenSites.size() && m_writtenSites[siteId])
+	{
+		return true;
+	}
+
+	MsvBinaryLogSiteDefinition site;
+	if (MSV_FAILED(m_spSiteRegistry->GetSite(siteId, site)))
+	{
+		return false;
+	}
+
+	m_buffer.push_back(MSV_BLOG_SITE_TAG);
+	WriteVarint(site.id);
+	m_buffer.push_back(static_cast<char>(site.level));
+	WriteVarint(site.line);
+	WriteString(site.file.data(), site.file.size());
+	WriteString(site.format.data(), site.format.size());
+	WriteString(site.argTypes.data(), site.argTypes.size());
+
+	if (siteId >= m_writtenSites.size())
+	{
+		m_writtenSites.resize(siteId + 1, false);
+	}
+	m_writtenSites[siteId] = true;
+
+	return true;
+}
+
+void MsvBinaryFileSink::WriteVarint(uint64_t value)
+{
+	char buffer[10];
+	m_buffer.append(buffer, MsvBinaryLogWriteVarint(buffer, value));
+}
+
+void MsvBinaryFileSink::WriteString(const char* pData, size_t size)
+{
+	WriteVarint(size);
+	m_buffer.append(pData, pData + size);
+}
+
+/** @} */	//End of group MSYS.
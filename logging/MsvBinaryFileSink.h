@@ -0,0 +1,242 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Binary File Sink
+* @details		Contains definition of binary file sink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_BINARYFILESINK_H
+#define MARSTECH_BINARYFILESINK_H
+
+
+#include "MsvBinaryLogSiteRegistry.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <spdlog/details/file_helper.h>
+#include <spdlog/sinks/sink.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Binary log file magic.
+* @details	First bytes of each binary log file (the last byte is format version).
+******************************************************************************************************/
+#define MSV_BLOG_FILE_MAGIC "MSVBLOG\x01"
+
+/**************************************************************************************************//**
+* @brief		Binary log file magic size.
+******************************************************************************************************/
+#define MSV_BLOG_FILE_MAGIC_SIZE 8
+
+/**************************************************************************************************//**
+* @brief		Site definition tag.
+* @details	Site definition: varint ID, level byte, varint line, file, format and argument types
+*				(strings are varint length and bytes).
+******************************************************************************************************/
+#define MSV_BLOG_SITE_TAG 'S'
+
+/**************************************************************************************************//**
+* @brief		Log record tag.
+* @details	Log record: varint site ID, zigzag varint time difference to previous record (ns), varint
+*				thread ID, varint arguments size and encoded arguments.
+******************************************************************************************************/
+#define MSV_BLOG_RECORD_TAG 'R'
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Binary File Sink.
+* @details	Spdlog sink which writes binary log records (see @ref MsvBinaryLog) to rotating files.
+*				Each file starts with header (magic and logger name) and contains definitions of all its
+*				sites, so it might be decoded alone.
+* @warning	Sink is not thread safe. It is used by background thread of @ref MsvAsyncLogBackend only.
+******************************************************************************************************/
+class MsvBinaryFileSink:
+	public spdlog::sinks::sink
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	loggerName				Logger name (it is written to file header).
+	* @param[in]	logFile					Log file path.
+	* @param[in]	maxLogFileSize			Maximum size of one log file (in bytes).
+	* @param[in]	maxLogFiles				Maximum number of log files (rotating logger, the oldest file will be deleted).
+	* @param[in]	spSiteRegistry			Call site registry.
+	******************************************************************************************************/
+	MsvBinaryFileSink(const std::string& loggerName, const std::string& logFile, size_t maxLogFileSize, size_t maxLogFiles, std::shared_ptr<MsvBinaryLogSiteRegistry> spSiteRegistry);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvBinaryFileSink();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize sink.
+	* @details		Opens log file.
+	* @retval		MSV_INVALID_DATA_ERROR	When log file could not be opened (invalid path or access rights).
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize();
+
+	/**************************************************************************************************//**
+	* @brief			Log message.
+	* @details		Writes binary record (payload is encoded site ID and arguments).
+	* @param[in]	msg						Log message.
+	******************************************************************************************************/
+	virtual void log(const spdlog::details::log_msg& msg) override;
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Flushes log file.
+	******************************************************************************************************/
+	virtual void flush() override;
+
+	/**************************************************************************************************//**
+	* @brief			Set pattern.
+	* @details		Ignored - binary records are not formatted.
+	* @param[in]	pattern					Formatting pattern.
+	******************************************************************************************************/
+	virtual void set_pattern(const std::string& pattern) override;
+
+	/**************************************************************************************************//**
+	* @brief			Set formatter.
+	* @details		Ignored - binary records are not formatted.
+	* @param[in]	sink_formatter			Formatter.
+	******************************************************************************************************/
+	virtual void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Open file.
+	* @details		Opens (truncates) log file and writes file header.
+	******************************************************************************************************/
+	void OpenFile();
+
+	/**************************************************************************************************//**
+	* @brief			Rotate files.
+	* @details		Closes log file, renames old files (the oldest one is deleted) and opens new file.
+	******************************************************************************************************/
+	void RotateFiles();
+
+	/**************************************************************************************************//**
+	* @brief			Write site.
+	* @details		Writes site definition to buffer (when it has not been written to current file yet).
+	* @param[in]	siteId					Site ID.
+	* @returns		bool
+	* @retval		true						When site definition is in current file.
+	* @retval		false						When site is not registered.
+	******************************************************************************************************/
+	bool WriteSite(uint32_t siteId);
+
+	/**************************************************************************************************//**
+	* @brief			Write varint.
+	* @details		Appends varint to buffer.
+	* @param[in]	value						Value to write.
+	******************************************************************************************************/
+	void WriteVarint(uint64_t value);
+
+	/**************************************************************************************************//**
+	* @brief			Write string.
+	* @details		Appends varint size and string bytes to buffer.
+	* @param[in]	pData						String data.
+	* @param[in]	size						String size.
+	******************************************************************************************************/
+	void WriteString(const char* pData, size_t size);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Logger name.
+	* @details	Logger name written to file header.
+	******************************************************************************************************/
+	std::string m_loggerName;
+
+	/**************************************************************************************************//**
+	* @brief		Log file.
+	* @details	Log file path.
+	******************************************************************************************************/
+	std::string m_logFile;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum log file size.
+	* @details	Maximum size of one log file (in bytes).
+	******************************************************************************************************/
+	size_t m_maxLogFileSize;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum log files.
+	* @details	Maximum number of log files.
+	******************************************************************************************************/
+	size_t m_maxLogFiles;
+
+	/**************************************************************************************************//**
+	* @brief		Site registry.
+	* @details	Call site registry.
+	******************************************************************************************************/
+	std::shared_ptr<MsvBinaryLogSiteRegistry> m_spSiteRegistry;
+
+	/**************************************************************************************************//**
+	* @brief		File helper.
+	* @details	Current log file.
+	******************************************************************************************************/
+	spdlog::details::file_helper m_file;
+
+	/**************************************************************************************************//**
+	* @brief		Current file size.
+	* @details	Size of current log file (in bytes).
+	******************************************************************************************************/
+	size_t m_fileSize;
+
+	/**************************************************************************************************//**
+	* @brief		Buffer.
+	* @details	Buffer of encoded data (it is reused by all records).
+	******************************************************************************************************/
+	spdlog::memory_buf_t m_buffer;
+
+	/**************************************************************************************************//**
+	* @brief		Written sites.
+	* @details	Flags of sites whose definitions are in current file (index is site ID).
+	******************************************************************************************************/
+	std::vector<bool> m_writtenSites;
+
+	/**************************************************************************************************//**
+	* @brief		Previous time.
+	* @details	Time of previous record in current file (ns since epoch).
+	******************************************************************************************************/
+	int64_t m_previousTime;
+};
+
+
+#endif // !MARSTECH_BINARYFILESINK_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,411 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Binary Log
+* @details		Contains binary log argument encoding and MSV_BLOG_* macros.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_BINARYLOG_H
+#define MARSTECH_BINARYLOG_H
+
+
+#include "IMsvBinaryLogger.h"
+#include "MsvLogMacros.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Stack buffer size.
+* @details	Encoded records up to this size are built on stack (without allocation).
+******************************************************************************************************/
+#define MSV_BLOG_STACK_BUFFER_SIZE 256
+
+
+/**************************************************************************************************//**
+* @brief			Write varint.
+* @details		Writes unsigned integer in variable length encoding (7 bits per byte, LEB128).
+* @param[out]	pBuffer				Buffer (at least 10 bytes).
+* @param[in]	value					Value to write.
+* @returns		char*					Pointer behind written value.
+******************************************************************************************************/
+inline char* MsvBinaryLogWriteVarint(char* pBuffer, uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		*pBuffer++ = static_cast<char>((value & 0x7F) | 0x80);
+		value >>= 7;
+	}
+
+	*pBuffer++ = static_cast<char>(value);
+
+	return pBuffer;
+}
+
+/**************************************************************************************************//**
+* @brief				Read varint.
+* @details			Reads unsigned integer written by @ref MsvBinaryLogWriteVarint.
+* @param[in,out]	pBuffer				Buffer (moved behind read value).
+* @param[in]		pEnd					Buffer end.
+* @param[out]		value					Read value.
+* @returns			bool
+* @retval			true					On success.
+* @retval			false					When buffer is too short or value is corrupted.
+******************************************************************************************************/
+inline bool MsvBinaryLogReadVarint(const char*& pBuffer, const char* pEnd, uint64_t& value)
+{
+	value = 0;
+
+	for (uint32_t shift = 0; shift < 64 && pBuffer < pEnd; shift += 7)
+	{
+		uint8_t byte = static_cast<uint8_t>(*pBuffer++);
+		value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+		if (!(byte & 0x80))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**************************************************************************************************//**
+* @brief			Zigzag encode.
+* @details		Maps signed integer to unsigned one (small absolute values to small values).
+* @param[in]	value					Signed value.
+* @returns		uint64_t
+******************************************************************************************************/
+inline uint64_t MsvBinaryLogZigzagEncode(int64_t value)
+{
+	return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+/**************************************************************************************************//**
+* @brief			Zigzag decode.
+* @details		Reverts @ref MsvBinaryLogZigzagEncode.
+* @param[in]	value					Unsigned value.
+* @returns		int64_t
+******************************************************************************************************/
+inline int64_t MsvBinaryLogZigzagDecode(uint64_t value)
+{
+	return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Binary Log Argument.
+* @details	Encoding of one log argument type. TYPE is stored in site definition, encoded value in
+*				each log record. Supported types are integers, enums, bool, char, floating point numbers,
+*				pointers and strings. Other types fail to compile.
+* @note		Type characters: i - signed integer (zigzag varint), u - unsigned integer (varint),
+*				b - bool, c - char, d - double, p - pointer (varint), s - string (varint length and bytes).
+******************************************************************************************************/
+template<typename T, typename Enable = void>
+struct MsvBinaryLogArg;
+
+/**************************************************************************************************//**
+* @brief		Signed integer argument.
+******************************************************************************************************/
+template<typename T>
+struct MsvBinaryLogArg<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value && !std::is_same<T, char>::value>::type>
+{
+	static const char TYPE = 'i';
+	static size_t MaxSize(T) { return 10; }
+	static char* Encode(char* pBuffer, T value) { return MsvBinaryLogWriteVarint(pBuffer, MsvBinaryLogZigzagEncode(static_cast<int64_t>(value))); }
+};
+
+/**************************************************************************************************//**
+* @brief		Unsigned integer argument.
+******************************************************************************************************/
+template<typename T>
+struct MsvBinaryLogArg<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value>::type>
+{
+	static const char TYPE = 'u';
+	static size_t MaxSize(T) { return 10; }
+	static char* Encode(char* pBuffer, T value) { return MsvBinaryLogWriteVarint(pBuffer, static_cast<uint64_t>(value)); }
+};
+
+/**************************************************************************************************//**
+* @brief		Enum argument (encoded as its underlying type).
+******************************************************************************************************/
+template<typename T>
+struct MsvBinaryLogArg<T, typename std::enable_if<std::is_enum<T>::value>::type>
+{
+	typedef MsvBinaryLogArg<typename std::underlying_type<T>::type> Underlying;
+	static const char TYPE = Underlying::TYPE;
+	static size_t MaxSize(T) { return 10; }
+	static char* Encode(char* pBuffer, T value) { return Underlying::Encode(pBuffer, static_cast<typename std::underlying_type<T>::type>(value)); }
+};
+
+/**************************************************************************************************//**
+* @brief		Bool argument.
+******************************************************************************************************/
+template<>
+struct MsvBinaryLogArg<bool>
+{
+	static const char TYPE = 'b';
+	static size_t MaxSize(bool) { return 1; }
+	static char* Encode(char* pBuffer, bool value) { *pBuffer = value ? 1 : 0; return pBuffer + 1; }
+};
+
+/**************************************************************************************************//**
+* @brief		Char argument.
+******************************************************************************************************/
+template<>
+struct MsvBinaryLogArg<char>
+{
+	static const char TYPE = 'c';
+	static size_t MaxSize(char) { return 1; }
+	static char* Encode(char* pBuffer, char value) { *pBuffer = value; return pBuffer + 1; }
+};
+
+/**************************************************************************************************//**
+* @brief		Floating point argument (encoded as double).
+******************************************************************************************************/
+template<typename T>
+struct MsvBinaryLogArg<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+	static const char TYPE = 'd';
+	static size_t MaxSize(T) { return sizeof(double); }
+	static char* Encode(char* pBuffer, T value) { double doubleValue = static_cast<double>(value); std::memcpy(pBuffer, &doubleValue, sizeof(double)); return pBuffer + sizeof(double); }
+};
+
+/**************************************************************************************************//**
+* @brief		C string argument.
+******************************************************************************************************/
+template<>
+struct MsvBinaryLogArg<const char*>
+{
+	static const char TYPE = 's';
+	static size_t MaxSize(const char* value) { return 10 + (value ? std::strlen(value) : 0); }
+	static char* Encode(char* pBuffer, const char* value)
+	{
+		size_t size = value ? std::strlen(value) : 0;
+		pBuffer = MsvBinaryLogWriteVarint(pBuffer, size);
+		std::memcpy(pBuffer, value, size);
+		return pBuffer + size;
+	}
+};
+
+/**************************************************************************************************//**
+* @brief		C string argument (non const).
+******************************************************************************************************/
+template<>
+struct MsvBinaryLogArg<char*>:
+	public MsvBinaryLogArg<const char*>
+{
+};
+
+/**************************************************************************************************//**
+* @brief		String argument.
+******************************************************************************************************/
+template<>
+struct MsvBinaryLogArg<std::string>
+{
+	static const char TYPE = 's';
+	static size_t MaxSize(const std::string& value) { return 10 + value.size(); }
+	static char* Encode(char* pBuffer, const std::string& value)
+	{
+		pBuffer = MsvBinaryLogWriteVarint(pBuffer, value.size());
+		std::memcpy(pBuffer, value.data(), value.size());
+		return pBuffer + value.size();
+	}
+};
+
+/**************************************************************************************************//**
+* @brief		Pointer argument (address is logged).
+******************************************************************************************************/
+template<typename T>
+struct MsvBinaryLogArg<T*, typename std::enable_if<!std::is_same<typename std::remove_cv<T>::type, char>::value>::type>
+{
+	static const char TYPE = 'p';
+	static size_t MaxSize(const T*) { return 10; }
+	static char* Encode(char* pBuffer, const T* value) { return MsvBinaryLogWriteVarint(pBuffer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value))); }
+};
+
+
+/**************************************************************************************************//**
+* @brief			Get argument types.
+* @details		Returns argument types of call site (one character per argument).
+* @returns		const char*
+******************************************************************************************************/
+template<typename... Args>
+const char* MsvBinaryLogArgTypes()
+{
+	static const char argTypes[] = {MsvBinaryLogArg<typename std::decay<Args>::type>::TYPE..., '\0'};
+	return argTypes;
+}
+
+/**************************************************************************************************//**
+* @brief			Get maximum record size.
+* @details		Returns maximum size of encoded arguments.
+* @returns		size_t
+******************************************************************************************************/
+inline size_t MsvBinaryLogMaxSize()
+{
+	return 0;
+}
+
+/**************************************************************************************************//**
+* @copydoc MsvBinaryLogMaxSize()
+******************************************************************************************************/
+template<typename Arg, typename... Args>
+size_t MsvBinaryLogMaxSize(const Arg& arg, const Args&... args)
+{
+	return MsvBinaryLogArg<typename std::decay<Arg>::type>::MaxSize(arg) + MsvBinaryLogMaxSize(args...);
+}
+
+/**************************************************************************************************//**
+* @brief			Encode arguments.
+* @details		Encodes arguments to buffer.
+* @param[out]	pBuffer				Buffer (at least @ref MsvBinaryLogMaxSize bytes).
+* @returns		char*					Pointer behind encoded arguments.
+******************************************************************************************************/
+inline char* MsvBinaryLogEncode(char* pBuffer)
+{
+	return pBuffer;
+}
+
+/**************************************************************************************************//**
+* @copydoc MsvBinaryLogEncode(char* pBuffer)
+******************************************************************************************************/
+template<typename Arg, typename... Args>
+char* MsvBinaryLogEncode(char* pBuffer, const Arg& arg, const Args&... args)
+{
+	return MsvBinaryLogEncode(MsvBinaryLogArg<typename std::decay<Arg>::type>::Encode(pBuffer, arg), args...);
+}
+
+/**************************************************************************************************//**
+* @brief			Binary log.
+* @details		Registers call site (first call only), encodes site ID and arguments and pushes record
+*					to binary logger. Format string is not processed.
+* @param[in]	logger				Binary logger.
+* @param[in]	site					Call site (static).
+* @param[in]	args					Log arguments.
+******************************************************************************************************/
+template<typename... Args>
+void MsvBinaryLog(IMsvBinaryLogger& logger, MsvBinaryLogSite& site, const Args&... args)
+{
+	uint32_t siteId = site.id.load(std::memory_order_acquire);
+	if (!siteId)
+	{
+		siteId = logger.RegisterSite(site, MsvBinaryLogArgTypes<Args...>());
+		if (!siteId)
+		{
+			return;
+		}
+	}
+
+	char buffer[MSV_BLOG_STACK_BUFFER_SIZE];
+	std::unique_ptr<char[]> spBuffer;
+	char* pRecord = buffer;
+
+	size_t maxSize = 10 + MsvBinaryLogMaxSize(args...);
+	if (maxSize > sizeof(buffer))
+	{
+		spBuffer.reset(new (std::nothrow) char[maxSize]);
+		if (!spBuffer)
+		{
+			return;
+		}
+
+		pRecord = spBuffer.get();
+	}
+
+	char* pEnd = MsvBinaryLogEncode(MsvBinaryLogWriteVarint(pRecord, siteId), args...);
+	logger.Log(site.level, pRecord, static_cast<size_t>(pEnd - pRecord));
+}
+
+
+/**************************************************************************************************//**
+* @brief		Binary log macro.
+* @details	Logs with binary logger (shared pointer to @ref IMsvBinaryLogger). Format string must be
+*				string literal (fmt syntax), it is stored to log file only once.
+******************************************************************************************************/
+#define MSV_BLOG(spLogger, logLevel, format, ...) \
+	do \
+	{ \
+		if (spLogger && spLogger->ShouldLog(logLevel)) \
+		{ \
+			static MsvBinaryLogSite msvBinaryLogSite{format, __FILE__, __LINE__, logLevel, {0}}; \
+			MsvBinaryLog(*spLogger, msvBinaryLogSite, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+#define MSV_BLOG_DISABLED(spLogger) MSV_LOG_DISABLED(spLogger)				///< Binary log call removed at compile time (see @ref MSV_LOG_ACTIVE_LEVEL).
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_TRACE
+#define MSV_BLOG_TRACE(spLogger, format, ...) MSV_BLOG(spLogger, spdlog::level::trace, format, ##__VA_ARGS__)			///< Binary log trace.
+#else
+#define MSV_BLOG_TRACE(spLogger, format, ...) MSV_BLOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_DEBUG
+#define MSV_BLOG_DEBUG(spLogger, format, ...) MSV_BLOG(spLogger, spdlog::level::debug, format, ##__VA_ARGS__)			///< Binary log debug.
+#else
+#define MSV_BLOG_DEBUG(spLogger, format, ...) MSV_BLOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_INFO
+#define MSV_BLOG_INFO(spLogger, format, ...) MSV_BLOG(spLogger, spdlog::level::info, format, ##__VA_ARGS__)				///< Binary log info.
+#else
+#define MSV_BLOG_INFO(spLogger, format, ...) MSV_BLOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_WARN
+#define MSV_BLOG_WARN(spLogger, format, ...) MSV_BLOG(spLogger, spdlog::level::warn, format, ##__VA_ARGS__)				///< Binary log warning.
+#else
+#define MSV_BLOG_WARN(spLogger, format, ...) MSV_BLOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_ERROR
+#define MSV_BLOG_ERROR(spLogger, format, ...) MSV_BLOG(spLogger, spdlog::level::err, format, ##__VA_ARGS__)				///< Binary log error.
+#else
+#define MSV_BLOG_ERROR(spLogger, format, ...) MSV_BLOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_CRITICAL
+#define MSV_BLOG_CRITICAL(spLogger, format, ...) MSV_BLOG(spLogger, spdlog::level::critical, format, ##__VA_ARGS__)	///< Binary log critical.
+#else
+#define MSV_BLOG_CRITICAL(spLogger, format, ...) MSV_BLOG_DISABLED(spLogger)
+#endif
+
+
+#endif // !MARSTECH_BINARYLOG_H
+
+/** @} */	//End of group MSYS.
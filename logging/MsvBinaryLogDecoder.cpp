@@ -0,0 +1,308 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Binary Log Decoder
+* @details		Contains implementation of binary log decoder.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvBinaryLogDecoder.h"
+#include "MsvBinaryFileSink.h"
+#include "MsvBinaryLog.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include <spdlog/details/os.h>
+#include <spdlog/fmt/fmt.h>
+#ifdef SPDLOG_FMT_EXTERNAL
+#include <fmt/args.h>
+#else
+#include <spdlog/fmt/bundled/args.h>
+#endif
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvBinaryLogDecoder::MsvBinaryLogDecoder():
+	m_previousTime(0)
+{
+
+}
+
+
+MsvBinaryLogDecoder::~MsvBinaryLogDecoder()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvBinaryLogDecoder public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvBinaryLogDecoder::DecodeFile(const char* binaryLogFile, std::ostream& output)
+{
+	std::ifstream file(binaryLogFile, std::ios::binary);
+	if (!file)
+	{
+		return MSV_NOT_FOUND_ERROR;
+	}
+
+	std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	return Decode(data.data(), data.size(), output);
+}
+
+MsvErrorCode MsvBinaryLogDecoder::Decode(const char* pData, size_t size, std::ostream& output)
+{
+	const char* pEnd = pData + size;
+
+	if (size < MSV_BLOG_FILE_MAGIC_SIZE || std::memcmp(pData, MSV_BLOG_FILE_MAGIC, MSV_BLOG_FILE_MAGIC_SIZE) != 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+	pData += MSV_BLOG_FILE_MAGIC_SIZE;
+
+	if (!ReadString(pData, pEnd, m_loggerName))
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	m_sites.clear();
+	m_previousTime = 0;
+
+	while (pData < pEnd)
+	{
+		char tag = *pData++;
+
+		if (tag == MSV_BLOG_SITE_TAG)
+		{
+			MSV_RETURN_FAILED(DecodeSite(pData, pEnd));
+		}
+		else if (tag == MSV_BLOG_RECORD_TAG)
+		{
+			MSV_RETURN_FAILED(DecodeRecord(pData, pEnd, output));
+		}
+		else
+		{
+			return MSV_INVALID_DATA_ERROR;
+		}
+	}
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvBinaryLogDecoder protected methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvBinaryLogDecoder::DecodeSite(const char*& pData, const char* pEnd)
+{
+	MsvBinaryLogSiteDefinition site;
+	uint64_t id = 0;
+	uint64_t line = 0;
+
+	if (!MsvBinaryLogReadVarint(pData, pEnd, id) || pData >= pEnd)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	site.id = static_cast<uint32_t>(id);
+	site.level = static_cast<MsvLogLevel>(*pData++);
+
+	if (!MsvBinaryLogReadVarint(pData, pEnd, line) || !ReadString(pData, pEnd, site.file) || !ReadString(pData, pEnd, site.format) || !ReadString(pData, pEnd, site.argTypes))
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	site.line = static_cast<uint32_t>(line);
+	m_sites[site.id] = site;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvBinaryLogDecoder::DecodeRecord(const char*& pData, const char* pEnd, std::ostream& output)
+{
+	uint64_t siteId = 0;
+	uint64_t timeDifference = 0;
+	uint64_t threadId = 0;
+	uint64_t argsSize = 0;
+
+	if (!MsvBinaryLogReadVarint(pData, pEnd, siteId) || !MsvBinaryLogReadVarint(pData, pEnd, timeDifference) || !MsvBinaryLogReadVarint(pData, pEnd, threadId) || !MsvBinaryLogReadVarint(pData, pEnd, argsSize))
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (argsSize > static_cast<uint64_t>(pEnd - pData))
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::map<uint32_t, MsvBinaryLogSiteDefinition>::const_iterator site = m_sites.find(static_cast<uint32_t>(siteId));
+	if (site == m_sites.end())
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	const char* pArgs = pData;
+	pData += argsSize;
+
+	std::string message;
+	MSV_RETURN_FAILED(FormatMessage(site->second, pArgs, pData, message));
+
+	m_previousTime += MsvBinaryLogZigzagDecode(timeDifference);
+	std::chrono::system_clock::time_point time{std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(m_previousTime))};
+	std::tm tm = spdlog::details::os::localtime(std::chrono::system_clock::to_time_t(time));
+	int64_t milliseconds = (m_previousTime / 1000000) % 1000;
+
+	spdlog::string_view_t levelName = spdlog::level::to_string_view(site->second.level);
+
+	output << fmt::format("[{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:03}] [{}] [{}] {}\n", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, milliseconds, m_loggerName, std::string(levelName.data(), levelName.size()), message);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvBinaryLogDecoder::FormatMessage(const MsvBinaryLogSiteDefinition& site, const char* pArgs, const char* pArgsEnd, std::string& message) const
+{
+	fmt::dynamic_format_arg_store<fmt::format_context> args;
+
+	for (char argType: site.argTypes)
+	{
+		uint64_t value = 0;
+
+		switch (argType)
+		{
+		case 'i':
+			if (!MsvBinaryLogReadVarint(pArgs, pArgsEnd, value))
+			{
+				return MSV_INVALID_DATA_ERROR;
+			}
+			args.push_back(MsvBinaryLogZigzagDecode(value));
+			break;
+		case 'u':
+			if (!MsvBinaryLogReadVarint(pArgs, pArgsEnd, value))
+			{
+				return MSV_INVALID_DATA_ERROR;
+			}
+			args.push_back(value);
+			break;
+		case 'p':
+			if (!MsvBinaryLogReadVarint(pArgs, pArgsEnd, value))
+			{
+				return MSV_INVALID_DATA_ERROR;
+			}
+			args.push_back(reinterpret_cast<const void*>(static_cast<uintptr_t>(value)));
+			break;
+		case 'b':
+		case 'c':
+			if (pArgs >= pArgsEnd)
+			{
+				return MSV_INVALID_DATA_ERROR;
+			}
+			if (argType == 'b')
+			{
+				args.push_back(*pArgs != 0);
+			}
+			else
+			{
+				args.push_back(*pArgs);
+			}
+			++pArgs;
+			break;
+		case 'd':
+		{
+			if (pArgsEnd - pArgs < static_cast<ptrdiff_t>(sizeof(double)))
+			{
+				return MSV_INVALID_DATA_ERROR;
+			}
+			double doubleValue = 0;
+			std::memcpy(&doubleValue, pArgs, sizeof(double));
+			args.push_back(doubleValue);
+			pArgs += sizeof(double);
+			break;
+		}
+		case 's':
+		{
+			std::string stringValue;
+			if (!ReadString(pArgs, pArgsEnd, stringValue))
+			{
+				return MSV_INVALID_DATA_ERROR;
+			}
+			args.push_back(stringValue);
+			break;
+		}
+		default:
+			return MSV_INVALID_DATA_ERROR;
+		}
+	}
+
+	try
+	{
+		message = fmt::vformat(site.format, args);
+	}
+	catch (const fmt::format_error&)
+	{
+		//invalid format string -> write it unformatted
+		message = site.format;
+	}
+
+	return MSV_SUCCESS;
+}
+
+bool MsvBinaryLogDecoder::ReadString(const char*& pData, const char* pEnd, std::string& value)
+{
+	uint64_t size = 0;
+	if (!MsvBinaryLogReadVarint(pData, pEnd, size) || size > static_cast<uint64_t>(pEnd - pData))
+	{
+		return false;
+	}
+
+	value.assign(pData, static_cast<size_t>(size));
+	pData += size;
+
+	return true;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,160 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Binary Log Decoder
+* @details		Contains definition of binary log decoder.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_BINARYLOGDECODER_H
+#define MARSTECH_BINARYLOGDECODER_H
+
+
+#include "MsvBinaryLogSiteRegistry.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <map>
+#include <ostream>
+#include <string>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Binary Log Decoder.
+* @details	Decodes binary log files written by @ref MsvBinaryFileSink to text. Each record is written as
+*				one line in format "[date time.ms] [logger] [level] message" (same as default file logger).
+******************************************************************************************************/
+class MsvBinaryLogDecoder
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvBinaryLogDecoder();
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	******************************************************************************************************/
+	~MsvBinaryLogDecoder();
+
+	/**************************************************************************************************//**
+	* @brief			Decode file.
+	* @details		Decodes binary log file and writes text lines to output.
+	* @param[in]	binaryLogFile				Binary log file path.
+	* @param[out]	output						Text output.
+	* @retval		MSV_NOT_FOUND_ERROR		When binary log file could not be read.
+	* @retval		MSV_INVALID_DATA_ERROR	When file is not binary log file or it is corrupted (all records
+	*													before corrupted part are written).
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode DecodeFile(const char* binaryLogFile, std::ostream& output);
+
+	/**************************************************************************************************//**
+	* @brief			Decode.
+	* @details		Decodes binary log data and writes text lines to output.
+	* @param[in]	pData							Binary log data (whole file).
+	* @param[in]	size							Binary log data size.
+	* @param[out]	output						Text output.
+	* @retval		MSV_INVALID_DATA_ERROR	When data are not binary log or they are corrupted (all records
+	*													before corrupted part are written).
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode Decode(const char* pData, size_t size, std::ostream& output);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief				Decode site.
+	* @details			Reads site definition.
+	* @param[in,out]	pData							Data (moved behind site definition).
+	* @param[in]		pEnd							Data end.
+	* @retval			MSV_INVALID_DATA_ERROR	When data are corrupted.
+	* @retval			MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode DecodeSite(const char*& pData, const char* pEnd);
+
+	/**************************************************************************************************//**
+	* @brief				Decode record.
+	* @details			Reads log record and writes it to output.
+	* @param[in,out]	pData							Data (moved behind record).
+	* @param[in]		pEnd							Data end.
+	* @param[out]		output						Text output.
+	* @retval			MSV_INVALID_DATA_ERROR	When data are corrupted or site is unknown.
+	* @retval			MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode DecodeRecord(const char*& pData, const char* pEnd, std::ostream& output);
+
+	/**************************************************************************************************//**
+	* @brief			Format message.
+	* @details		Decodes arguments and formats message by site format string.
+	* @param[in]	site							Site definition.
+	* @param[in]	pArgs							Encoded arguments.
+	* @param[in]	pArgsEnd						Encoded arguments end.
+	* @param[out]	message						Formatted message.
+	* @retval		MSV_INVALID_DATA_ERROR	When arguments are corrupted.
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode FormatMessage(const MsvBinaryLogSiteDefinition& site, const char* pArgs, const char* pArgsEnd, std::string& message) const;
+
+	/**************************************************************************************************//**
+	* @brief				Read string.
+	* @details			Reads varint size and string bytes.
+	* @param[in,out]	pData							Data (moved behind string).
+	* @param[in]		pEnd							Data end.
+	* @param[out]		value							Read string.
+	* @returns			bool
+	* @retval			true							On success.
+	* @retval			false							When data are corrupted.
+	******************************************************************************************************/
+	static bool ReadString(const char*& pData, const char* pEnd, std::string& value);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Logger name.
+	* @details	Logger name from file header.
+	******************************************************************************************************/
+	std::string m_loggerName;
+
+	/**************************************************************************************************//**
+	* @brief		Sites.
+	* @details	Site definitions read from file (key is site ID).
+	******************************************************************************************************/
+	std::map<uint32_t, MsvBinaryLogSiteDefinition> m_sites;
+
+	/**************************************************************************************************//**
+	* @brief		Previous time.
+	* @details	Time of previous record (ns since epoch).
+	******************************************************************************************************/
+	int64_t m_previousTime;
+};
+
+
+#endif // !MARSTECH_BINARYLOGDECODER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,101 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Binary Log Site Registry
+* @details		Contains implementation of binary log site registry.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvBinaryLogSiteRegistry.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvBinaryLogSiteRegistry::MsvBinaryLogSiteRegistry()
+{
+
+}
+
+
+MsvBinaryLogSiteRegistry::~MsvBinaryLogSiteRegistry()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvBinaryLogSiteRegistry public methods
+********************************************************************************************************************************/
+
+
+uint32_t MsvBinaryLogSiteRegistry::RegisterSite(MsvBinaryLogSite& site, const char* argTypes)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	//more threads might log from one call site at the same time
+	uint32_t siteId = site.id.load(std::memory_order_acquire);
+	if (siteId)
+	{
+		return siteId;
+	}
+
+	try
+	{
+		m_sites.push_back(MsvBinaryLogSiteDefinition{static_cast<uint32_t>(m_sites.size() + 1), site.level, site.line, site.file, site.format, argTypes});
+	}
+	catch (const std::bad_alloc&)
+	{
+		return 0;
+	}
+
+	siteId = m_sites.back().id;
+	site.id.store(siteId, std::memory_order_release);
+
+	return siteId;
+}
+
+MsvErrorCode MsvBinaryLogSiteRegistry::GetSite(uint32_t siteId, MsvBinaryLogSiteDefinition& definition) const
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (siteId == 0 || siteId > m_sites.size())
+	{
+		return MSV_NOT_FOUND_ERROR;
+	}
+
+	definition = m_sites[siteId - 1];
+
+	return MSV_SUCCESS;
+}
+
+/** @} */	//End of group MSYS.
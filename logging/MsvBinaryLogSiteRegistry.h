@@ -0,0 +1,114 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Binary Log Site Registry
+* @details		Contains definition of binary log site registry.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_BINARYLOGSITEREGISTRY_H
+#define MARSTECH_BINARYLOGSITEREGISTRY_H
+
+
+#include "IMsvBinaryLogger.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <deque>
+#include <mutex>
+#include <string>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Binary Log Site Definition.
+* @details	Copy of registered call site (it is written to binary log file and read by decoder).
+******************************************************************************************************/
+struct MsvBinaryLogSiteDefinition
+{
+	uint32_t id;													///< Site ID.
+	MsvLogLevel level;											///< Log level.
+	uint32_t line;													///< Source line.
+	std::string file;												///< Source file.
+	std::string format;											///< Format string.
+	std::string argTypes;										///< Argument types (see @ref MsvBinaryLogArg).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Binary Log Site Registry.
+* @details	Assigns IDs to binary log call sites. It is shared by all binary loggers (one call site has
+*				same ID in all binary log files).
+******************************************************************************************************/
+class MsvBinaryLogSiteRegistry
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvBinaryLogSiteRegistry();
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	******************************************************************************************************/
+	~MsvBinaryLogSiteRegistry();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvBinaryLogger::RegisterSite(MsvBinaryLogSite& site, const char* argTypes)
+	******************************************************************************************************/
+	uint32_t RegisterSite(MsvBinaryLogSite& site, const char* argTypes);
+
+	/**************************************************************************************************//**
+	* @brief			Get site.
+	* @details		Returns definition of registered site.
+	* @param[in]	siteId				Site ID.
+	* @param[out]	definition			Site definition.
+	* @retval		MSV_NOT_FOUND_ERROR		When site with the ID has not been registered.
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode GetSite(uint32_t siteId, MsvBinaryLogSiteDefinition& definition) const;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	mutable std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Sites.
+	* @details	Registered sites (index is site ID - 1).
+	******************************************************************************************************/
+	std::deque<MsvBinaryLogSiteDefinition> m_sites;
+};
+
+
+#endif // !MARSTECH_BINARYLOGSITEREGISTRY_H
+
+/** @} */	//End of group MSYS.
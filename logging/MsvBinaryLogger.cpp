@@ -0,0 +1,90 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Binary Logger Implementation
+* @details		Contains implementation of binary logger.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvBinaryLogger.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvBinaryLogger::MsvBinaryLogger(const std::string& loggerName, std::shared_ptr<MsvAsyncLogBackend> spBackend, uint32_t targetId, std::shared_ptr<MsvBinaryLogSiteRegistry> spSiteRegistry):
+	m_loggerName(loggerName),
+	m_spBackend(spBackend),
+	m_targetId(targetId),
+	m_spSiteRegistry(spSiteRegistry),
+	m_logLevel(spdlog::level::info)
+{
+
+}
+
+
+MsvBinaryLogger::~MsvBinaryLogger()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															IMsvBinaryLogger public methods
+********************************************************************************************************************************/
+
+
+bool MsvBinaryLogger::ShouldLog(MsvLogLevel logLevel) const
+{
+	return static_cast<int>(logLevel) >= m_logLevel.load(std::memory_order_relaxed);
+}
+
+void MsvBinaryLogger::SetLogLevel(MsvLogLevel logLevel)
+{
+	m_logLevel.store(static_cast<int>(logLevel), std::memory_order_relaxed);
+}
+
+uint32_t MsvBinaryLogger::RegisterSite(MsvBinaryLogSite& site, const char* argTypes)
+{
+	return m_spSiteRegistry->RegisterSite(site, argTypes);
+}
+
+void MsvBinaryLogger::Log(MsvLogLevel logLevel, const char* pRecord, size_t recordSize)
+{
+	//record stores timestamp ticks (wall time is not read in log call)
+	m_spBackend->Push(m_targetId, logLevel, pRecord, recordSize);
+}
+
+MsvErrorCode MsvBinaryLogger::Flush()
+{
+	return m_spBackend->Flush();
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,134 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Binary Logger Implementation
+* @details		Contains definition of binary logger.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_BINARYLOGGER_H
+#define MARSTECH_BINARYLOGGER_H
+
+
+#include "IMsvBinaryLogger.h"
+#include "MsvAsyncLogBackend.h"
+#include "MsvBinaryLogSiteRegistry.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+#include <string>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Binary Logger Implementation.
+* @details	Implementation of binary logger interface. Encoded records are pushed to @ref MsvAsyncLogBackend
+*				and written by @ref MsvBinaryFileSink in background thread.
+* @see		IMsvBinaryLogger
+******************************************************************************************************/
+class MsvBinaryLogger:
+	public IMsvBinaryLogger
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	loggerName				Logger name.
+	* @param[in]	spBackend				Async log backend.
+	* @param[in]	targetId					Target ID (binary file sink) in backend.
+	* @param[in]	spSiteRegistry			Call site registry.
+	******************************************************************************************************/
+	MsvBinaryLogger(const std::string& loggerName, std::shared_ptr<MsvAsyncLogBackend> spBackend, uint32_t targetId, std::shared_ptr<MsvBinaryLogSiteRegistry> spSiteRegistry);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvBinaryLogger();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvBinaryLogger::ShouldLog(MsvLogLevel logLevel) const
+	******************************************************************************************************/
+	virtual bool ShouldLog(MsvLogLevel logLevel) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvBinaryLogger::SetLogLevel(MsvLogLevel logLevel)
+	******************************************************************************************************/
+	virtual void SetLogLevel(MsvLogLevel logLevel) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvBinaryLogger::RegisterSite(MsvBinaryLogSite& site, const char* argTypes)
+	******************************************************************************************************/
+	virtual uint32_t RegisterSite(MsvBinaryLogSite& site, const char* argTypes) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvBinaryLogger::Log(MsvLogLevel logLevel, const char* pRecord, size_t recordSize)
+	******************************************************************************************************/
+	virtual void Log(MsvLogLevel logLevel, const char* pRecord, size_t recordSize) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvBinaryLogger::Flush()
+	******************************************************************************************************/
+	virtual MsvErrorCode Flush() override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Logger name.
+	* @details	Name of this logger.
+	******************************************************************************************************/
+	std::string m_loggerName;
+
+	/**************************************************************************************************//**
+	* @brief		Backend.
+	* @details	Async log backend.
+	******************************************************************************************************/
+	std::shared_ptr<MsvAsyncLogBackend> m_spBackend;
+
+	/**************************************************************************************************//**
+	* @brief		Target ID.
+	* @details	Target ID (binary file sink) in backend.
+	******************************************************************************************************/
+	uint32_t m_targetId;
+
+	/**************************************************************************************************//**
+	* @brief		Site registry.
+	* @details	Call site registry.
+	******************************************************************************************************/
+	std::shared_ptr<MsvBinaryLogSiteRegistry> m_spSiteRegistry;
+
+	/**************************************************************************************************//**
+	* @brief		Log level.
+	* @details	Minimal log level (it is read without locking).
+	******************************************************************************************************/
+	std::atomic<int> m_logLevel;
+};
+
+
+#endif // !MARSTECH_BINARYLOGGER_H
+
+/** @} */	//End of group MSYS.
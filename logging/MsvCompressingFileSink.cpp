@@ -0,0 +1,142 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Compressing File Sink
+* @details		Contains implementation of @ref MsvCompressingFileSink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvCompressingFileSink.h"
+
+#include "MsvLogRotator.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <spdlog/details/os.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvCompressingFileSink::MsvCompressingFileSink(const std::string& logFile, size_t maxLogFileSize, uint64_t maxCompressedLogsSize, std::shared_ptr<MsvLogCompressor> spCompressor):
+	m_logFile(logFile),
+	m_maxLogFileSize(maxLogFileSize),
+	m_maxCompressedLogsSize(maxCompressedLogsSize),
+	m_spCompressor(spCompressor),
+	m_fileSize(0),
+	m_rotationsCount(0)
+{
+
+}
+
+
+MsvCompressingFileSink::~MsvCompressingFileSink()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvCompressingFileSink public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvCompressingFileSink::Initialize()
+{
+	//rotated files of crashed process are compressed (rotations continue with their numbers)
+	m_rotationsCount = MsvLogRotator::RecoverFiles(m_logFile, 0, m_spCompressor, m_maxCompressedLogsSize);
+
+	try
+	{
+		m_file.open(m_logFile, false);
+		m_fileSize = m_file.size();
+	}
+	catch (const spdlog::spdlog_ex&)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvCompressingFileSink protected methods
+********************************************************************************************************************************/
+
+
+void MsvCompressingFileSink::sink_it_(const spdlog::details::log_msg& msg)
+{
+	spdlog::memory_buf_t formatted;
+	formatter_->format(msg, formatted);
+
+	try
+	{
+		if (m_fileSize > 0 && m_fileSize + formatted.size() > m_maxLogFileSize)
+		{
+			RotateFile();
+		}
+
+		m_file.write(formatted);
+		m_fileSize += formatted.size();
+	}
+	catch (const spdlog::spdlog_ex&)
+	{
+		//write failed -> record is lost
+	}
+}
+
+void MsvCompressingFileSink::flush_()
+{
+	m_file.flush();
+}
+
+void MsvCompressingFileSink::RotateFile()
+{
+	m_file.close();
+
+	//rename is cheap, compression is done by compressor thread (rotations count is unique, so no file is overwritten)
+	std::string rotatedFile = m_logFile + ".rotated." + std::to_string(++m_rotationsCount);
+	bool rotated = spdlog::details::os::rename(m_logFile, rotatedFile) == 0;
+	if (rotated)
+	{
+		m_spCompressor->AddRotatedFile(rotatedFile, m_logFile, m_maxCompressedLogsSize);
+	}
+
+	//file which could not be renamed is not truncated (rotation is tried again after next maxLogFileSize bytes)
+	m_file.reopen(rotated);
+	m_fileSize = 0;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,152 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Compressing File Sink
+* @details		Contains definition of @ref MsvCompressingFileSink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_COMPRESSINGFILESINK_H
+#define MARSTECH_COMPRESSINGFILESINK_H
+
+
+#include "MsvLogCompressor.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+#include <string>
+
+#include <spdlog/details/file_helper.h>
+#include <spdlog/details/null_mutex.h>
+#include <spdlog/sinks/base_sink.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Compressing File Sink.
+* @details	Rotating file sink which does not keep rotated files uncompressed. Full log file is just renamed
+*				and passed to @ref MsvLogCompressor which compresses it in background.
+* @note		It is single threaded sink (it is used by async log backend thread only).
+******************************************************************************************************/
+class MsvCompressingFileSink:
+	public spdlog::sinks::base_sink<spdlog::details::null_mutex>
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	logFile							Log file path.
+	* @param[in]	maxLogFileSize					Maximum size of log file (in bytes).
+	* @param[in]	maxCompressedLogsSize		Maximum size of all compressed rotated files (in bytes).
+	* @param[in]	spCompressor					Log compressor.
+	******************************************************************************************************/
+	MsvCompressingFileSink(const std::string& logFile, size_t maxLogFileSize, uint64_t maxCompressedLogsSize, std::shared_ptr<MsvLogCompressor> spCompressor);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvCompressingFileSink();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize sink.
+	* @details		Queues rotated files of crashed process for compression (see @ref MsvLogRotator::RecoverFiles)
+	*					and opens log file (records are appended to existing file).
+	* @retval		MSV_INVALID_DATA_ERROR		When log file could not be opened.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Sink it.
+	* @details		Formats message and writes it to log file (rotates file when it is full).
+	* @param[in]	msg								Log message.
+	******************************************************************************************************/
+	virtual void sink_it_(const spdlog::details::log_msg& msg) override;
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Flushes log file.
+	******************************************************************************************************/
+	virtual void flush_() override;
+
+	/**************************************************************************************************//**
+	* @brief			Rotate file.
+	* @details		Renames full log file, queues it for compression and opens new log file.
+	******************************************************************************************************/
+	void RotateFile();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Log file.
+	* @details	Log file path.
+	******************************************************************************************************/
+	std::string m_logFile;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum log file size.
+	* @details	Maximum size of log file (in bytes).
+	******************************************************************************************************/
+	size_t m_maxLogFileSize;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum compressed logs size.
+	* @details	Maximum size of all compressed rotated files (in bytes).
+	******************************************************************************************************/
+	uint64_t m_maxCompressedLogsSize;
+
+	/**************************************************************************************************//**
+	* @brief		Log compressor.
+	* @details	Compresses rotated files in background.
+	******************************************************************************************************/
+	std::shared_ptr<MsvLogCompressor> m_spCompressor;
+
+	/**************************************************************************************************//**
+	* @brief		File.
+	* @details	Opened log file.
+	******************************************************************************************************/
+	spdlog::details::file_helper m_file;
+
+	/**************************************************************************************************//**
+	* @brief		File size.
+	* @details	Size of opened log file (in bytes).
+	******************************************************************************************************/
+	size_t m_fileSize;
+
+	/**************************************************************************************************//**
+	* @brief		Rotations count.
+	* @details	Number of rotations (it makes names of rotated files unique).
+	******************************************************************************************************/
+	uint64_t m_rotationsCount;
+};
+
+
+#endif // !MARSTECH_COMPRESSINGFILESINK_H
+
+/** @} */	//End of group MSYS.
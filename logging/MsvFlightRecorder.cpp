@@ -0,0 +1,162 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Flight Recorder
+* @details		Contains implementation of @ref MsvFlightRecorder.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvFlightRecorder.h"
+#include "MsvLogForwardingSink.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvFlightRecorder::MsvFlightRecorder(const char* recorderFile, uint32_t recordsCount):
+	m_recorderFile(recorderFile),
+	m_recordsCount(recordsCount)
+{
+
+}
+
+
+MsvFlightRecorder::~MsvFlightRecorder()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvFlightRecorder public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvFlightRecorder::Initialize()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (m_spSink)
+	{
+		return MSV_ALREADY_INITIALIZED_INFO;
+	}
+
+	std::shared_ptr<MsvFlightRecorderSink> spSink(new (std::nothrow) MsvFlightRecorderSink(m_recorderFile.c_str(), m_recordsCount));
+	if (!spSink)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	MSV_RETURN_FAILED(spSink->Initialize());
+
+	spSink->set_level(spdlog::level::trace);
+	m_spSink = spSink;
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															IMsvFlightRecorder public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvFlightRecorder::AttachLogger(std::shared_ptr<MsvLogger> spLogger)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!spLogger)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (!m_spSink)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	if (m_attachedLoggers.find(spLogger->name()) != m_attachedLoggers.end())
+	{
+		return MSV_ALREADY_EXISTS_ERROR;
+	}
+
+	//logger sinks are not changed (recorder sink is attached to forwarding sink of logger)
+	std::shared_ptr<MsvLogForwardingSink> spForwardingSink = MsvLogForwardingSink::GetForwardingSink(spLogger);
+	if (!spForwardingSink)
+	{
+		return MSV_NOT_FOUND_ERROR;
+	}
+
+	//recorder gets messages of its own level (logger level is lowered to it, logger sinks keep configured level)
+	MSV_RETURN_FAILED(spForwardingSink->AttachSink(m_spSink, false));
+	spForwardingSink->UpdateLoggerLevel(*spLogger);
+
+	m_attachedLoggers[spLogger->name()] = spLogger;
+
+	return MSV_SUCCESS;
+}
+
+void MsvFlightRecorder::SetRecorderLevel(MsvLogLevel logLevel)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!m_spSink)
+	{
+		return;
+	}
+
+	m_spSink->set_level(logLevel);
+
+	for (std::pair<const std::string, std::weak_ptr<MsvLogger>>& attachedLogger: m_attachedLoggers)
+	{
+		std::shared_ptr<MsvLogger> spLogger = attachedLogger.second.lock();
+		std::shared_ptr<MsvLogForwardingSink> spForwardingSink = MsvLogForwardingSink::GetForwardingSink(spLogger);
+		if (spForwardingSink)
+		{
+			spForwardingSink->UpdateLoggerLevel(*spLogger);
+		}
+	}
+}
+
+MsvErrorCode MsvFlightRecorder::Flush()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!m_spSink)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	return m_spSink->FlushPages();
+}
+
+/** @} */	//End of group MSYS.
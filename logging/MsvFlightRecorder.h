@@ -0,0 +1,131 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Flight Recorder
+* @details		Contains definition of @ref MsvFlightRecorder.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_FLIGHTRECORDER_H
+#define MARSTECH_FLIGHTRECORDER_H
+
+
+#include "IMsvFlightRecorder.h"
+#include "MsvFlightRecorderSink.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <map>
+#include <mutex>
+#include <string>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Flight Recorder.
+* @details	Implementation of flight recorder interface. It shares one @ref MsvFlightRecorderSink by all
+*				attached loggers.
+* @see		IMsvFlightRecorder
+******************************************************************************************************/
+class MsvFlightRecorder:
+	public IMsvFlightRecorder
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	recorderFile			Flight recorder file path.
+	* @param[in]	recordsCount			Number of records kept in recorder.
+	******************************************************************************************************/
+	MsvFlightRecorder(const char* recorderFile, uint32_t recordsCount);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvFlightRecorder();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize recorder.
+	* @details		Creates and maps recorder file.
+	* @retval		MSV_ALLOCATION_ERROR			When sink could not be allocated.
+	* @retval		MSV_INVALID_DATA_ERROR		When recorder file could not be created or mapped.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFlightRecorder::AttachLogger(std::shared_ptr<MsvLogger> spLogger)
+	******************************************************************************************************/
+	virtual MsvErrorCode AttachLogger(std::shared_ptr<MsvLogger> spLogger) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFlightRecorder::SetRecorderLevel(MsvLogLevel logLevel)
+	******************************************************************************************************/
+	virtual void SetRecorderLevel(MsvLogLevel logLevel) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFlightRecorder::Flush()
+	******************************************************************************************************/
+	virtual MsvErrorCode Flush() override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	mutable std::recursive_mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Recorder file.
+	* @details	Flight recorder file path.
+	******************************************************************************************************/
+	std::string m_recorderFile;
+
+	/**************************************************************************************************//**
+	* @brief		Records count.
+	* @details	Number of records kept in recorder.
+	******************************************************************************************************/
+	uint32_t m_recordsCount;
+
+	/**************************************************************************************************//**
+	* @brief		Recorder sink.
+	* @details	Sink shared by all attached loggers.
+	******************************************************************************************************/
+	std::shared_ptr<MsvFlightRecorderSink> m_spSink;
+
+	/**************************************************************************************************//**
+	* @brief		Attached loggers.
+	* @details	Attached loggers (key is logger name). Their level is updated when recorder level is changed.
+	******************************************************************************************************/
+	std::map<std::string, std::weak_ptr<MsvLogger>> m_attachedLoggers;
+};
+
+
+#endif // !MARSTECH_FLIGHTRECORDER_H
+
+/** @} */	//End of group MSYS.
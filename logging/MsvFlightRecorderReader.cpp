@@ -0,0 +1,192 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Flight Recorder Reader
+* @details		Contains implementation of @ref MsvFlightRecorderReader.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvFlightRecorderReader.h"
+#include "MsvFlightRecorderSink.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <spdlog/details/os.h>
+#include <spdlog/fmt/fmt.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Flight Recorder Record.
+* @details	Record read from flight recorder slot.
+******************************************************************************************************/
+struct MsvFlightRecorderRecord
+{
+	uint64_t sequence;											///< Record index + 1.
+	int64_t time;													///< Log time (ns since epoch).
+	uint64_t threadId;											///< ID of logging thread.
+	uint8_t level;													///< Log level.
+	const char* pLoggerName;									///< Logger name (in read data).
+	size_t loggerNameSize;										///< Logger name size.
+	const char* pMessage;										///< Message (in read data).
+	size_t messageSize;											///< Message size.
+};
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvFlightRecorderReader::MsvFlightRecorderReader()
+{
+
+}
+
+
+MsvFlightRecorderReader::~MsvFlightRecorderReader()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvFlightRecorderReader public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvFlightRecorderReader::DumpFile(const char* recorderFile, uint32_t lastSeconds, std::ostream& output) const
+{
+	std::ifstream file(recorderFile, std::ios::binary);
+	if (!file)
+	{
+		return MSV_NOT_FOUND_ERROR;
+	}
+
+	std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	return Dump(data.data(), data.size(), lastSeconds, output);
+}
+
+MsvErrorCode MsvFlightRecorderReader::Dump(const char* pData, size_t size, uint32_t lastSeconds, std::ostream& output) const
+{
+	if (size < sizeof(MsvFlightRecorderHeader) || memcmp(pData, MSV_FLIGHT_RECORDER_MAGIC, sizeof(MsvFlightRecorderHeader::magic)) != 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	uint32_t slotSize = 0;
+	uint64_t slotsCount = 0;
+	memcpy(&slotSize, pData + offsetof(MsvFlightRecorderHeader, slotSize), sizeof(slotSize));
+	memcpy(&slotsCount, pData + offsetof(MsvFlightRecorderHeader, slotsCount), sizeof(slotsCount));
+
+	if (slotSize != sizeof(MsvFlightRecorderSlot) || slotsCount > (size - sizeof(MsvFlightRecorderHeader)) / slotSize)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::vector<MsvFlightRecorderRecord> records;
+	records.reserve(static_cast<size_t>(slotsCount));
+
+	for (uint64_t i = 0; i < slotsCount; ++i)
+	{
+		const char* pSlot = pData + sizeof(MsvFlightRecorderHeader) + i * slotSize;
+
+		MsvFlightRecorderRecord record;
+		uint16_t messageSize = 0;
+		memcpy(&record.sequence, pSlot + offsetof(MsvFlightRecorderSlot, sequence), sizeof(record.sequence));
+		memcpy(&record.time, pSlot + offsetof(MsvFlightRecorderSlot, time), sizeof(record.time));
+		memcpy(&record.threadId, pSlot + offsetof(MsvFlightRecorderSlot, threadId), sizeof(record.threadId));
+		memcpy(&record.level, pSlot + offsetof(MsvFlightRecorderSlot, level), sizeof(record.level));
+		memcpy(&messageSize, pSlot + offsetof(MsvFlightRecorderSlot, messageSize), sizeof(messageSize));
+		record.loggerNameSize = static_cast<uint8_t>(pSlot[offsetof(MsvFlightRecorderSlot, loggerNameSize)]);
+		record.messageSize = messageSize;
+
+		//empty slot, slot being written or slot which does not belong to this position
+		if (record.sequence == 0 || (record.sequence - 1) % slotsCount != i || record.loggerNameSize + record.messageSize > MSV_FLIGHT_RECORDER_SLOT_DATA_SIZE || record.level >= spdlog::level::n_levels)
+		{
+			continue;
+		}
+
+		record.pLoggerName = pSlot + offsetof(MsvFlightRecorderSlot, data);
+		record.pMessage = record.pLoggerName + record.loggerNameSize;
+		records.push_back(record);
+	}
+
+	if (records.empty())
+	{
+		return MSV_SUCCESS;
+	}
+
+	std::sort(records.begin(), records.end(), [](const MsvFlightRecorderRecord& first, const MsvFlightRecorderRecord& second) { return first.sequence < second.sequence; });
+
+	int64_t minTime = INT64_MIN;
+	if (lastSeconds > 0)
+	{
+		int64_t maxTime = INT64_MIN;
+		for (const MsvFlightRecorderRecord& record: records)
+		{
+			maxTime = (std::max)(maxTime, record.time);
+		}
+
+		minTime = maxTime - static_cast<int64_t>(lastSeconds) * 1000000000;
+	}
+
+	for (const MsvFlightRecorderRecord& record: records)
+	{
+		if (record.time < minTime)
+		{
+			continue;
+		}
+
+		std::chrono::system_clock::time_point time{std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(record.time))};
+		std::tm tm = spdlog::details::os::localtime(std::chrono::system_clock::to_time_t(time));
+		int64_t milliseconds = (record.time / 1000000) % 1000;
+
+		spdlog::string_view_t levelName = spdlog::level::to_string_view(static_cast<MsvLogLevel>(record.level));
+
+		output << fmt::format("[{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:03}] [{}] [{}] [thread {}] {}\n", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, milliseconds, std::string(record.pLoggerName, record.loggerNameSize), std::string(levelName.data(), levelName.size()), record.threadId, std::string(record.pMessage, record.messageSize));
+	}
+
+	return MSV_SUCCESS;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,98 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Flight Recorder Reader
+* @details		Contains definition of @ref MsvFlightRecorderReader.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_FLIGHTRECORDERREADER_H
+#define MARSTECH_FLIGHTRECORDERREADER_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+#include <ostream>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Flight Recorder Reader.
+* @details	Reads flight recorder file written by @ref MsvFlightRecorderSink (usually after process crash)
+*				and writes its records ordered by time. Each record is written as one line in format
+*				"[date time.ms] [logger] [level] [thread id] message".
+******************************************************************************************************/
+class MsvFlightRecorderReader
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvFlightRecorderReader();
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	******************************************************************************************************/
+	~MsvFlightRecorderReader();
+
+	/**************************************************************************************************//**
+	* @brief			Dump file.
+	* @details		Reads flight recorder file and writes its last records as text lines to output.
+	* @param[in]	recorderFile				Flight recorder file path.
+	* @param[in]	lastSeconds					Dump records of last seconds before the newest record (0 means all records).
+	* @param[out]	output						Text output.
+	* @retval		MSV_NOT_FOUND_ERROR		When flight recorder file could not be read.
+	* @retval		MSV_INVALID_DATA_ERROR	When file is not flight recorder file.
+	* @retval		MSV_SUCCESS					On success.
+	* @note			Slots which were being written when process crashed are skipped.
+	******************************************************************************************************/
+	MsvErrorCode DumpFile(const char* recorderFile, uint32_t lastSeconds, std::ostream& output) const;
+
+	/**************************************************************************************************//**
+	* @brief			Dump.
+	* @details		Reads flight recorder data and writes its last records as text lines to output.
+	* @param[in]	pData							Flight recorder data (whole file).
+	* @param[in]	size							Flight recorder data size.
+	* @param[in]	lastSeconds					Dump records of last seconds before the newest record (0 means all records).
+	* @param[out]	output						Text output.
+	* @retval		MSV_INVALID_DATA_ERROR	When data are not flight recorder data.
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode Dump(const char* pData, size_t size, uint32_t lastSeconds, std::ostream& output) const;
+};
+
+
+#endif // !MARSTECH_FLIGHTRECORDERREADER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,277 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Flight Recorder Sink
+* @details		Contains implementation of @ref MsvFlightRecorderSink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvFlightRecorderSink.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+#include <spdlog/details/os.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif // _WIN32
+
+MSV_ENABLE_WARNINGS
+
+
+static_assert(sizeof(MsvFlightRecorderHeader) == 64, "Flight recorder header must have 64 bytes.");
+static_assert(sizeof(MsvFlightRecorderSlot) == MSV_FLIGHT_RECORDER_SLOT_SIZE, "Flight recorder slot must have MSV_FLIGHT_RECORDER_SLOT_SIZE bytes.");
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvFlightRecorderSink::MsvFlightRecorderSink(const char* recorderFile, uint32_t slotsCount):
+	m_recorderFile(recorderFile),
+	m_slotsCount(slotsCount),
+	m_mappedSize(0),
+	m_pHeader(nullptr),
+	m_pSlots(nullptr),
+#ifdef _WIN32
+	m_hFile(INVALID_HANDLE_VALUE),
+	m_hMapping(nullptr)
+#else
+	m_fd(-1)
+#endif // _WIN32
+{
+
+}
+
+
+MsvFlightRecorderSink::~MsvFlightRecorderSink()
+{
+	UnmapFile();
+}
+
+
+/********************************************************************************************************************************
+*															MsvFlightRecorderSink public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvFlightRecorderSink::Initialize()
+{
+	if (m_pHeader)
+	{
+		return MSV_ALREADY_INITIALIZED_INFO;
+	}
+
+	if (m_slotsCount == 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	//keep records of previous run (it might have crashed)
+	if (spdlog::details::os::path_exists(m_recorderFile))
+	{
+		std::string previousFile = m_recorderFile + ".prev";
+		spdlog::details::os::remove_if_exists(previousFile);
+		spdlog::details::os::rename(m_recorderFile, previousFile);
+	}
+
+	m_mappedSize = sizeof(MsvFlightRecorderHeader) + static_cast<size_t>(m_slotsCount) * sizeof(MsvFlightRecorderSlot);
+	void* pMapped = nullptr;
+
+#ifdef _WIN32
+	m_hFile = CreateFileA(m_recorderFile.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (m_hFile == INVALID_HANDLE_VALUE)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	uint64_t mappedSize = static_cast<uint64_t>(m_mappedSize);
+	m_hMapping = CreateFileMappingA(m_hFile, nullptr, PAGE_READWRITE, static_cast<DWORD>(mappedSize >> 32), static_cast<DWORD>(mappedSize & 0xFFFFFFFF), nullptr);
+	if (!m_hMapping)
+	{
+		UnmapFile();
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	pMapped = MapViewOfFile(m_hMapping, FILE_MAP_ALL_ACCESS, 0, 0, m_mappedSize);
+	if (!pMapped)
+	{
+		UnmapFile();
+		return MSV_INVALID_DATA_ERROR;
+	}
+#else
+	m_fd = open(m_recorderFile.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (m_fd < 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (ftruncate(m_fd, static_cast<off_t>(m_mappedSize)) != 0)
+	{
+		UnmapFile();
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	pMapped = mmap(nullptr, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+	if (pMapped == MAP_FAILED)
+	{
+		UnmapFile();
+		return MSV_INVALID_DATA_ERROR;
+	}
+#endif // _WIN32
+
+	//new file is zeroed -> all slots are empty
+	m_pHeader = new (pMapped) MsvFlightRecorderHeader();
+	m_pHeader->slotSize = sizeof(MsvFlightRecorderSlot);
+	m_pHeader->slotsCount = m_slotsCount;
+	m_pHeader->writeIndex.store(0, std::memory_order_relaxed);
+	m_pSlots = reinterpret_cast<MsvFlightRecorderSlot*>(static_cast<char*>(pMapped) + sizeof(MsvFlightRecorderHeader));
+
+	//magic is written last -> file with magic is complete
+	std::atomic_thread_fence(std::memory_order_release);
+	memcpy(m_pHeader->magic, MSV_FLIGHT_RECORDER_MAGIC, sizeof(m_pHeader->magic));
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvFlightRecorderSink::FlushPages()
+{
+	if (!m_pHeader)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+#ifdef _WIN32
+	FlushViewOfFile(m_pHeader, m_mappedSize);
+	FlushFileBuffers(m_hFile);
+#else
+	msync(m_pHeader, m_mappedSize, MS_SYNC);
+#endif // _WIN32
+
+	return MSV_SUCCESS;
+}
+
+void MsvFlightRecorderSink::log(const spdlog::details::log_msg& msg)
+{
+	//recorder level is applied here (logger sinks keep configured log level)
+	if (!m_pHeader || !should_log(msg.level))
+	{
+		return;
+	}
+
+	uint64_t index = m_pHeader->writeIndex.fetch_add(1, std::memory_order_relaxed);
+	MsvFlightRecorderSlot& slot = m_pSlots[index % m_slotsCount];
+
+	//invalidate slot while it is written (reader skips it when process crashes now)
+	slot.sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	size_t loggerNameSize = (std::min<size_t>)(msg.logger_name.size(), UINT8_MAX);
+	size_t messageSize = (std::min<size_t>)(msg.payload.size(), MSV_FLIGHT_RECORDER_SLOT_DATA_SIZE - loggerNameSize);
+
+	slot.time = std::chrono::duration_cast<std::chrono::nanoseconds>(msg.time.time_since_epoch()).count();
+	slot.threadId = static_cast<uint64_t>(msg.thread_id);
+	slot.level = static_cast<uint8_t>(msg.level);
+	slot.loggerNameSize = static_cast<uint8_t>(loggerNameSize);
+	slot.messageSize = static_cast<uint16_t>(messageSize);
+	memcpy(slot.data, msg.logger_name.data(), loggerNameSize);
+	memcpy(slot.data + loggerNameSize, msg.payload.data(), messageSize);
+
+	slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+void MsvFlightRecorderSink::flush()
+{
+
+}
+
+void MsvFlightRecorderSink::set_pattern(const std::string& /*pattern*/)
+{
+
+}
+
+void MsvFlightRecorderSink::set_formatter(std::unique_ptr<spdlog::formatter> /*sink_formatter*/)
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvFlightRecorderSink protected methods
+********************************************************************************************************************************/
+
+
+void MsvFlightRecorderSink::UnmapFile()
+{
+#ifdef _WIN32
+	if (m_pHeader)
+	{
+		UnmapViewOfFile(m_pHeader);
+	}
+
+	if (m_hMapping)
+	{
+		CloseHandle(m_hMapping);
+		m_hMapping = nullptr;
+	}
+
+	if (m_hFile != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(m_hFile);
+		m_hFile = INVALID_HANDLE_VALUE;
+	}
+#else
+	if (m_pHeader)
+	{
+		munmap(m_pHeader, m_mappedSize);
+	}
+
+	if (m_fd >= 0)
+	{
+		close(m_fd);
+		m_fd = -1;
+	}
+#endif // _WIN32
+
+	m_pHeader = nullptr;
+	m_pSlots = nullptr;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,232 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Flight Recorder Sink
+* @details		Contains definition of @ref MsvFlightRecorderSink and flight recorder file layout.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_FLIGHTRECORDERSINK_H
+#define MARSTECH_FLIGHTRECORDERSINK_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include <spdlog/sinks/sink.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Flight recorder file magic.
+* @details	First bytes of flight recorder file (the last byte is format version).
+******************************************************************************************************/
+#define MSV_FLIGHT_RECORDER_MAGIC "MSVFLRC\x01"
+
+/**************************************************************************************************//**
+* @brief		Flight recorder slot size.
+* @details	Size of one record slot (in bytes).
+******************************************************************************************************/
+#define MSV_FLIGHT_RECORDER_SLOT_SIZE 256
+
+/**************************************************************************************************//**
+* @brief		Flight recorder slot data size.
+* @details	Size of logger name and message stored in one slot (longer messages are truncated).
+******************************************************************************************************/
+#define MSV_FLIGHT_RECORDER_SLOT_DATA_SIZE (MSV_FLIGHT_RECORDER_SLOT_SIZE - 32)
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Flight Recorder Header.
+* @details	Header of flight recorder file (it is followed by slots).
+******************************************************************************************************/
+struct MsvFlightRecorderHeader
+{
+	char magic[8];													///< File magic (@ref MSV_FLIGHT_RECORDER_MAGIC).
+	uint32_t slotSize;											///< Slot size (in bytes).
+	uint32_t reserved;											///< Reserved.
+	uint64_t slotsCount;											///< Number of slots.
+	std::atomic<uint64_t> writeIndex;						///< Index of next record (it is never reset).
+	char padding[32];												///< Padding to cache line.
+};
+
+/**************************************************************************************************//**
+* @brief		MarsTech Flight Recorder Slot.
+* @details	One log record in flight recorder file.
+******************************************************************************************************/
+struct MsvFlightRecorderSlot
+{
+	std::atomic<uint64_t> sequence;							///< Record index + 1 (0 when slot is empty or it is being written).
+	int64_t time;													///< Log time (ns since epoch).
+	uint64_t threadId;											///< ID of logging thread.
+	uint8_t level;													///< Log level.
+	uint8_t loggerNameSize;										///< Logger name size (in bytes).
+	uint16_t messageSize;										///< Message size (in bytes).
+	uint32_t reserved;											///< Reserved.
+	char data[MSV_FLIGHT_RECORDER_SLOT_DATA_SIZE];		///< Logger name followed by message.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Flight Recorder Sink.
+* @details	Spdlog sink which writes log records to ring of slots in memory mapped file. Writers claim slot
+*				by one atomic increment and fill it by plain stores (no locking, no system calls).
+* @note		Existing recorder file (from previous run or crashed process) is renamed to "<file>.prev".
+******************************************************************************************************/
+class MsvFlightRecorderSink:
+	public spdlog::sinks::sink
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	recorderFile			Flight recorder file path.
+	* @param[in]	slotsCount				Number of slots (records).
+	******************************************************************************************************/
+	MsvFlightRecorderSink(const char* recorderFile, uint32_t slotsCount);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Unmaps recorder file (records are kept in file).
+	******************************************************************************************************/
+	virtual ~MsvFlightRecorderSink();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize sink.
+	* @details		Creates and maps recorder file.
+	* @retval		MSV_INVALID_DATA_ERROR		When slots count is zero or recorder file could not be created or mapped.
+	* @retval		MSV_ALREADY_INITIALIZED_INFO	When sink has been already initialized.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize();
+
+	/**************************************************************************************************//**
+	* @brief			Flush mapped pages.
+	* @details		Synchronously writes mapped pages to disk.
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When recorder file is not mapped.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode FlushPages();
+
+	/**************************************************************************************************//**
+	* @brief			Log message.
+	* @details		Writes message to next slot (messages below sink level are skipped).
+	* @param[in]	msg						Log message.
+	******************************************************************************************************/
+	virtual void log(const spdlog::details::log_msg& msg) override;
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Does nothing - records are in memory mapped file already (use @ref FlushPages to write them to disk).
+	******************************************************************************************************/
+	virtual void flush() override;
+
+	/**************************************************************************************************//**
+	* @brief			Set pattern.
+	* @details		Ignored - records are formatted by dump tool.
+	* @param[in]	pattern					Formatting pattern.
+	******************************************************************************************************/
+	virtual void set_pattern(const std::string& pattern) override;
+
+	/**************************************************************************************************//**
+	* @brief			Set formatter.
+	* @details		Ignored - records are formatted by dump tool.
+	* @param[in]	sink_formatter			Formatter.
+	******************************************************************************************************/
+	virtual void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Unmap file.
+	* @details		Unmaps and closes recorder file.
+	******************************************************************************************************/
+	void UnmapFile();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Recorder file.
+	* @details	Flight recorder file path.
+	******************************************************************************************************/
+	std::string m_recorderFile;
+
+	/**************************************************************************************************//**
+	* @brief		Slots count.
+	* @details	Number of slots (records).
+	******************************************************************************************************/
+	uint32_t m_slotsCount;
+
+	/**************************************************************************************************//**
+	* @brief		Mapped size.
+	* @details	Size of mapped file (in bytes).
+	******************************************************************************************************/
+	size_t m_mappedSize;
+
+	/**************************************************************************************************//**
+	* @brief		Header.
+	* @details	Pointer to mapped file header (nullptr when file is not mapped).
+	******************************************************************************************************/
+	MsvFlightRecorderHeader* m_pHeader;
+
+	/**************************************************************************************************//**
+	* @brief		Slots.
+	* @details	Pointer to mapped slots.
+	******************************************************************************************************/
+	MsvFlightRecorderSlot* m_pSlots;
+
+#ifdef _WIN32
+	/**************************************************************************************************//**
+	* @brief		File handle.
+	* @details	Handle of recorder file.
+	******************************************************************************************************/
+	void* m_hFile;
+
+	/**************************************************************************************************//**
+	* @brief		Mapping handle.
+	* @details	Handle of recorder file mapping.
+	******************************************************************************************************/
+	void* m_hMapping;
+#else
+	/**************************************************************************************************//**
+	* @brief		File descriptor.
+	* @details	Descriptor of recorder file.
+	******************************************************************************************************/
+	int m_fd;
+#endif // _WIN32
+};
+
+
+#endif // !MARSTECH_FLIGHTRECORDERSINK_H
+
+/** @} */	//End of group MSYS.
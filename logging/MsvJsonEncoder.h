@@ -0,0 +1,264 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech JSON Encoder
+* @details		Contains JSON encoding functions (SSE2 string escaping) for structured logging.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_JSONENCODER_H
+#define MARSTECH_JSONENCODER_H
+
+
+#include "mlogging/mlogging.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#include <spdlog/fmt/fmt.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MSV_JSON_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		JSON buffer.
+* @details	Reusable output buffer (it keeps its capacity when it is cleared).
+******************************************************************************************************/
+typedef spdlog::memory_buf_t MsvJsonBuffer;
+
+
+/**************************************************************************************************//**
+* @brief			Append raw.
+* @details		Appends raw (already encoded) bytes to buffer.
+* @param[out]	buffer				Output buffer.
+* @param[in]	pData					Data.
+* @param[in]	size					Data size.
+******************************************************************************************************/
+inline void MsvJsonAppendRaw(MsvJsonBuffer& buffer, const char* pData, size_t size)
+{
+	buffer.append(pData, pData + size);
+}
+
+/**************************************************************************************************//**
+* @brief			Escape character.
+* @details		Appends escape sequence of character which can not be in JSON string.
+* @param[out]	buffer				Output buffer.
+* @param[in]	character			Character to escape (quote, backslash or control character).
+******************************************************************************************************/
+inline void MsvJsonEscapeCharacter(MsvJsonBuffer& buffer, char character)
+{
+	static const char hexDigits[] = "0123456789abcdef";
+
+	switch (character)
+	{
+	case '"':
+		MsvJsonAppendRaw(buffer, "\\\"", 2);
+		break;
+	case '\\':
+		MsvJsonAppendRaw(buffer, "\\\\", 2);
+		break;
+	case '\n':
+		MsvJsonAppendRaw(buffer, "\\n", 2);
+		break;
+	case '\r':
+		MsvJsonAppendRaw(buffer, "\\r", 2);
+		break;
+	case '\t':
+		MsvJsonAppendRaw(buffer, "\\t", 2);
+		break;
+	default:
+		{
+			uint8_t value = static_cast<uint8_t>(character);
+			char escaped[6] = {'\\', 'u', '0', '0', hexDigits[value >> 4], hexDigits[value & 0x0F]};
+			MsvJsonAppendRaw(buffer, escaped, sizeof(escaped));
+		}
+		break;
+	}
+}
+
+/**************************************************************************************************//**
+* @brief			Needs escape.
+* @details		Checks if character must be escaped in JSON string.
+* @param[in]	character			Character.
+* @returns		bool
+******************************************************************************************************/
+inline bool MsvJsonNeedsEscape(char character)
+{
+	return static_cast<uint8_t>(character) < 0x20 || character == '"' || character == '\\';
+}
+
+/**************************************************************************************************//**
+* @brief			Append escaped.
+* @details		Appends string escaped for JSON string (without quotes). Blocks of 16 bytes without
+*					characters to escape are copied at once (SSE2).
+* @param[out]	buffer				Output buffer.
+* @param[in]	pData					String.
+* @param[in]	size					String size.
+* @note			Bytes above 0x7F are copied (UTF-8 is valid JSON).
+******************************************************************************************************/
+inline void MsvJsonAppendEscaped(MsvJsonBuffer& buffer, const char* pData, size_t size)
+{
+	const char* pEnd = pData + size;
+
+#ifdef MSV_JSON_SSE2
+	const __m128i quotes = _mm_set1_epi8('"');
+	const __m128i backslashes = _mm_set1_epi8('\\');
+	const __m128i controlMax = _mm_set1_epi8(0x1F);
+
+	while (pEnd - pData >= 16)
+	{
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pData));
+
+		//byte <= 0x1F (unsigned) when max(byte, 0x1F) == 0x1F
+		__m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, quotes), _mm_cmpeq_epi8(block, backslashes)), _mm_cmpeq_epi8(_mm_max_epu8(block, controlMax), controlMax));
+		uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+
+		if (!mask)
+		{
+			MsvJsonAppendRaw(buffer, pData, 16);
+			pData += 16;
+			continue;
+		}
+
+#ifdef _MSC_VER
+		unsigned long position = 0;
+		_BitScanForward(&position, mask);
+#else
+		uint32_t position = static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+
+		MsvJsonAppendRaw(buffer, pData, position);
+		MsvJsonEscapeCharacter(buffer, pData[position]);
+		pData += position + 1;
+	}
+#endif
+
+	const char* pChunk = pData;
+	for (; pData < pEnd; ++pData)
+	{
+		if (MsvJsonNeedsEscape(*pData))
+		{
+			MsvJsonAppendRaw(buffer, pChunk, static_cast<size_t>(pData - pChunk));
+			MsvJsonEscapeCharacter(buffer, *pData);
+			pChunk = pData + 1;
+		}
+	}
+
+	MsvJsonAppendRaw(buffer, pChunk, static_cast<size_t>(pEnd - pChunk));
+}
+
+/**************************************************************************************************//**
+* @brief			Append string.
+* @details		Appends quoted and escaped JSON string.
+* @param[out]	buffer				Output buffer.
+* @param[in]	pData					String.
+* @param[in]	size					String size.
+******************************************************************************************************/
+inline void MsvJsonAppendString(MsvJsonBuffer& buffer, const char* pData, size_t size)
+{
+	buffer.push_back('"');
+	MsvJsonAppendEscaped(buffer, pData, size);
+	buffer.push_back('"');
+}
+
+/**************************************************************************************************//**
+* @brief			Append integer.
+* @details		Appends signed integer as JSON number.
+* @param[out]	buffer				Output buffer.
+* @param[in]	value					Value.
+******************************************************************************************************/
+inline void MsvJsonAppendInteger(MsvJsonBuffer& buffer, int64_t value)
+{
+	fmt::format_int formatted(value);
+	MsvJsonAppendRaw(buffer, formatted.data(), formatted.size());
+}
+
+/**************************************************************************************************//**
+* @brief			Append unsigned integer.
+* @details		Appends unsigned integer as JSON number.
+* @param[out]	buffer				Output buffer.
+* @param[in]	value					Value.
+******************************************************************************************************/
+inline void MsvJsonAppendUnsigned(MsvJsonBuffer& buffer, uint64_t value)
+{
+	fmt::format_int formatted(value);
+	MsvJsonAppendRaw(buffer, formatted.data(), formatted.size());
+}
+
+/**************************************************************************************************//**
+* @brief			Append double.
+* @details		Appends floating point value as JSON number (shortest representation). NaN and infinity
+*					are written as null (JSON does not support them).
+* @param[out]	buffer				Output buffer.
+* @param[in]	value					Value.
+******************************************************************************************************/
+inline void MsvJsonAppendDouble(MsvJsonBuffer& buffer, double value)
+{
+	if (!std::isfinite(value))
+	{
+		MsvJsonAppendRaw(buffer, "null", 4);
+		return;
+	}
+
+	fmt::format_to(std::back_inserter(buffer), "{}", value);
+}
+
+/**************************************************************************************************//**
+* @brief			Append bool.
+* @details		Appends JSON true or false.
+* @param[out]	buffer				Output buffer.
+* @param[in]	value					Value.
+******************************************************************************************************/
+inline void MsvJsonAppendBool(MsvJsonBuffer& buffer, bool value)
+{
+	if (value)
+	{
+		MsvJsonAppendRaw(buffer, "true", 4);
+	}
+	else
+	{
+		MsvJsonAppendRaw(buffer, "false", 5);
+	}
+}
+
+
+#endif // !MARSTECH_JSONENCODER_H
+
+/** @} */	//End of group MSYS.
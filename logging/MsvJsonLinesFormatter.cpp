@@ -0,0 +1,114 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech JSON Lines Formatter
+* @details		Contains implementation of @ref MsvJsonLinesFormatter.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvJsonLinesFormatter.h"
+#include "MsvStructuredLog.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <spdlog/details/os.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvJsonLinesFormatter::MsvJsonLinesFormatter():
+	m_cachedSeconds(0),
+	m_cachedTime{0}
+{
+
+}
+
+
+MsvJsonLinesFormatter::~MsvJsonLinesFormatter()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															spdlog::formatter public methods
+********************************************************************************************************************************/
+
+
+void MsvJsonLinesFormatter::format(const spdlog::details::log_msg& msg, spdlog::memory_buf_t& dest)
+{
+	std::chrono::nanoseconds sinceEpoch = std::chrono::duration_cast<std::chrono::nanoseconds>(msg.time.time_since_epoch());
+	std::time_t seconds = static_cast<std::time_t>(std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch).count());
+
+	//calendar conversion once per second
+	if (seconds != m_cachedSeconds || !m_cachedTime[0])
+	{
+		std::tm tm = spdlog::details::os::gmtime(seconds);
+		fmt::format_to_n(m_cachedTime, sizeof(m_cachedTime), "{:04}-{:02}-{:02}T{:02}:{:02}:{:02}", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
+		m_cachedSeconds = seconds;
+	}
+
+	MsvJsonAppendRaw(dest, "{\"time\":\"", 9);
+	MsvJsonAppendRaw(dest, m_cachedTime, sizeof(m_cachedTime) - 1);
+	fmt::format_to(std::back_inserter(dest), ".{:06}Z\",\"level\":", (sinceEpoch.count() / 1000) % 1000000);
+
+	spdlog::string_view_t levelName = spdlog::level::to_string_view(msg.level);
+	MsvJsonAppendString(dest, levelName.data(), levelName.size());
+
+	MsvJsonAppendRaw(dest, ",\"logger\":", 10);
+	MsvJsonAppendString(dest, msg.logger_name.data(), msg.logger_name.size());
+
+	MsvJsonAppendRaw(dest, ",\"thread\":", 10);
+	MsvJsonAppendUnsigned(dest, static_cast<uint64_t>(msg.thread_id));
+	dest.push_back(',');
+
+	if (msg.payload.size() > 0 && msg.payload.data()[0] == MSV_STRUCTURED_LOG_MARKER)
+	{
+		//members are encoded already
+		MsvJsonAppendRaw(dest, msg.payload.data() + 1, msg.payload.size() - 1);
+	}
+	else
+	{
+		MsvJsonAppendRaw(dest, "\"msg\":", 6);
+		MsvJsonAppendString(dest, msg.payload.data(), msg.payload.size());
+	}
+
+	MsvJsonAppendRaw(dest, "}\n", 2);
+}
+
+std::unique_ptr<spdlog::formatter> MsvJsonLinesFormatter::clone() const
+{
+	return std::unique_ptr<spdlog::formatter>(new MsvJsonLinesFormatter());
+}
+
+/** @} */	//End of group MSYS.
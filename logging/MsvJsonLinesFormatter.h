@@ -0,0 +1,104 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech JSON Lines Formatter
+* @details		Contains definition of @ref MsvJsonLinesFormatter.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_JSONLINESFORMATTER_H
+#define MARSTECH_JSONLINESFORMATTER_H
+
+
+#include "MsvJsonEncoder.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+#include <ctime>
+#include <memory>
+
+#include <spdlog/formatter.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech JSON Lines Formatter.
+* @details	Formats each log record as one JSON object:
+*				{"time":"2026-10-19T10:02:00.123456Z","level":"info","logger":"name","thread":1234,"msg":"message"}.
+*				Structured records (@ref MsvStructuredLog) add their fields behind message, other records are
+*				written with escaped message.
+******************************************************************************************************/
+class MsvJsonLinesFormatter:
+	public spdlog::formatter
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvJsonLinesFormatter();
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvJsonLinesFormatter();
+
+	/**************************************************************************************************//**
+	* @brief			Format.
+	* @details		Formats log message as JSON line.
+	* @param[in]	msg						Log message.
+	* @param[out]	dest						Output buffer.
+	******************************************************************************************************/
+	virtual void format(const spdlog::details::log_msg& msg, spdlog::memory_buf_t& dest) override;
+
+	/**************************************************************************************************//**
+	* @brief			Clone.
+	* @details		Returns new formatter (spdlog sets clone to each sink).
+	* @returns		std::unique_ptr<spdlog::formatter>
+	******************************************************************************************************/
+	virtual std::unique_ptr<spdlog::formatter> clone() const override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Cached seconds.
+	* @details	Seconds since epoch of cached time prefix.
+	******************************************************************************************************/
+	std::time_t m_cachedSeconds;
+
+	/**************************************************************************************************//**
+	* @brief		Cached time.
+	* @details	Formatted UTC time up to seconds ("2026-10-19T10:02:00").
+	******************************************************************************************************/
+	char m_cachedTime[20];
+};
+
+
+#endif // !MARSTECH_JSONLINESFORMATTER_H
+
+/** @} */	//End of group MSYS.
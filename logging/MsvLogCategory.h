@@ -0,0 +1,142 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Categories
+* @details		Contains log categories and global mask of enabled categories.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGCATEGORY_H
+#define MARSTECH_LOGCATEGORY_H
+
+
+#include "MsvLogForwardingSink.h"
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Log categories.
+* @details	Bits of log categories (subsystems). Categorized log calls (MSV_LOG_CAT_* macros) are written
+*				when their level is enabled or when their category is enabled (see @ref MsvLogCategoryMask).
+*				Bits from @ref MSV_LOG_CAT_USER are free for application categories.
+******************************************************************************************************/
+#define MSV_LOG_CAT_NONE 0x00000000u
+#define MSV_LOG_CAT_DLL 0x00000001u							///< @copydoc MSV_LOG_CAT_NONE
+#define MSV_LOG_CAT_CONFIG 0x00000002u						///< @copydoc MSV_LOG_CAT_NONE
+#define MSV_LOG_CAT_MODULE 0x00000004u						///< @copydoc MSV_LOG_CAT_NONE
+#define MSV_LOG_CAT_THREADING 0x00000008u					///< @copydoc MSV_LOG_CAT_NONE
+#define MSV_LOG_CAT_LOGGING 0x00000010u						///< @copydoc MSV_LOG_CAT_NONE
+#define MSV_LOG_CAT_USER(index) (0x00010000u << (index))	///< Application category (index 0 - 15).
+#define MSV_LOG_CAT_ALL 0xFFFFFFFFu							///< @copydoc MSV_LOG_CAT_NONE
+
+
+/**************************************************************************************************//**
+* @brief			Log category mask.
+* @details		Returns cached address of global mask of enabled log categories which is used by log calls of
+*					this binary (EXE or DLL). Global mask is owned by @ref IMsvLogging (there is only one for all
+*					binaries), each binary caches its address by @ref MsvLogCategoryBind. No category is enabled
+*					while this binary is not bound (nullptr).
+* @returns		std::atomic<const std::atomic<uint32_t>*>&
+* @note			Each binary has its own copy of this function (and cached address).
+******************************************************************************************************/
+inline std::atomic<const std::atomic<uint32_t>*>& MsvLogCategoryMask()
+{
+	static std::atomic<const std::atomic<uint32_t>*> pCategoryMask(nullptr);
+	return pCategoryMask;
+}
+
+/**************************************************************************************************//**
+* @brief			Bind log categories.
+* @details		Caches address of global mask of enabled log categories for log calls of this binary.
+* @param[in]	pCategoryMask				Global mask (@ref IMsvLogging::GetLogCategoriesMask), nullptr unbinds
+*													this binary.
+* @warning		Binary must be unbound before @ref IMsvLogging is released.
+* @see			MsvLogBind
+******************************************************************************************************/
+inline void MsvLogCategoryBind(const std::atomic<uint32_t>* pCategoryMask)
+{
+	MsvLogCategoryMask().store(pCategoryMask, std::memory_order_release);
+}
+
+/**************************************************************************************************//**
+* @brief			Log category enabled.
+* @details		Checks if any of categories is enabled (relaxed load of global mask by cached address).
+* @param[in]	categories					Log categories.
+* @returns		bool
+* @retval		true							When any of categories is enabled.
+* @retval		false							When categories are disabled (or this binary is not bound).
+******************************************************************************************************/
+inline bool MsvLogCategoryEnabled(uint32_t categories)
+{
+	const std::atomic<uint32_t>* pCategoryMask = MsvLogCategoryMask().load(std::memory_order_acquire);
+	return pCategoryMask && (pCategoryMask->load(std::memory_order_relaxed) & categories) != 0;
+}
+
+/**************************************************************************************************//**
+* @brief			Log category message.
+* @details		Writes formatted message directly to logger sinks (logger level and configured level of
+*					logger sinks are bypassed, levels of sinks attached to forwarding sink are kept). It is used
+*					for log calls of enabled categories whose level is disabled.
+* @param[in]	spLogger						Logger.
+* @param[in]	logLevel						Log level.
+* @param[in]	message						Formatted message.
+******************************************************************************************************/
+inline void MsvLogCategoryMessage(const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel, const std::string& message)
+{
+	spdlog::details::log_msg msg(spLogger->name(), logLevel, spdlog::string_view_t(message.data(), message.size()));
+	for (const spdlog::sink_ptr& spSink: spLogger->sinks())
+	{
+		//sink levels of logger are set to configured log level (see MsvLogForwardingSink::SetLoggerLevel)
+		MsvLogForwardingSink* pForwardingSink = dynamic_cast<MsvLogForwardingSink*>(spSink.get());
+		if (pForwardingSink)
+		{
+			pForwardingSink->Forward(msg, true);
+		}
+		else
+		{
+			spSink->log(msg);
+		}
+	}
+}
+
+
+#endif // !MARSTECH_LOGCATEGORY_H
+
+/** @} */	//End of group MSYS.
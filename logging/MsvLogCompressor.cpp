@@ -0,0 +1,285 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Compressor
+* @details		Contains implementation of @ref MsvLogCompressor.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvLogCompressor.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <fstream>
+#include <vector>
+
+#include <spdlog/details/os.h>
+#include <spdlog/sinks/rotating_file_sink.h>
+
+#include <zlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // _WIN32
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvLogCompressor::MsvLogCompressor():
+	m_running(false),
+	m_stop(false),
+	m_busy(false)
+{
+
+}
+
+
+MsvLogCompressor::~MsvLogCompressor()
+{
+	Stop();
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogCompressor public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvLogCompressor::Start()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_running)
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	m_stop = false;
+	m_running = true;
+	m_thread = std::thread(&MsvLogCompressor::CompressorThread, this);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogCompressor::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (!m_running)
+		{
+			return MSV_NOT_RUNNING_INFO;
+		}
+
+		m_running = false;
+		m_stop = true;
+	}
+
+	m_condition.notify_all();
+	m_thread.join();
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogCompressor::AddRotatedFile(const std::string& rotatedFile, const std::string& logFile, uint64_t maxCompressedLogsSize)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (!m_running)
+		{
+			return MSV_NOT_RUNNING_INFO;
+		}
+
+		m_jobs.push_back(MsvLogCompressorJob{rotatedFile, logFile, maxCompressedLogsSize});
+	}
+
+	m_condition.notify_all();
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogCompressor::WaitForIdle()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	if (!m_running)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	m_condition.wait(lock, [this] { return (m_jobs.empty() && !m_busy) || m_stop; });
+
+	return MSV_SUCCESS;
+}
+
+std::string MsvLogCompressor::GetArchiveName(const std::string& logFile, size_t index)
+{
+	return spdlog::sinks::rotating_file_sink_st::calc_filename(logFile, index) + ".gz";
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogCompressor protected methods
+********************************************************************************************************************************/
+
+
+void MsvLogCompressor::CompressorThread()
+{
+	//compression must not take CPU from application threads
+#ifdef _WIN32
+	SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+#elif defined(__linux__)
+	setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 19);
+#endif // _WIN32
+
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	while (true)
+	{
+		m_condition.wait(lock, [this] { return !m_jobs.empty() || m_stop; });
+
+		if (m_jobs.empty())
+		{
+			//stopped and all queued files are compressed
+			break;
+		}
+
+		MsvLogCompressorJob job = m_jobs.front();
+		m_jobs.pop_front();
+		m_busy = true;
+
+		lock.unlock();
+		CompressJob(job);
+		lock.lock();
+
+		m_busy = false;
+		m_condition.notify_all();
+	}
+}
+
+void MsvLogCompressor::CompressJob(const MsvLogCompressorJob& job)
+{
+	std::string compressedFile = job.rotatedFile + ".gz";
+	if (!CompressFile(job.rotatedFile, compressedFile))
+	{
+		//keep uncompressed file (no data are lost)
+		spdlog::details::os::remove_if_exists(compressedFile);
+		return;
+	}
+
+	spdlog::details::os::remove_if_exists(job.rotatedFile);
+
+	//log.1.txt.gz -> log.2.txt.gz...
+	size_t archivesCount = 0;
+	while (spdlog::details::os::path_exists(GetArchiveName(job.logFile, archivesCount + 1)))
+	{
+		++archivesCount;
+	}
+
+	for (size_t i = archivesCount; i > 0; --i)
+	{
+		spdlog::details::os::rename(GetArchiveName(job.logFile, i), GetArchiveName(job.logFile, i + 1));
+	}
+
+	spdlog::details::os::rename(compressedFile, GetArchiveName(job.logFile, 1));
+
+	//remove the oldest archives over size limit (the newest one is always kept)
+	uint64_t archivesSize = GetFileSize(GetArchiveName(job.logFile, 1));
+	for (size_t i = 2; i <= archivesCount + 1; ++i)
+	{
+		std::string archive = GetArchiveName(job.logFile, i);
+		archivesSize += GetFileSize(archive);
+
+		if (archivesSize > job.maxCompressedLogsSize)
+		{
+			spdlog::details::os::remove_if_exists(archive);
+		}
+	}
+}
+
+bool MsvLogCompressor::CompressFile(const std::string& sourceFile, const std::string& targetFile)
+{
+	std::ifstream source(sourceFile, std::ios::binary);
+	if (!source)
+	{
+		return false;
+	}
+
+	gzFile target = gzopen(targetFile.c_str(), "wb6");
+	if (!target)
+	{
+		return false;
+	}
+
+	std::vector<char> buffer(65536);
+	bool succeeded = true;
+
+	while (source)
+	{
+		source.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		std::streamsize readSize = source.gcount();
+
+		if (readSize > 0 && gzwrite(target, buffer.data(), static_cast<unsigned int>(readSize)) != static_cast<int>(readSize))
+		{
+			succeeded = false;
+			break;
+		}
+	}
+
+	if (gzclose(target) != Z_OK)
+	{
+		succeeded = false;
+	}
+
+	return succeeded && source.eof();
+}
+
+uint64_t MsvLogCompressor::GetFileSize(const std::string& file)
+{
+	std::ifstream stream(file, std::ios::binary | std::ios::ate);
+	if (!stream)
+	{
+		return 0;
+	}
+
+	return static_cast<uint64_t>(stream.tellg());
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,210 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Compressor
+* @details		Contains definition of @ref MsvLogCompressor.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGCOMPRESSOR_H
+#define MARSTECH_LOGCOMPRESSOR_H
+
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Compressor Job.
+* @details	Rotated log file waiting for compression.
+******************************************************************************************************/
+struct MsvLogCompressorJob
+{
+	std::string rotatedFile;									///< Rotated (uncompressed) log file (it is removed after compression).
+	std::string logFile;											///< Log file path (archives are named "<name>.<index>.<ext>.gz").
+	uint64_t maxCompressedLogsSize;							///< Maximum size of all archives of log file (in bytes).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Compressor.
+* @details	Compresses rotated log files (gzip) in low priority background thread. The newest archive
+*				is "<name>.1.<ext>.gz", older archives are shifted and the oldest ones are removed when size
+*				of all archives exceeds limit.
+* @note		One compressor is shared by all compressing file sinks of logger provider.
+******************************************************************************************************/
+class MsvLogCompressor
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvLogCompressor();
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	* @details	Stops compressor (all queued files are compressed).
+	******************************************************************************************************/
+	~MsvLogCompressor();
+
+	/**************************************************************************************************//**
+	* @brief			Start compressor.
+	* @details		Starts background thread.
+	* @retval		MSV_ALREADY_RUNNING_INFO		When compressor is already running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Start();
+
+	/**************************************************************************************************//**
+	* @brief			Stop compressor.
+	* @details		Compresses all queued files and stops background thread.
+	* @retval		MSV_NOT_RUNNING_INFO			When compressor is not running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Stop();
+
+	/**************************************************************************************************//**
+	* @brief			Add rotated file.
+	* @details		Queues rotated log file for compression (it does not wait).
+	* @param[in]	rotatedFile						Rotated (uncompressed) log file.
+	* @param[in]	logFile							Log file path (archives are named by it).
+	* @param[in]	maxCompressedLogsSize		Maximum size of all archives of log file (in bytes).
+	* @retval		MSV_NOT_RUNNING_INFO			When compressor is not running (file is not compressed).
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode AddRotatedFile(const std::string& rotatedFile, const std::string& logFile, uint64_t maxCompressedLogsSize);
+
+	/**************************************************************************************************//**
+	* @brief			Wait for idle.
+	* @details		Waits until all queued files are compressed.
+	* @retval		MSV_NOT_RUNNING_INFO			When compressor is not running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode WaitForIdle();
+
+	/**************************************************************************************************//**
+	* @brief			Get archive name.
+	* @details		Returns name of compressed log file with index.
+	* @param[in]	logFile							Log file path.
+	* @param[in]	index								Archive index (1 is the newest).
+	* @returns		std::string
+	******************************************************************************************************/
+	static std::string GetArchiveName(const std::string& logFile, size_t index);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Compressor thread.
+	* @details	Lowers its priority and compresses queued files until it is stopped.
+	******************************************************************************************************/
+	void CompressorThread();
+
+	/**************************************************************************************************//**
+	* @brief			Compress job.
+	* @details		Compresses rotated file to the newest archive, shifts older archives and removes
+	*					archives over size limit.
+	* @param[in]	job								Compressor job.
+	******************************************************************************************************/
+	void CompressJob(const MsvLogCompressorJob& job);
+
+	/**************************************************************************************************//**
+	* @brief			Compress file.
+	* @details		Compresses source file to target gzip file.
+	* @param[in]	sourceFile						Source file.
+	* @param[in]	targetFile						Target gzip file.
+	* @returns		bool
+	* @retval		true								On success.
+	* @retval		false								When file could not be read or written.
+	******************************************************************************************************/
+	static bool CompressFile(const std::string& sourceFile, const std::string& targetFile);
+
+	/**************************************************************************************************//**
+	* @brief			Get file size.
+	* @details		Returns size of file (0 when it does not exist).
+	* @param[in]	file								File path.
+	* @returns		uint64_t
+	******************************************************************************************************/
+	static uint64_t GetFileSize(const std::string& file);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Condition.
+	* @details	Wakes compressor thread (new job, stop) and waiters for idle.
+	******************************************************************************************************/
+	std::condition_variable m_condition;
+
+	/**************************************************************************************************//**
+	* @brief		Jobs.
+	* @details	Queued rotated files.
+	******************************************************************************************************/
+	std::deque<MsvLogCompressorJob> m_jobs;
+
+	/**************************************************************************************************//**
+	* @brief		Compressor thread.
+	* @details	Background thread which compresses files.
+	******************************************************************************************************/
+	std::thread m_thread;
+
+	/**************************************************************************************************//**
+	* @brief		Running flag.
+	* @details	True when compressor is running.
+	******************************************************************************************************/
+	bool m_running;
+
+	/**************************************************************************************************//**
+	* @brief		Stop flag.
+	* @details	True when compressor thread should stop (after queued jobs are done).
+	******************************************************************************************************/
+	bool m_stop;
+
+	/**************************************************************************************************//**
+	* @brief		Busy flag.
+	* @details	True when compressor thread compresses file.
+	******************************************************************************************************/
+	bool m_busy;
+};
+
+
+#endif // !MARSTECH_LOGCOMPRESSOR_H
+
+/** @} */	//End of group MSYS.
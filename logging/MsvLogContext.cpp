@@ -0,0 +1,209 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Context
+* @details		Contains implementation of @ref MsvLogContext.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvLogContext.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Static variables
+********************************************************************************************************************************/
+
+
+/**************************************************************************************************//**
+* @brief		Thread context.
+* @details	Current log context of thread (nullptr when it is empty).
+******************************************************************************************************/
+static thread_local MsvLogContextData* t_pContext = nullptr;
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvLogContext::MsvLogContext()
+{
+
+}
+
+
+MsvLogContext::~MsvLogContext()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															IMsvLogContext public methods
+********************************************************************************************************************************/
+
+
+MsvLogContextData* MsvLogContext::AcquireContext()
+{
+	return Acquire();
+}
+
+void MsvLogContext::ReleaseContext(MsvLogContextData* pContext)
+{
+	Release(pContext);
+}
+
+MsvLogContextData* MsvLogContext::PushContext(const char* key, spdlog::string_view_t value)
+{
+	MsvLogContextData* pContext = Create(key, value);
+	if (!pContext)
+	{
+		//allocation failed -> current context is kept (and restored as it is)
+		pContext = Acquire();
+	}
+
+	return Exchange(pContext);
+}
+
+MsvLogContextData* MsvLogContext::PushContext(MsvLogContextData* pContext)
+{
+	if (pContext)
+	{
+		pContext->references.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	return Exchange(pContext);
+}
+
+void MsvLogContext::PopContext(MsvLogContextData* pPrevious)
+{
+	Release(Exchange(pPrevious));
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogContext public methods
+********************************************************************************************************************************/
+
+
+MsvLogContextData* MsvLogContext::Acquire()
+{
+	MsvLogContextData* pContext = t_pContext;
+	if (pContext)
+	{
+		pContext->references.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	return pContext;
+}
+
+void MsvLogContext::Release(MsvLogContextData* pContext)
+{
+	if (pContext && pContext->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		delete pContext;
+	}
+}
+
+MsvLogContextData* MsvLogContext::Exchange(MsvLogContextData* pContext)
+{
+	MsvLogContextData* pPrevious = t_pContext;
+	t_pContext = pContext;
+
+	return pPrevious;
+}
+
+MsvLogContextData* MsvLogContext::Create(const char* key, spdlog::string_view_t value)
+{
+	MsvLogContextData* pContext = new (std::nothrow) MsvLogContextData;
+	if (!pContext)
+	{
+		return nullptr;
+	}
+
+	pContext->references.store(1, std::memory_order_relaxed);
+	pContext->slotsCount = 0;
+
+	if (t_pContext)
+	{
+		pContext->slotsCount = t_pContext->slotsCount;
+		std::memcpy(pContext->slots, t_pContext->slots, sizeof(MsvLogContextSlot) * t_pContext->slotsCount);
+	}
+
+	MsvLogContextSlot* pSlot = std::find_if(pContext->slots, pContext->slots + pContext->slotsCount, [key](const MsvLogContextSlot& slot) { return std::strcmp(slot.key, key) == 0; });
+	if (pSlot == pContext->slots + pContext->slotsCount)
+	{
+		if (pContext->slotsCount == MSV_LOG_CONTEXT_SLOTS)
+		{
+			return pContext;
+		}
+
+		++pContext->slotsCount;
+	}
+
+	size_t size = (std::min)(value.size(), static_cast<size_t>(MSV_LOG_CONTEXT_VALUE_SIZE - 1));
+	pSlot->key = key;
+	std::memcpy(pSlot->value, value.data(), size);
+	pSlot->value[size] = '\0';
+
+	return pContext;
+}
+
+void MsvLogContext::Format(const MsvLogContextData* pContext, std::string& output)
+{
+	if (!pContext || !pContext->slotsCount)
+	{
+		return;
+	}
+
+	output += " {";
+
+	for (uint32_t i = 0; i < pContext->slotsCount; ++i)
+	{
+		if (i)
+		{
+			output += ", ";
+		}
+
+		output += pContext->slots[i].key;
+		output += '=';
+		output += pContext->slots[i].value;
+	}
+
+	output += '}';
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,135 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Context
+* @details		Contains implementation @ref MsvLogContext of @ref IMsvLogContext interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGCONTEXT_H
+#define MARSTECH_LOGCONTEXT_H
+
+
+#include "IMsvLogContext.h"
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Context.
+* @details	Implementation of log context interface. Each thread has pointer to its current context snapshot
+*				(nullptr when it is empty). Snapshots are created by @ref PushContext and they are never changed,
+*				so log records of @ref MsvAsyncLogBackend capture them without copying fields. Static methods
+*				are used by msys library directly (thread local pointer is defined in this library only).
+* @see		IMsvLogContext
+******************************************************************************************************/
+class MsvLogContext:
+	public IMsvLogContext
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvLogContext();
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvLogContext();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogContext::AcquireContext()
+	******************************************************************************************************/
+	virtual MsvLogContextData* AcquireContext() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogContext::ReleaseContext(MsvLogContextData* pContext)
+	******************************************************************************************************/
+	virtual void ReleaseContext(MsvLogContextData* pContext) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogContext::PushContext(const char* key, spdlog::string_view_t value)
+	******************************************************************************************************/
+	virtual MsvLogContextData* PushContext(const char* key, spdlog::string_view_t value) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogContext::PushContext(MsvLogContextData* pContext)
+	******************************************************************************************************/
+	virtual MsvLogContextData* PushContext(MsvLogContextData* pContext) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogContext::PopContext(MsvLogContextData* pPrevious)
+	******************************************************************************************************/
+	virtual void PopContext(MsvLogContextData* pPrevious) override;
+
+	/**************************************************************************************************//**
+	* @brief			Acquire context.
+	* @details		Returns current context of calling thread with new reference.
+	* @returns		MsvLogContextData*
+	* @retval		nullptr								When context is empty.
+	* @note			Returned context must be released by @ref Release.
+	******************************************************************************************************/
+	static MsvLogContextData* Acquire();
+
+	/**************************************************************************************************//**
+	* @brief			Release context.
+	* @details		Releases reference of context (context is deleted with its last reference).
+	* @param[in]	pContext								Context (it might be nullptr).
+	******************************************************************************************************/
+	static void Release(MsvLogContextData* pContext);
+
+	/**************************************************************************************************//**
+	* @brief			Exchange context.
+	* @details		Sets current context of calling thread and returns previous one.
+	* @param[in]	pContext								New context (its reference is owned by thread).
+	* @returns		MsvLogContextData*				Previous context (its reference is owned by caller).
+	******************************************************************************************************/
+	static MsvLogContextData* Exchange(MsvLogContextData* pContext);
+
+	/**************************************************************************************************//**
+	* @brief			Create context.
+	* @details		Creates copy of current context of calling thread with added (or replaced) field.
+	* @param[in]	key									Key (static storage).
+	* @param[in]	value									Value (truncated to @ref MSV_LOG_CONTEXT_VALUE_SIZE).
+	* @returns		MsvLogContextData*				New context with one reference.
+	* @retval		nullptr								When memory allocation failed.
+	* @note			Field is not added when all slots are used (existing fields are kept).
+	******************************************************************************************************/
+	static MsvLogContextData* Create(const char* key, spdlog::string_view_t value);
+
+	/**************************************************************************************************//**
+	* @brief				Format context.
+	* @details			Appends fields of context to output (" {key1=value1, key2=value2}").
+	* @param[in]		pContext							Context.
+	* @param[in,out]	output							Output string.
+	******************************************************************************************************/
+	static void Format(const MsvLogContextData* pContext, std::string& output);
+};
+
+
+#endif // !MARSTECH_LOGCONTEXT_H
+
+/** @} */	//End of group MSYS.
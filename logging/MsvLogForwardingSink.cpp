@@ -0,0 +1,256 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Forwarding Sink
+* @details		Contains implementation of @ref MsvLogForwardingSink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvLogForwardingSink.h"
+#include "MsvLogTicks.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvLogForwardingSink::MsvLogForwardingSink(std::shared_ptr<MsvTimestamp> spTimestamp):
+	m_logLevel(spdlog::level::info),
+	m_spTimestamp(spTimestamp)
+{
+
+}
+
+MsvLogForwardingSink::~MsvLogForwardingSink()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogForwardingSink public methods
+********************************************************************************************************************************/
+
+
+std::shared_ptr<MsvLogForwardingSink> MsvLogForwardingSink::GetForwardingSink(const std::shared_ptr<MsvLogger>& spLogger)
+{
+	if (!spLogger)
+	{
+		return nullptr;
+	}
+
+	//logger sinks are not changed after logger has been created (read only access)
+	for (const spdlog::sink_ptr& spSink: spLogger->sinks())
+	{
+		std::shared_ptr<MsvLogForwardingSink> spForwardingSink = std::dynamic_pointer_cast<MsvLogForwardingSink>(spSink);
+		if (spForwardingSink)
+		{
+			return spForwardingSink;
+		}
+	}
+
+	return nullptr;
+}
+
+void MsvLogForwardingSink::SetLoggerLevel(const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel)
+{
+	std::shared_ptr<MsvLogForwardingSink> spForwardingSink = GetForwardingSink(spLogger);
+	if (!spForwardingSink)
+	{
+		if (spLogger)
+		{
+			spLogger->set_level(logLevel);
+		}
+
+		return;
+	}
+
+	//sink levels are atomic words (sinks are owned by this logger only)
+	for (const spdlog::sink_ptr& spSink: spLogger->sinks())
+	{
+		if (spSink != spForwardingSink)
+		{
+			spSink->set_level(logLevel);
+		}
+	}
+
+	spForwardingSink->SetLogLevel(*spLogger, logLevel);
+}
+
+MsvErrorCode MsvLogForwardingSink::AttachSink(spdlog::sink_ptr spSink, bool followLogLevel)
+{
+	if (!spSink)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	std::shared_ptr<const std::vector<MsvLogForwardedSink>> spSinks = std::atomic_load(&m_spSinks);
+	if (spSinks && std::find_if(spSinks->begin(), spSinks->end(), [&spSink](const MsvLogForwardedSink& sink) { return sink.spSink == spSink; }) != spSinks->end())
+	{
+		return MSV_ALREADY_EXISTS_ERROR;
+	}
+
+	std::shared_ptr<std::vector<MsvLogForwardedSink>> spNewSinks(new (std::nothrow) std::vector<MsvLogForwardedSink>());
+	if (!spNewSinks)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	if (spSinks)
+	{
+		*spNewSinks = *spSinks;
+	}
+
+	spNewSinks->push_back(MsvLogForwardedSink{spSink, followLogLevel});
+	std::atomic_store(&m_spSinks, std::shared_ptr<const std::vector<MsvLogForwardedSink>>(spNewSinks));
+
+	return MSV_SUCCESS;
+}
+
+void MsvLogForwardingSink::SetLogLevel(MsvLogger& logger, MsvLogLevel logLevel)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	m_logLevel.store(logLevel, std::memory_order_relaxed);
+	UpdateLoggerLevelLocked(logger);
+}
+
+void MsvLogForwardingSink::UpdateLoggerLevel(MsvLogger& logger)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	UpdateLoggerLevelLocked(logger);
+}
+
+void MsvLogForwardingSink::Forward(const spdlog::details::log_msg& msg, bool bypassLogLevel)
+{
+	std::shared_ptr<const std::vector<MsvLogForwardedSink>> spSinks = std::atomic_load(&m_spSinks);
+	if (!spSinks)
+	{
+		return;
+	}
+
+	bool logLevelEnabled = bypassLogLevel || msg.level >= m_logLevel.load(std::memory_order_relaxed);
+
+	//attached sinks get wall time (ticks are converted only when there is any attached sink)
+	uint64_t ticks = 0;
+	if (m_spTimestamp && MsvLogTimeToTicks(msg.time, ticks))
+	{
+		spdlog::details::log_msg wallTimeMsg(msg);
+		wallTimeMsg.time = m_spTimestamp->TicksToTime(ticks);
+		ForwardTo(*spSinks, wallTimeMsg, logLevelEnabled);
+	}
+	else
+	{
+		ForwardTo(*spSinks, msg, logLevelEnabled);
+	}
+}
+
+
+/********************************************************************************************************************************
+*															spdlog::sinks::sink public methods
+********************************************************************************************************************************/
+
+
+void MsvLogForwardingSink::log(const spdlog::details::log_msg& msg)
+{
+	Forward(msg, false);
+}
+
+void MsvLogForwardingSink::flush()
+{
+	std::shared_ptr<const std::vector<MsvLogForwardedSink>> spSinks = std::atomic_load(&m_spSinks);
+	if (!spSinks)
+	{
+		return;
+	}
+
+	for (const MsvLogForwardedSink& sink: *spSinks)
+	{
+		sink.spSink->flush();
+	}
+}
+
+void MsvLogForwardingSink::set_pattern(const std::string& /*pattern*/)
+{
+
+}
+
+void MsvLogForwardingSink::set_formatter(std::unique_ptr<spdlog::formatter> /*sink_formatter*/)
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogForwardingSink protected methods
+********************************************************************************************************************************/
+
+
+void MsvLogForwardingSink::ForwardTo(const std::vector<MsvLogForwardedSink>& sinks, const spdlog::details::log_msg& msg, bool logLevelEnabled)
+{
+	for (const MsvLogForwardedSink& sink: sinks)
+	{
+		if ((logLevelEnabled || !sink.followLogLevel) && sink.spSink->should_log(msg.level))
+		{
+			sink.spSink->log(msg);
+		}
+	}
+}
+
+void MsvLogForwardingSink::UpdateLoggerLevelLocked(MsvLogger& logger)
+{
+	MsvLogLevel logLevel = static_cast<MsvLogLevel>(m_logLevel.load(std::memory_order_relaxed));
+
+	std::shared_ptr<const std::vector<MsvLogForwardedSink>> spSinks = std::atomic_load(&m_spSinks);
+	if (spSinks)
+	{
+		for (const MsvLogForwardedSink& sink: *spSinks)
+		{
+			if (!sink.followLogLevel)
+			{
+				logLevel = (std::min)(logLevel, sink.spSink->level());
+			}
+		}
+	}
+
+	logger.set_level(logLevel);
+}
+
+/** @} */	//End of group MSYS.
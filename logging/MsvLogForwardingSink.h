@@ -0,0 +1,226 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Forwarding Sink
+* @details		Contains declaration of @ref MsvLogForwardingSink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGFORWARDINGSINK_H
+#define MARSTECH_LOGFORWARDINGSINK_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+#include "msys/timestamp/MsvTimestamp.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <spdlog/sinks/sink.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Forwarded Sink.
+* @details	Sink attached to @ref MsvLogForwardingSink.
+******************************************************************************************************/
+struct MsvLogForwardedSink
+{
+	spdlog::sink_ptr spSink;								///< Attached sink.
+	bool followLogLevel;										///< Sink gets messages of configured log level only.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Forwarding Sink.
+* @details	Spdlog sink which forwards log messages to attached sinks (flight recorder, log shipper). It is
+*				added to logger by logger provider when logger is created (before it is shared), sinks are
+*				attached later to immutable list which is atomically swapped, so logger sinks are never changed
+*				while logger is used by more threads. It keeps configured log level of logger: other logger sinks
+*				are set to this level and logger level is lowered to levels of attached sinks which do not follow
+*				it (see @ref SetLoggerLevel).
+* @note		Attached sinks keep their levels and formatters (they might be shared by more loggers).
+******************************************************************************************************/
+class MsvLogForwardingSink:
+	public spdlog::sinks::sink
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spTimestamp				Timestamp which converts ticks of log time (see @ref MsvLogTicks) to wall
+	*												time before messages are forwarded (nullptr when logger does not accept
+	*												ticks).
+	******************************************************************************************************/
+	MsvLogForwardingSink(std::shared_ptr<MsvTimestamp> spTimestamp = nullptr);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvLogForwardingSink();
+
+	/**************************************************************************************************//**
+	* @brief			Get forwarding sink.
+	* @details		Finds forwarding sink of logger.
+	* @param[in]	spLogger					Logger.
+	* @returns		std::shared_ptr<MsvLogForwardingSink>
+	* @retval		nullptr					When logger has no forwarding sink.
+	******************************************************************************************************/
+	static std::shared_ptr<MsvLogForwardingSink> GetForwardingSink(const std::shared_ptr<MsvLogger>& spLogger);
+
+	/**************************************************************************************************//**
+	* @brief			Set logger level.
+	* @details		Sets configured log level of logger. Level of logger sinks (except forwarding sink) is set to it
+	*					and logger level is updated by forwarding sink (see @ref SetLogLevel). Logger level is set
+	*					directly when logger has no forwarding sink (it has not been created by logger provider of
+	*					this library).
+	* @param[in]	spLogger					Logger.
+	* @param[in]	logLevel					Configured log level.
+	******************************************************************************************************/
+	static void SetLoggerLevel(const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel);
+
+	/**************************************************************************************************//**
+	* @brief			Attach sink.
+	* @details		Adds sink to list of attached sinks (new list is published, it is safe while logging).
+	* @param[in]	spSink					Sink to attach.
+	* @param[in]	followLogLevel			Sink gets messages of configured log level only. Logger level must be
+	*												updated (@ref UpdateLoggerLevel) when it is false.
+	* @retval		MSV_INVALID_DATA_ERROR		When sink is empty.
+	* @retval		MSV_ALREADY_EXISTS_ERROR	When sink has been already attached.
+	* @retval		MSV_ALLOCATION_ERROR		When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode AttachSink(spdlog::sink_ptr spSink, bool followLogLevel);
+
+	/**************************************************************************************************//**
+	* @brief			Set log level.
+	* @details		Stores configured log level and updates logger level (see @ref UpdateLoggerLevel).
+	* @param[in]	logger					Logger which owns this sink.
+	* @param[in]	logLevel					Configured log level.
+	******************************************************************************************************/
+	void SetLogLevel(MsvLogger& logger, MsvLogLevel logLevel);
+
+	/**************************************************************************************************//**
+	* @brief			Update logger level.
+	* @details		Sets logger level to the lowest of configured log level and levels of attached sinks which do
+	*					not follow it. It must be called when level of such sink is changed.
+	* @param[in]	logger					Logger which owns this sink.
+	******************************************************************************************************/
+	void UpdateLoggerLevel(MsvLogger& logger);
+
+	/**************************************************************************************************//**
+	* @brief			Forward message.
+	* @details		Forwards message to attached sinks whose level allows it (ticks of log time are converted to
+	*					wall time).
+	* @param[in]	msg						Log message.
+	* @param[in]	bypassLogLevel			Configured log level is bypassed (levels of attached sinks are kept).
+	******************************************************************************************************/
+	void Forward(const spdlog::details::log_msg& msg, bool bypassLogLevel);
+
+	/**************************************************************************************************//**
+	* @brief			Log message.
+	* @details		Forwards message to attached sinks whose level allows it (see @ref Forward).
+	* @param[in]	msg						Log message.
+	******************************************************************************************************/
+	virtual void log(const spdlog::details::log_msg& msg) override;
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Flushes attached sinks.
+	******************************************************************************************************/
+	virtual void flush() override;
+
+	/**************************************************************************************************//**
+	* @brief			Set pattern.
+	* @details		Ignored - attached sinks keep their own formatting.
+	* @param[in]	pattern					Formatting pattern.
+	******************************************************************************************************/
+	virtual void set_pattern(const std::string& pattern) override;
+
+	/**************************************************************************************************//**
+	* @brief			Set formatter.
+	* @details		Ignored - attached sinks keep their own formatting.
+	* @param[in]	sink_formatter			Formatter.
+	******************************************************************************************************/
+	virtual void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Forward message to sinks.
+	* @details		Logs message to attached sinks whose level allows it.
+	* @param[in]	sinks						Attached sinks.
+	* @param[in]	msg						Log message (with wall time).
+	* @param[in]	logLevelEnabled		Message is not below configured log level (or it is bypassed).
+	******************************************************************************************************/
+	void ForwardTo(const std::vector<MsvLogForwardedSink>& sinks, const spdlog::details::log_msg& msg, bool logLevelEnabled);
+
+	/**************************************************************************************************//**
+	* @brief			Update logger level.
+	* @details		Sets logger level to the lowest of configured log level and levels of attached sinks which do
+	*					not follow it.
+	* @param[in]	logger					Logger which owns this sink.
+	* @warning		It must be called under lock.
+	******************************************************************************************************/
+	void UpdateLoggerLevelLocked(MsvLogger& logger);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Serializes changes of attached sinks and logger level (log calls do not lock).
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Attached sinks.
+	* @details	Immutable list of attached sinks (it is accessed by std::atomic_load and std::atomic_store).
+	******************************************************************************************************/
+	std::shared_ptr<const std::vector<MsvLogForwardedSink>> m_spSinks;
+
+	/**************************************************************************************************//**
+	* @brief		Log level.
+	* @details	Configured log level of logger (it is read by log calls).
+	******************************************************************************************************/
+	spdlog::level_t m_logLevel;
+
+	/**************************************************************************************************//**
+	* @brief		Timestamp.
+	* @details	Converts ticks of log time to wall time (nullptr when logger does not accept ticks).
+	******************************************************************************************************/
+	std::shared_ptr<MsvTimestamp> m_spTimestamp;
+};
+
+
+#endif // !MARSTECH_LOGFORWARDINGSINK_H
+
+/** @} */	//End of group MSYS.
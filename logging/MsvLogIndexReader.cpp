@@ -0,0 +1,312 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Index Reader
+* @details		Contains implementation of @ref MsvLogIndexReader.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvLogIndexReader.h"
+#include "MsvLogIndexWriter.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Read size.
+* @details	Size of one read of log file (in bytes).
+******************************************************************************************************/
+#define MSV_LOG_INDEX_READ_SIZE 1048576
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Index Range.
+* @details	Part of log file which has to be read.
+******************************************************************************************************/
+struct MsvLogIndexRange
+{
+	uint64_t begin;												///< Range begin (offset in log file).
+	uint64_t end;													///< Range end (offset in log file).
+};
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvLogIndexReader::MsvLogIndexReader():
+	m_cachedTime(0)
+{
+
+}
+
+
+MsvLogIndexReader::~MsvLogIndexReader()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogIndexReader public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvLogIndexReader::Query(const char* logFile, std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, uint32_t levelMask, const char* loggerName, std::ostream& output)
+{
+	std::ifstream file(logFile, std::ios::binary);
+	if (!file)
+	{
+		return MSV_NOT_FOUND_ERROR;
+	}
+
+	file.seekg(0, std::ios::end);
+	uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+
+	int64_t fromTime = std::chrono::duration_cast<std::chrono::nanoseconds>(from.time_since_epoch()).count();
+	int64_t toTime = std::chrono::duration_cast<std::chrono::nanoseconds>(to.time_since_epoch()).count();
+	size_t loggerNameSize = loggerName ? std::strlen(loggerName) : 0;
+
+	//matching blocks and parts of file which are not indexed (index is ordered by offset)
+	std::vector<MsvLogIndexRange> ranges;
+	uint64_t position = 0;
+
+	std::ifstream index(std::string(logFile) + MSV_LOG_INDEX_EXTENSION, std::ios::binary);
+	MsvLogIndexHeader header;
+	if (index && index.read(reinterpret_cast<char*>(&header), sizeof(header)) && std::memcmp(header.magic, MSV_LOG_INDEX_MAGIC, sizeof(header.magic)) == 0 && header.entrySize == sizeof(MsvLogIndexEntry))
+	{
+		MsvLogIndexEntry entry;
+		while (index.read(reinterpret_cast<char*>(&entry), sizeof(entry)) && entry.offset < fileSize)
+		{
+			if (entry.offset < position)
+			{
+				//index does not belong to this file
+				break;
+			}
+
+			if (entry.offset > position)
+			{
+				ranges.push_back(MsvLogIndexRange{position, entry.offset});
+			}
+
+			if ((entry.levelMask & levelMask) && entry.firstTime <= toTime && entry.lastTime >= fromTime)
+			{
+				ranges.push_back(MsvLogIndexRange{entry.offset, (std::min)(entry.offset + entry.size, fileSize)});
+			}
+
+			position = entry.offset + entry.size;
+		}
+	}
+
+	if (position < fileSize)
+	{
+		ranges.push_back(MsvLogIndexRange{position, fileSize});
+	}
+
+	//lines of file written with other pattern are never parsed (query would silently return nothing)
+	uint64_t lines = 0;
+	uint64_t records = 0;
+
+	std::string buffer;
+	for (size_t i = 0; i < ranges.size(); ++i)
+	{
+		//adjacent ranges are read at once
+		uint64_t begin = ranges[i].begin;
+		uint64_t end = ranges[i].end;
+		while (i + 1 < ranges.size() && ranges[i + 1].begin == end)
+		{
+			end = ranges[++i].end;
+		}
+
+		file.clear();
+		file.seekg(static_cast<std::streamoff>(begin));
+
+		buffer.clear();
+		bool matching = false;
+		while (begin < end || !buffer.empty())
+		{
+			size_t readSize = static_cast<size_t>((std::min)(end - begin, static_cast<uint64_t>(MSV_LOG_INDEX_READ_SIZE)));
+			size_t bufferSize = buffer.size();
+			buffer.resize(bufferSize + readSize);
+			file.read(&buffer[bufferSize], static_cast<std::streamsize>(readSize));
+			buffer.resize(bufferSize + static_cast<size_t>(file.gcount()));
+			begin = file.gcount() > 0 ? begin + static_cast<uint64_t>(file.gcount()) : end;
+
+			size_t lineStart = 0;
+			while (lineStart < buffer.size())
+			{
+				size_t lineEnd = buffer.find('\n', lineStart);
+				if (lineEnd == std::string::npos)
+				{
+					//the last line is completed by next read
+					if (begin < end)
+					{
+						break;
+					}
+
+					lineEnd = buffer.size() - 1;
+				}
+
+				const char* pLine = buffer.data() + lineStart;
+				size_t lineSize = lineEnd + 1 - lineStart;
+
+				int64_t time = 0;
+				MsvLogLevel level = MsvLogLevel::off;
+				const char* pLoggerName = nullptr;
+				size_t recordLoggerNameSize = 0;
+				++lines;
+				if (ParseRecord(pLine, lineSize, time, level, pLoggerName, recordLoggerNameSize))
+				{
+					++records;
+					matching = time >= fromTime && time <= toTime && (MSV_LOG_LEVEL_MASK(level) & levelMask)
+						&& (!loggerNameSize || (recordLoggerNameSize == loggerNameSize && std::memcmp(pLoggerName, loggerName, loggerNameSize) == 0));
+				}
+
+				if (matching)
+				{
+					output.write(pLine, static_cast<std::streamsize>(lineSize));
+					if (pLine[lineSize - 1] != '\n')
+					{
+						output.put('\n');
+					}
+				}
+
+				lineStart = lineEnd + 1;
+			}
+
+			buffer.erase(0, lineStart);
+		}
+	}
+
+	if (lines && !records)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogIndexReader protected methods
+********************************************************************************************************************************/
+
+
+bool MsvLogIndexReader::ParseRecord(const char* pLine, size_t size, int64_t& time, MsvLogLevel& level, const char*& pLoggerName, size_t& loggerNameSize)
+{
+	//"[YYYY-mm-dd HH:MM:SS.mmm] [logger] [level] "
+	static const char* const pTimeFormat = "[dddd-dd-dd dd:dd:dd.ddd] [";
+	static const size_t timeFormatSize = std::strlen(pTimeFormat);
+
+	if (size < timeFormatSize)
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < timeFormatSize; ++i)
+	{
+		if (pTimeFormat[i] == 'd' ? (pLine[i] < '0' || pLine[i] > '9') : pLine[i] != pTimeFormat[i])
+		{
+			return false;
+		}
+	}
+
+	const char* pEnd = pLine + size;
+	pLoggerName = pLine + timeFormatSize;
+	const char* pLoggerNameEnd = std::search(pLoggerName, pEnd, "] [", "] [" + 3);
+	if (pLoggerNameEnd == pEnd)
+	{
+		return false;
+	}
+	loggerNameSize = static_cast<size_t>(pLoggerNameEnd - pLoggerName);
+
+	const char* pLevel = pLoggerNameEnd + 3;
+	const char* pLevelEnd = std::find(pLevel, pEnd, ']');
+	if (pLevelEnd == pEnd)
+	{
+		return false;
+	}
+
+	spdlog::string_view_t levelName(pLevel, static_cast<size_t>(pLevelEnd - pLevel));
+	level = MsvLogLevel::off;
+	for (int i = 0; i < static_cast<int>(MsvLogLevel::off); ++i)
+	{
+		if (spdlog::level::to_string_view(static_cast<MsvLogLevel>(i)) == levelName)
+		{
+			level = static_cast<MsvLogLevel>(i);
+			break;
+		}
+	}
+
+	if (level == MsvLogLevel::off)
+	{
+		return false;
+	}
+
+	//local time conversion is done once per second
+	if (m_cachedSecond.compare(0, std::string::npos, pLine + 1, 19) != 0)
+	{
+		auto number = [pLine](size_t position, size_t digits) {
+			int value = 0;
+			for (size_t i = 0; i < digits; ++i)
+			{
+				value = value * 10 + (pLine[position + i] - '0');
+			}
+			return value;
+		};
+
+		std::tm localTime = {};
+		localTime.tm_year = number(1, 4) - 1900;
+		localTime.tm_mon = number(6, 2) - 1;
+		localTime.tm_mday = number(9, 2);
+		localTime.tm_hour = number(12, 2);
+		localTime.tm_min = number(15, 2);
+		localTime.tm_sec = number(18, 2);
+		localTime.tm_isdst = -1;
+
+		m_cachedTime = std::mktime(&localTime);
+		m_cachedSecond.assign(pLine + 1, 19);
+	}
+
+	int64_t milliseconds = (pLine[21] - '0') * 100 + (pLine[22] - '0') * 10 + (pLine[23] - '0');
+	time = (static_cast<int64_t>(m_cachedTime) * 1000 + milliseconds) * 1000000;
+
+	return true;
+}
+
+/** @} */	//End of group MSYS.
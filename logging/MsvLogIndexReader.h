@@ -0,0 +1,126 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Index Reader
+* @details		Contains definition of @ref MsvLogIndexReader.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGINDEXREADER_H
+#define MARSTECH_LOGINDEXREADER_H
+
+
+#include "IMsvAsyncLoggerProvider.h"
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <ostream>
+#include <string>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Index Reader.
+* @details	Searches log file written with sidecar index (see @ref MsvLogIndexWriter). Only blocks whose time
+*				range and level bitmap match query are read, parts of log file which are not indexed (records
+*				written before index was created and the newest block) are scanned whole. Records have to be
+*				written with default pattern "[date time.ms] [logger] [level] message", lines which do not start
+*				with this prefix are continuation of previous record.
+******************************************************************************************************/
+class MsvLogIndexReader
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvLogIndexReader();
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	******************************************************************************************************/
+	~MsvLogIndexReader();
+
+	/**************************************************************************************************//**
+	* @brief			Query.
+	* @details		Writes records of log file which match time range, levels and logger to output. Whole log
+	*					file is scanned when it has no index.
+	* @param[in]	logFile						Log file path (index is "<log file>.idx").
+	* @param[in]	from							The oldest matching log time.
+	* @param[in]	to								The newest matching log time.
+	* @param[in]	levelMask					Matching levels (see @ref MSV_LOG_LEVEL_MASK).
+	* @param[in]	loggerName					Matching logger name (nullptr or empty string means all loggers).
+	* @param[out]	output						Text output.
+	* @retval		MSV_NOT_FOUND_ERROR		When log file could not be read.
+	* @retval		MSV_INVALID_DATA_ERROR	When no read line starts with record prefix (records are not written
+	*												with default pattern).
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode Query(const char* logFile, std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to, uint32_t levelMask, const char* loggerName, std::ostream& output);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Parse record.
+	* @details		Parses prefix of record line.
+	* @param[in]	pLine							Line.
+	* @param[in]	size							Line size.
+	* @param[out]	time							Log time (ns since epoch).
+	* @param[out]	level							Log level.
+	* @param[out]	pLoggerName					Logger name (in line).
+	* @param[out]	loggerNameSize				Logger name size.
+	* @returns		bool
+	* @retval		true							When line starts with record prefix.
+	* @retval		false							When line is continuation of previous record.
+	******************************************************************************************************/
+	bool ParseRecord(const char* pLine, size_t size, int64_t& time, MsvLogLevel& level, const char*& pLoggerName, size_t& loggerNameSize);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Cached second.
+	* @details	Date and time (without milliseconds) of last parsed record.
+	******************************************************************************************************/
+	std::string m_cachedSecond;
+
+	/**************************************************************************************************//**
+	* @brief		Cached time.
+	* @details	Time of cached second (records are written in local time and its conversion is slow).
+	******************************************************************************************************/
+	std::time_t m_cachedTime;
+};
+
+
+#endif // !MARSTECH_LOGINDEXREADER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,184 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Index Writer
+* @details		Contains implementation of @ref MsvLogIndexWriter.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvLogIndexWriter.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstring>
+
+MSV_ENABLE_WARNINGS
+
+
+static_assert(sizeof(MsvLogIndexHeader) == 16, "Log index header must have 16 bytes.");
+static_assert(sizeof(MsvLogIndexEntry) == 40, "Log index entry must have 40 bytes.");
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvLogIndexWriter::MsvLogIndexWriter(uint32_t blockSize):
+	m_blockSize(blockSize),
+	m_pFile(nullptr),
+	m_block()
+{
+
+}
+
+
+MsvLogIndexWriter::~MsvLogIndexWriter()
+{
+	Close();
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogIndexWriter public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvLogIndexWriter::Open(const std::string& logFile, uint64_t fileSize)
+{
+	Close();
+
+	std::string indexFile = logFile + MSV_LOG_INDEX_EXTENSION;
+
+	//existing index is appended only when it has same format (and log file has not been recreated)
+	bool validIndex = false;
+	FILE* pIndex = fileSize ? std::fopen(indexFile.c_str(), "rb") : nullptr;
+	if (pIndex)
+	{
+		MsvLogIndexHeader header;
+		validIndex = std::fread(&header, sizeof(header), 1, pIndex) == 1 && std::memcmp(header.magic, MSV_LOG_INDEX_MAGIC, sizeof(header.magic)) == 0
+			&& header.blockSize == m_blockSize && header.entrySize == sizeof(MsvLogIndexEntry);
+		std::fclose(pIndex);
+	}
+
+	m_pFile = std::fopen(indexFile.c_str(), validIndex ? "ab" : "wb");
+	if (!m_pFile)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (!validIndex)
+	{
+		MsvLogIndexHeader header;
+		std::memcpy(header.magic, MSV_LOG_INDEX_MAGIC, sizeof(header.magic));
+		header.blockSize = m_blockSize;
+		header.entrySize = sizeof(MsvLogIndexEntry);
+		std::fwrite(&header, sizeof(header), 1, m_pFile);
+	}
+
+	//records written before index has been created are not indexed (reader scans gaps)
+	m_block = MsvLogIndexEntry();
+	m_block.offset = fileSize;
+
+	return MSV_SUCCESS;
+}
+
+void MsvLogIndexWriter::Close()
+{
+	if (!m_pFile)
+	{
+		return;
+	}
+
+	WriteBlock();
+	std::fclose(m_pFile);
+	m_pFile = nullptr;
+}
+
+void MsvLogIndexWriter::AddRecord(uint64_t offset, size_t size, int64_t time, MsvLogLevel level)
+{
+	if (!m_pFile)
+	{
+		return;
+	}
+
+	//record does not follow block (it should not happen) -> start new block
+	if (m_block.recordsCount && offset != m_block.offset + m_block.size)
+	{
+		WriteBlock();
+	}
+
+	if (!m_block.recordsCount)
+	{
+		m_block.offset = offset;
+		m_block.firstTime = time;
+		m_block.lastTime = time;
+	}
+
+	//records of more threads might not be ordered by time
+	m_block.size += static_cast<uint32_t>(size);
+	++m_block.recordsCount;
+	m_block.firstTime = time < m_block.firstTime ? time : m_block.firstTime;
+	m_block.lastTime = time > m_block.lastTime ? time : m_block.lastTime;
+	m_block.levelMask |= 1u << static_cast<uint32_t>(level);
+
+	if (m_block.size >= m_blockSize)
+	{
+		WriteBlock();
+	}
+}
+
+void MsvLogIndexWriter::Flush()
+{
+	if (m_pFile)
+	{
+		std::fflush(m_pFile);
+	}
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogIndexWriter protected methods
+********************************************************************************************************************************/
+
+
+void MsvLogIndexWriter::WriteBlock()
+{
+	if (m_block.recordsCount)
+	{
+		std::fwrite(&m_block, sizeof(m_block), 1, m_pFile);
+	}
+
+	uint64_t offset = m_block.offset + m_block.size;
+	m_block = MsvLogIndexEntry();
+	m_block.offset = offset;
+}
+
+/** @} */	//End of group MSYS.
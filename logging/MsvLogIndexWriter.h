@@ -0,0 +1,175 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Index Writer
+* @details		Contains definition of @ref MsvLogIndexWriter.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGINDEXWRITER_H
+#define MARSTECH_LOGINDEXWRITER_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Log index file magic.
+* @details	First bytes of log index file (the last byte is format version).
+******************************************************************************************************/
+#define MSV_LOG_INDEX_MAGIC "MSVLIDX\x01"
+
+/**************************************************************************************************//**
+* @brief		Log index file extension.
+* @details	Index of log file is stored in "<log file>.idx".
+******************************************************************************************************/
+#define MSV_LOG_INDEX_EXTENSION ".idx"
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Index Header.
+* @details	Header of log index file (it is followed by entries).
+******************************************************************************************************/
+struct MsvLogIndexHeader
+{
+	char magic[8];													///< File magic (@ref MSV_LOG_INDEX_MAGIC).
+	uint32_t blockSize;											///< Minimum size of indexed block (in bytes).
+	uint32_t entrySize;											///< Entry size (in bytes).
+};
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Index Entry.
+* @details	Time range and levels of records in one block of log file.
+******************************************************************************************************/
+struct MsvLogIndexEntry
+{
+	uint64_t offset;												///< Block offset in log file (in bytes).
+	uint32_t size;													///< Block size (in bytes).
+	uint32_t recordsCount;										///< Number of records in block.
+	int64_t firstTime;											///< Log time of the oldest record (ns since epoch).
+	int64_t lastTime;												///< Log time of the newest record (ns since epoch).
+	uint32_t levelMask;											///< Levels of records in block (bit 1 << level).
+	uint32_t reserved;											///< Reserved.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Index Writer.
+* @details	Writes compact sidecar index of log file. Records are grouped to blocks of at least block size
+*				bytes and one entry (offset, time range and level bitmap) is written for each block. Log
+*				searches (see @ref MsvLogIndexReader) read only blocks matching time range and levels.
+* @note		It is single threaded (it is used by file sink only).
+******************************************************************************************************/
+class MsvLogIndexWriter
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	blockSize						Minimum size of indexed block (in bytes).
+	******************************************************************************************************/
+	MsvLogIndexWriter(uint32_t blockSize);
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	* @details	Closes index file.
+	******************************************************************************************************/
+	~MsvLogIndexWriter();
+
+	/**************************************************************************************************//**
+	* @brief			Open index.
+	* @details		Opens index of log file (entries are appended to existing index). Index which is not
+	*					valid (or has different block size) and index of empty log file is recreated.
+	* @param[in]	logFile							Log file path (index is "<log file>.idx").
+	* @param[in]	fileSize							Current size of log file (first block starts here).
+	* @retval		MSV_INVALID_DATA_ERROR		When index file could not be opened.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Open(const std::string& logFile, uint64_t fileSize);
+
+	/**************************************************************************************************//**
+	* @brief			Close index.
+	* @details		Writes entry of current block and closes index file.
+	******************************************************************************************************/
+	void Close();
+
+	/**************************************************************************************************//**
+	* @brief			Add record.
+	* @details		Adds record to current block (entry is written when block reaches block size).
+	* @param[in]	offset							Record offset in log file (in bytes).
+	* @param[in]	size								Record size (in bytes).
+	* @param[in]	time								Log time (ns since epoch).
+	* @param[in]	level								Log level.
+	******************************************************************************************************/
+	void AddRecord(uint64_t offset, size_t size, int64_t time, MsvLogLevel level);
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Flushes written entries to index file.
+	******************************************************************************************************/
+	void Flush();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Write block.
+	* @details		Writes entry of current block (when it has any record) and starts new block.
+	******************************************************************************************************/
+	void WriteBlock();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Block size.
+	* @details	Minimum size of indexed block (in bytes).
+	******************************************************************************************************/
+	uint32_t m_blockSize;
+
+	/**************************************************************************************************//**
+	* @brief		Index file.
+	******************************************************************************************************/
+	FILE* m_pFile;
+
+	/**************************************************************************************************//**
+	* @brief		Current block.
+	* @details	Entry of block which is being filled.
+	******************************************************************************************************/
+	MsvLogIndexEntry m_block;
+};
+
+
+#endif // !MARSTECH_LOGINDEXWRITER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,246 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Level Binding Implementation
+* @details		Contains implementation of @ref MsvLogLevelBinding class.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvLogLevelBinding.h"
+#include "MsvLogCategory.h"
+#include "MsvLogForwardingSink.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvLogLevelBinding::MsvLogLevelBinding(std::shared_ptr<IMsvActiveConfig> spActiveConfig, uint32_t refreshPeriod, std::atomic<uint32_t>* pLogCategories):
+	m_spActiveConfig(spActiveConfig),
+	m_pLogCategories(pLogCategories),
+	m_refreshPeriod(refreshPeriod),
+	m_running(false)
+{
+
+}
+
+
+MsvLogLevelBinding::~MsvLogLevelBinding()
+{
+	Stop();
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogLevelBinding public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvLogLevelBinding::Start()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (!m_spActiveConfig || m_refreshPeriod == 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (m_running)
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	m_running = true;
+	m_thread = std::thread(&MsvLogLevelBinding::RefreshThread, this);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogLevelBinding::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (!m_running)
+		{
+			return MSV_NOT_RUNNING_INFO;
+		}
+
+		m_running = false;
+	}
+
+	m_condition.notify_all();
+	m_thread.join();
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															IMsvLogLevelBinding public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvLogLevelBinding::BindLogger(std::shared_ptr<MsvLogger> spLogger, int32_t levelKey)
+{
+	if (!spLogger)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	m_entries.push_back(MsvLogLevelBindingEntry{spLogger, nullptr, false, levelKey, -1});
+	RefreshEntry(m_entries.back());
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogLevelBinding::BindBinaryLogger(std::shared_ptr<IMsvBinaryLogger> spLogger, int32_t levelKey)
+{
+	if (!spLogger)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	m_entries.push_back(MsvLogLevelBindingEntry{nullptr, spLogger, false, levelKey, -1});
+	RefreshEntry(m_entries.back());
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogLevelBinding::BindLogCategories(int32_t categoriesKey)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	m_entries.push_back(MsvLogLevelBindingEntry{nullptr, nullptr, true, categoriesKey, -1});
+	RefreshEntry(m_entries.back());
+
+	return MSV_SUCCESS;
+}
+
+void MsvLogLevelBinding::UnbindAll()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	m_entries.clear();
+}
+
+MsvErrorCode MsvLogLevelBinding::Refresh()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	for (MsvLogLevelBindingEntry& entry: m_entries)
+	{
+		RefreshEntry(entry);
+	}
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogLevelBinding protected methods
+********************************************************************************************************************************/
+
+
+void MsvLogLevelBinding::RefreshThread()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	while (m_running)
+	{
+		if (m_condition.wait_for(lock, std::chrono::milliseconds(m_refreshPeriod), [this] { return !m_running; }))
+		{
+			break;
+		}
+
+		for (MsvLogLevelBindingEntry& entry: m_entries)
+		{
+			RefreshEntry(entry);
+		}
+	}
+}
+
+void MsvLogLevelBinding::RefreshEntry(MsvLogLevelBindingEntry& entry)
+{
+	if (!m_spActiveConfig)
+	{
+		return;
+	}
+
+	int32_t level = 0;
+	if (MSV_FAILED(m_spActiveConfig->GetValue(entry.levelKey, level)))
+	{
+		return;
+	}
+
+	if (entry.logCategories)
+	{
+		//value is bit mask (all bits are valid)
+		uint32_t categories = static_cast<uint32_t>(level);
+		if (static_cast<int64_t>(categories) != entry.lastValue)
+		{
+			m_pLogCategories->store(categories, std::memory_order_relaxed);
+			entry.lastValue = categories;
+		}
+
+		return;
+	}
+
+	if (level < spdlog::level::trace || level > spdlog::level::off || level == entry.lastValue)
+	{
+		return;
+	}
+
+	//logger and sink levels are atomic words (log calls read them by relaxed load)
+	if (entry.spLogger)
+	{
+		MsvLogForwardingSink::SetLoggerLevel(entry.spLogger, static_cast<MsvLogLevel>(level));
+	}
+
+	if (entry.spBinaryLogger)
+	{
+		entry.spBinaryLogger->SetLogLevel(static_cast<MsvLogLevel>(level));
+	}
+
+	entry.lastValue = level;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,199 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Level Binding Implementation
+* @details		Contains definition of @ref MsvLogLevelBinding class.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGLEVELBINDING_H
+#define MARSTECH_LOGLEVELBINDING_H
+
+
+#include "IMsvLogLevelBinding.h"
+
+#include "mconfig/mactivecfg/IMsvActiveConfig.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Level Binding Entry.
+* @details	One logger (or log category mask) bound to active config key.
+******************************************************************************************************/
+struct MsvLogLevelBindingEntry
+{
+	std::shared_ptr<MsvLogger> spLogger;						///< Bound logger (or nullptr).
+	std::shared_ptr<IMsvBinaryLogger> spBinaryLogger;		///< Bound binary logger (or nullptr).
+	bool logCategories;												///< True when log category mask is bound (instead of logger).
+	int32_t levelKey;													///< Active config key of log level (or log categories).
+	int64_t lastValue;												///< Last applied value (-1 when no value has been applied).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Level Binding.
+* @details	Implementation of log level binding interface. Background thread refreshes bound levels
+*				with configured period.
+* @see		IMsvLogLevelBinding
+******************************************************************************************************/
+class MsvLogLevelBinding:
+	public IMsvLogLevelBinding
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spActiveConfig			Active config with log level keys.
+	* @param[in]	refreshPeriod			Refresh period (in milliseconds).
+	* @param[in]	pLogCategories			Global mask of enabled log categories (owned by @ref MsvLogging).
+	******************************************************************************************************/
+	MsvLogLevelBinding(std::shared_ptr<IMsvActiveConfig> spActiveConfig, uint32_t refreshPeriod, std::atomic<uint32_t>* pLogCategories);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Stops refresh thread.
+	******************************************************************************************************/
+	virtual ~MsvLogLevelBinding();
+
+	/**************************************************************************************************//**
+	* @brief			Start.
+	* @details		Starts refresh thread.
+	* @retval		MSV_INVALID_DATA_ERROR		When active config is empty or refresh period is zero.
+	* @retval		MSV_ALREADY_RUNNING_INFO		When refresh thread is already running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Start();
+
+	/**************************************************************************************************//**
+	* @brief			Stop.
+	* @details		Stops refresh thread.
+	* @retval		MSV_NOT_RUNNING_INFO			When refresh thread is not running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Stop();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogLevelBinding::BindLogger(std::shared_ptr<MsvLogger> spLogger, int32_t levelKey)
+	******************************************************************************************************/
+	virtual MsvErrorCode BindLogger(std::shared_ptr<MsvLogger> spLogger, int32_t levelKey) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogLevelBinding::BindBinaryLogger(std::shared_ptr<IMsvBinaryLogger> spLogger, int32_t levelKey)
+	******************************************************************************************************/
+	virtual MsvErrorCode BindBinaryLogger(std::shared_ptr<IMsvBinaryLogger> spLogger, int32_t levelKey) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogLevelBinding::BindLogCategories(int32_t categoriesKey)
+	******************************************************************************************************/
+	virtual MsvErrorCode BindLogCategories(int32_t categoriesKey) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogLevelBinding::UnbindAll()
+	******************************************************************************************************/
+	virtual void UnbindAll() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogLevelBinding::Refresh()
+	******************************************************************************************************/
+	virtual MsvErrorCode Refresh() override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Refresh thread.
+	* @details		Refreshes bound levels until it is stopped.
+	******************************************************************************************************/
+	void RefreshThread();
+
+	/**************************************************************************************************//**
+	* @brief				Refresh entry.
+	* @details			Reads level (or log categories) of entry and applies it when it has been changed.
+	* @param[in,out]	entry						Binding entry.
+	******************************************************************************************************/
+	void RefreshEntry(MsvLogLevelBindingEntry& entry);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Condition.
+	* @details	Wakes refresh thread when it is stopped.
+	******************************************************************************************************/
+	std::condition_variable m_condition;
+
+	/**************************************************************************************************//**
+	* @brief		Active config.
+	* @details	Active config with log level keys.
+	******************************************************************************************************/
+	std::shared_ptr<IMsvActiveConfig> m_spActiveConfig;
+
+	/**************************************************************************************************//**
+	* @brief		Log categories.
+	* @details	Global mask of enabled log categories (owned by @ref MsvLogging).
+	******************************************************************************************************/
+	std::atomic<uint32_t>* m_pLogCategories;
+
+	/**************************************************************************************************//**
+	* @brief		Refresh period.
+	* @details	Refresh period (in milliseconds).
+	******************************************************************************************************/
+	uint32_t m_refreshPeriod;
+
+	/**************************************************************************************************//**
+	* @brief		Entries.
+	* @details	Bound loggers.
+	******************************************************************************************************/
+	std::vector<MsvLogLevelBindingEntry> m_entries;
+
+	/**************************************************************************************************//**
+	* @brief		Refresh thread.
+	* @details	Background thread which refreshes bound levels.
+	******************************************************************************************************/
+	std::thread m_thread;
+
+	/**************************************************************************************************//**
+	* @brief		Running flag.
+	* @details	True when refresh thread is running.
+	******************************************************************************************************/
+	bool m_running;
+};
+
+
+#endif // !MARSTECH_LOGLEVELBINDING_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,306 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Macros
+* @details		Contains log macros with compile time log level.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGMACROS_H
+#define MARSTECH_LOGMACROS_H
+
+
+#include "MsvLogCategory.h"
+#include "MsvLogRateLimiter.h"
+#include "MsvLogTicks.h"
+
+#include "mlogging/mlogging.h"
+
+
+/**************************************************************************************************//**
+* @brief		Log level values.
+* @details	Values of log levels for preprocessor (same as spdlog::level::level_enum values).
+******************************************************************************************************/
+#define MSV_LOG_LEVEL_TRACE 0
+#define MSV_LOG_LEVEL_DEBUG 1					///< @copydoc MSV_LOG_LEVEL_TRACE
+#define MSV_LOG_LEVEL_INFO 2					///< @copydoc MSV_LOG_LEVEL_TRACE
+#define MSV_LOG_LEVEL_WARN 3					///< @copydoc MSV_LOG_LEVEL_TRACE
+#define MSV_LOG_LEVEL_ERROR 4					///< @copydoc MSV_LOG_LEVEL_TRACE
+#define MSV_LOG_LEVEL_CRITICAL 5				///< @copydoc MSV_LOG_LEVEL_TRACE
+#define MSV_LOG_LEVEL_OFF 6					///< @copydoc MSV_LOG_LEVEL_TRACE
+
+
+/**************************************************************************************************//**
+* @brief		Compile time log level.
+* @details	Log calls below this level are removed by preprocessor (including evaluation of their
+*				arguments). Runtime log level (IMsvLogging::SetLogLevel) works above this level only.
+*				Define it (for whole project) to override default value.
+* @note		Default value is INFO level for release builds (NDEBUG) and TRACE level other way.
+******************************************************************************************************/
+#ifndef MSV_LOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define MSV_LOG_ACTIVE_LEVEL MSV_LOG_LEVEL_INFO
+#else
+#define MSV_LOG_ACTIVE_LEVEL MSV_LOG_LEVEL_TRACE
+#endif
+#endif
+
+
+/**************************************************************************************************//**
+* @brief		Log macro.
+* @details	Logs with logger (shared pointer to @ref MsvLogger) when runtime log level is enabled.
+*				Arguments are not evaluated when log level is disabled. Loggers of async logger provider get
+*				timestamp ticks as log time (wall clock is not read, see @ref MsvLogWrite).
+******************************************************************************************************/
+#define MSV_LOG(spLogger, logLevel, ...) \
+	do \
+	{ \
+		if (spLogger && spLogger->should_log(logLevel)) \
+		{ \
+			MsvLogWrite(spLogger, logLevel, __VA_ARGS__); \
+		} \
+	} while (0)
+
+/**************************************************************************************************//**
+* @brief		Rate limited log macro.
+* @details	Logs at most maxPerSecond messages per second from this call site. Count of suppressed
+*				messages is written (as separate message) before the first message of next window or by
+*				background thread of rate limit registry when call site stops logging (see
+*				@ref IMsvLogRateLimitRegistry). Call site state is static (no locking).
+******************************************************************************************************/
+#define MSV_LOG_RATE_LIMITED(spLogger, logLevel, maxPerSecond, ...) \
+	do \
+	{ \
+		if (spLogger && spLogger->should_log(logLevel)) \
+		{ \
+			static MsvLogRateLimitSite msvLogRateLimitSite{{0}, {0}, {0}, {nullptr}}; \
+			uint64_t msvLogSuppressed = 0; \
+			bool msvLogAllowed = MsvLogRateLimit(msvLogRateLimitSite, maxPerSecond, msvLogSuppressed); \
+			if (msvLogSuppressed) \
+			{ \
+				MsvLogWrite(spLogger, logLevel, "Message has been suppressed {} times ({}:{}).", msvLogSuppressed, __FILE__, __LINE__); \
+			} \
+			if (msvLogAllowed) \
+			{ \
+				MsvLogWrite(spLogger, logLevel, __VA_ARGS__); \
+			} \
+			else \
+			{ \
+				MsvLogRateLimitRegister(msvLogRateLimitSite, spLogger, logLevel, __FILE__, __LINE__); \
+			} \
+		} \
+	} while (0)
+
+/**************************************************************************************************//**
+* @brief		Sampled log macro.
+* @details	Logs first of each n messages from this call site. Call site state is static (no locking).
+******************************************************************************************************/
+#define MSV_LOG_EVERY_N(spLogger, logLevel, n, ...) \
+	do \
+	{ \
+		if (spLogger && spLogger->should_log(logLevel)) \
+		{ \
+			static MsvLogSampleSite msvLogSampleSite{{0}}; \
+			if (MsvLogSample(msvLogSampleSite, n)) \
+			{ \
+				MsvLogWrite(spLogger, logLevel, __VA_ARGS__); \
+			} \
+		} \
+	} while (0)
+
+/**************************************************************************************************//**
+* @brief		Categorized log macro.
+* @details	Logs when runtime log level is enabled or when any of categories is enabled (see
+*				@ref MsvLogCategoryMask). Messages of enabled categories bypass log level (levels of sinks
+*				attached to forwarding sink are kept). Arguments are not evaluated when both log level and categories are disabled.
+******************************************************************************************************/
+#define MSV_LOG_CAT(spLogger, categories, logLevel, ...) \
+	do \
+	{ \
+		if (spLogger) \
+		{ \
+			if (spLogger->should_log(logLevel)) \
+			{ \
+				MsvLogWrite(spLogger, logLevel, __VA_ARGS__); \
+			} \
+			else if (MsvLogCategoryEnabled(categories)) \
+			{ \
+				MsvLogCategoryMessage(spLogger, logLevel, fmt::format(__VA_ARGS__)); \
+			} \
+		} \
+	} while (0)
+
+/**************************************************************************************************//**
+* @brief		Disabled log macro.
+* @details	Log call removed at compile time (logger and arguments are not evaluated).
+******************************************************************************************************/
+#define MSV_LOG_DISABLED(spLogger, ...) \
+	do \
+	{ \
+		(void)sizeof(spLogger); \
+	} while (0)
+
+
+//replace mlogging macros (they evaluate arguments even when log level is disabled)
+#undef MSV_LOG_TRACE
+#undef MSV_LOG_DEBUG
+#undef MSV_LOG_INFO
+#undef MSV_LOG_WARN
+#undef MSV_LOG_ERROR
+#undef MSV_LOG_CRITICAL
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_TRACE
+#define MSV_LOG_TRACE(spLogger, ...) MSV_LOG(spLogger, spdlog::level::trace, __VA_ARGS__)			///< Log trace.
+#else
+#define MSV_LOG_TRACE(spLogger, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_DEBUG
+#define MSV_LOG_DEBUG(spLogger, ...) MSV_LOG(spLogger, spdlog::level::debug, __VA_ARGS__)			///< Log debug.
+#else
+#define MSV_LOG_DEBUG(spLogger, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_INFO
+#define MSV_LOG_INFO(spLogger, ...) MSV_LOG(spLogger, spdlog::level::info, __VA_ARGS__)				///< Log info.
+#else
+#define MSV_LOG_INFO(spLogger, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_WARN
+#define MSV_LOG_WARN(spLogger, ...) MSV_LOG(spLogger, spdlog::level::warn, __VA_ARGS__)				///< Log warning.
+#else
+#define MSV_LOG_WARN(spLogger, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_ERROR
+#define MSV_LOG_ERROR(spLogger, ...) MSV_LOG(spLogger, spdlog::level::err, __VA_ARGS__)				///< Log error.
+#else
+#define MSV_LOG_ERROR(spLogger, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_CRITICAL
+#define MSV_LOG_CRITICAL(spLogger, ...) MSV_LOG(spLogger, spdlog::level::critical, __VA_ARGS__)	///< Log critical.
+#else
+#define MSV_LOG_CRITICAL(spLogger, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+
+//rate limited and sampled variants
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_TRACE
+#define MSV_LOG_TRACE_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_RATE_LIMITED(spLogger, spdlog::level::trace, maxPerSecond, __VA_ARGS__)	///< Log trace (rate limited).
+#define MSV_LOG_TRACE_EVERY_N(spLogger, n, ...) MSV_LOG_EVERY_N(spLogger, spdlog::level::trace, n, __VA_ARGS__)										///< Log trace (sampled).
+#else
+#define MSV_LOG_TRACE_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_DISABLED(spLogger)
+#define MSV_LOG_TRACE_EVERY_N(spLogger, n, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_DEBUG
+#define MSV_LOG_DEBUG_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_RATE_LIMITED(spLogger, spdlog::level::debug, maxPerSecond, __VA_ARGS__)	///< Log debug (rate limited).
+#define MSV_LOG_DEBUG_EVERY_N(spLogger, n, ...) MSV_LOG_EVERY_N(spLogger, spdlog::level::debug, n, __VA_ARGS__)										///< Log debug (sampled).
+#else
+#define MSV_LOG_DEBUG_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_DISABLED(spLogger)
+#define MSV_LOG_DEBUG_EVERY_N(spLogger, n, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_INFO
+#define MSV_LOG_INFO_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_RATE_LIMITED(spLogger, spdlog::level::info, maxPerSecond, __VA_ARGS__)	///< Log info (rate limited).
+#define MSV_LOG_INFO_EVERY_N(spLogger, n, ...) MSV_LOG_EVERY_N(spLogger, spdlog::level::info, n, __VA_ARGS__)										///< Log info (sampled).
+#else
+#define MSV_LOG_INFO_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_DISABLED(spLogger)
+#define MSV_LOG_INFO_EVERY_N(spLogger, n, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_WARN
+#define MSV_LOG_WARN_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_RATE_LIMITED(spLogger, spdlog::level::warn, maxPerSecond, __VA_ARGS__)	///< Log warning (rate limited).
+#define MSV_LOG_WARN_EVERY_N(spLogger, n, ...) MSV_LOG_EVERY_N(spLogger, spdlog::level::warn, n, __VA_ARGS__)										///< Log warning (sampled).
+#else
+#define MSV_LOG_WARN_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_DISABLED(spLogger)
+#define MSV_LOG_WARN_EVERY_N(spLogger, n, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_ERROR
+#define MSV_LOG_ERROR_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_RATE_LIMITED(spLogger, spdlog::level::err, maxPerSecond, __VA_ARGS__)	///< Log error (rate limited).
+#define MSV_LOG_ERROR_EVERY_N(spLogger, n, ...) MSV_LOG_EVERY_N(spLogger, spdlog::level::err, n, __VA_ARGS__)										///< Log error (sampled).
+#else
+#define MSV_LOG_ERROR_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_DISABLED(spLogger)
+#define MSV_LOG_ERROR_EVERY_N(spLogger, n, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_CRITICAL
+#define MSV_LOG_CRITICAL_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_RATE_LIMITED(spLogger, spdlog::level::critical, maxPerSecond, __VA_ARGS__)	///< Log critical (rate limited).
+#define MSV_LOG_CRITICAL_EVERY_N(spLogger, n, ...) MSV_LOG_EVERY_N(spLogger, spdlog::level::critical, n, __VA_ARGS__)										///< Log critical (sampled).
+#else
+#define MSV_LOG_CRITICAL_RATE_LIMITED(spLogger, maxPerSecond, ...) MSV_LOG_DISABLED(spLogger)
+#define MSV_LOG_CRITICAL_EVERY_N(spLogger, n, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+
+//categorized variants
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_TRACE
+#define MSV_LOG_CAT_TRACE(spLogger, categories, ...) MSV_LOG_CAT(spLogger, categories, spdlog::level::trace, __VA_ARGS__)	///< Log trace (categorized).
+#else
+#define MSV_LOG_CAT_TRACE(spLogger, categories, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_DEBUG
+#define MSV_LOG_CAT_DEBUG(spLogger, categories, ...) MSV_LOG_CAT(spLogger, categories, spdlog::level::debug, __VA_ARGS__)	///< Log debug (categorized).
+#else
+#define MSV_LOG_CAT_DEBUG(spLogger, categories, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_INFO
+#define MSV_LOG_CAT_INFO(spLogger, categories, ...) MSV_LOG_CAT(spLogger, categories, spdlog::level::info, __VA_ARGS__)	///< Log info (categorized).
+#else
+#define MSV_LOG_CAT_INFO(spLogger, categories, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_WARN
+#define MSV_LOG_CAT_WARN(spLogger, categories, ...) MSV_LOG_CAT(spLogger, categories, spdlog::level::warn, __VA_ARGS__)	///< Log warning (categorized).
+#else
+#define MSV_LOG_CAT_WARN(spLogger, categories, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_ERROR
+#define MSV_LOG_CAT_ERROR(spLogger, categories, ...) MSV_LOG_CAT(spLogger, categories, spdlog::level::err, __VA_ARGS__)	///< Log error (categorized).
+#else
+#define MSV_LOG_CAT_ERROR(spLogger, categories, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_CRITICAL
+#define MSV_LOG_CAT_CRITICAL(spLogger, categories, ...) MSV_LOG_CAT(spLogger, categories, spdlog::level::critical, __VA_ARGS__)	///< Log critical (categorized).
+#else
+#define MSV_LOG_CAT_CRITICAL(spLogger, categories, ...) MSV_LOG_DISABLED(spLogger)
+#endif
+
+
+#endif // !MARSTECH_LOGMACROS_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,200 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Rate Limit Registry
+* @details		Contains implementation of @ref MsvLogRateLimitRegistry.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvLogRateLimitRegistry.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvLogRateLimitRegistry::MsvLogRateLimitRegistry():
+	m_running(false)
+{
+
+}
+
+
+MsvLogRateLimitRegistry::~MsvLogRateLimitRegistry()
+{
+	bool running = false;
+
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		running = m_running;
+		m_running = false;
+	}
+
+	if (running)
+	{
+		m_condition.notify_all();
+		m_thread.join();
+	}
+
+	WriteSummaries(true);
+
+	for (std::pair<MsvLogRateLimitSite* const, MsvLogRateLimitEntry>& site: m_sites)
+	{
+		site.first->pRegistry.store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+
+/********************************************************************************************************************************
+*															IMsvLogRateLimitRegistry public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvLogRateLimitRegistry::RegisterSite(MsvLogRateLimitSite& site, const void* pOwner, const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel, const char* file, uint32_t line)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_sites.find(&site) != m_sites.end())
+	{
+		return MSV_ALREADY_EXISTS_ERROR;
+	}
+
+	m_sites[&site] = MsvLogRateLimitEntry{pOwner, spLogger, logLevel, file ? file : "", line};
+
+	if (!m_running)
+	{
+		m_running = true;
+		m_thread = std::thread(&MsvLogRateLimitRegistry::FlushThread, this);
+	}
+
+	return MSV_SUCCESS;
+}
+
+void MsvLogRateLimitRegistry::UnregisterSites(const void* pOwner)
+{
+	WriteSummaries(false, pOwner);
+}
+
+MsvErrorCode MsvLogRateLimitRegistry::Flush()
+{
+	WriteSummaries(true);
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogRateLimitRegistry protected methods
+********************************************************************************************************************************/
+
+
+void MsvLogRateLimitRegistry::WriteSummaries(bool all, const void* pUnregisterOwner)
+{
+	struct MsvLogRateLimitSummary
+	{
+		std::shared_ptr<MsvLogger> spLogger;
+		MsvLogLevel logLevel;
+		std::string file;
+		uint32_t line;
+		uint64_t suppressed;
+	};
+
+	std::vector<MsvLogRateLimitSummary> summaries;
+
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+		for (std::map<MsvLogRateLimitSite*, MsvLogRateLimitEntry>::iterator it = m_sites.begin(); it != m_sites.end();)
+		{
+			bool unregister = pUnregisterOwner && it->second.pOwner == pUnregisterOwner;
+
+			//site which still logs reports its count by its next window
+			if (!all && !unregister && now - it->first->windowStart.load(std::memory_order_relaxed) < 1000)
+			{
+				++it;
+				continue;
+			}
+
+			uint64_t suppressed = it->first->suppressed.exchange(0, std::memory_order_relaxed);
+			std::shared_ptr<MsvLogger> spLogger = it->second.spLogger.lock();
+			if (suppressed && spLogger)
+			{
+				summaries.push_back(MsvLogRateLimitSummary{spLogger, it->second.logLevel, it->second.file, it->second.line, suppressed});
+			}
+
+			if (unregister)
+			{
+				//site might be registered again (to other registry)
+				it->first->pRegistry.store(nullptr, std::memory_order_relaxed);
+				it = m_sites.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	//loggers are called without lock (they might block)
+	for (const MsvLogRateLimitSummary& summary: summaries)
+	{
+		summary.spLogger->log(summary.logLevel, "Message has been suppressed {} times ({}:{}).", summary.suppressed, summary.file, summary.line);
+	}
+}
+
+void MsvLogRateLimitRegistry::FlushThread()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	while (m_running)
+	{
+		if (m_condition.wait_for(lock, std::chrono::milliseconds(1000), [this] { return !m_running; }))
+		{
+			break;
+		}
+
+		lock.unlock();
+		WriteSummaries(false);
+		lock.lock();
+	}
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,154 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Rate Limit Registry
+* @details		Contains implementation @ref MsvLogRateLimitRegistry of @ref IMsvLogRateLimitRegistry interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGRATELIMITREGISTRY_H
+#define MARSTECH_LOGRATELIMITREGISTRY_H
+
+
+#include "IMsvLogRateLimitRegistry.h"
+#include "MsvLogRateLimiter.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Rate Limit Entry.
+* @details	Registered rate limited call site.
+******************************************************************************************************/
+struct MsvLogRateLimitEntry
+{
+	const void* pOwner;											///< Binary which owns site.
+	std::weak_ptr<MsvLogger> spLogger;						///< Logger of summary (it might be released).
+	MsvLogLevel logLevel;										///< Log level of summary.
+	std::string file;												///< Source file of call site.
+	uint32_t line;													///< Source line of call site.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Rate Limit Registry.
+* @details	Implementation of rate limit registry interface. Background thread (started with first registered
+*				site) writes summaries of sites which have not logged in last second.
+* @see		IMsvLogRateLimitRegistry
+******************************************************************************************************/
+class MsvLogRateLimitRegistry:
+	public IMsvLogRateLimitRegistry
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvLogRateLimitRegistry();
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Stops background thread and writes summaries of all sites.
+	******************************************************************************************************/
+	virtual ~MsvLogRateLimitRegistry();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogRateLimitRegistry::RegisterSite(MsvLogRateLimitSite& site, const void* pOwner, const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel, const char* file, uint32_t line)
+	******************************************************************************************************/
+	virtual MsvErrorCode RegisterSite(MsvLogRateLimitSite& site, const void* pOwner, const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel, const char* file, uint32_t line) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogRateLimitRegistry::UnregisterSites(const void* pOwner)
+	******************************************************************************************************/
+	virtual void UnregisterSites(const void* pOwner) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogRateLimitRegistry::Flush()
+	******************************************************************************************************/
+	virtual MsvErrorCode Flush() override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Write summaries.
+	* @details		Writes summaries of suppressed calls.
+	* @param[in]	all								True to write summaries of all sites, false to write summaries of
+	*														sites which have not logged in last second.
+	* @param[in]	pUnregisterOwner			Owner (binary) whose sites are written and unregistered (nullptr when
+	*														no site is unregistered).
+	******************************************************************************************************/
+	void WriteSummaries(bool all, const void* pUnregisterOwner = nullptr);
+
+	/**************************************************************************************************//**
+	* @brief		Flush thread.
+	* @details	Writes summaries of idle sites once a second until registry is destroyed.
+	******************************************************************************************************/
+	void FlushThread();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access (sites are accessed under it only).
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Condition variable.
+	* @details	Wakes flush thread when registry is destroyed.
+	******************************************************************************************************/
+	std::condition_variable m_condition;
+
+	/**************************************************************************************************//**
+	* @brief		Sites.
+	* @details	Registered sites (static storage of bound binaries).
+	******************************************************************************************************/
+	std::map<MsvLogRateLimitSite*, MsvLogRateLimitEntry> m_sites;
+
+	/**************************************************************************************************//**
+	* @brief		Flush thread.
+	* @details	Background thread which writes summaries of idle sites.
+	******************************************************************************************************/
+	std::thread m_thread;
+
+	/**************************************************************************************************//**
+	* @brief		Running flag.
+	* @details	True when flush thread is running.
+	******************************************************************************************************/
+	bool m_running;
+};
+
+
+#endif // !MARSTECH_LOGRATELIMITREGISTRY_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,187 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Rate Limiter
+* @details		Contains per call site log rate limiting and sampling.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGRATELIMITER_H
+#define MARSTECH_LOGRATELIMITER_H
+
+
+#include "IMsvLogRateLimitRegistry.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Rate Limit Site.
+* @details	State of one rate limited log call site (static storage, it is never locked).
+* @see		MSV_LOG_RATE_LIMITED
+******************************************************************************************************/
+struct MsvLogRateLimitSite
+{
+	std::atomic<int64_t> windowStart;						///< Start of current one second window (ms of steady clock).
+	std::atomic<uint32_t> windowCount;						///< Number of log calls in current window.
+	std::atomic<uint64_t> suppressed;						///< Number of suppressed log calls (not reported yet).
+	std::atomic<IMsvLogRateLimitRegistry*> pRegistry;	///< Registry which site has been registered to (or nullptr).
+};
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Sample Site.
+* @details	State of one sampled log call site (static storage, it is never locked).
+* @see		MSV_LOG_EVERY_N
+******************************************************************************************************/
+struct MsvLogSampleSite
+{
+	std::atomic<uint64_t> counter;							///< Number of log calls.
+};
+
+
+/**************************************************************************************************//**
+* @brief			Log rate limit binding.
+* @details		Returns cached rate limit registry which is used by rate limited log calls of this binary (EXE
+*					or DLL). Suppressed count of site is written just by its next allowed call while this binary is
+*					not bound (nullptr).
+* @returns		std::atomic<IMsvLogRateLimitRegistry*>&
+* @note			Each binary has its own copy of this function (and cached pointer). Its address identifies
+*					binary in registry.
+******************************************************************************************************/
+inline std::atomic<IMsvLogRateLimitRegistry*>& MsvLogRateLimitBinding()
+{
+	static std::atomic<IMsvLogRateLimitRegistry*> pRegistry(nullptr);
+	return pRegistry;
+}
+
+/**************************************************************************************************//**
+* @brief			Bind log rate limit registry.
+* @details		Caches rate limit registry for rate limited log calls of this binary. Sites of this binary are
+*					unregistered from previous registry.
+* @param[in]	pRegistry					Rate limit registry (@ref IMsvLogging::GetLogRateLimitRegistry),
+*													nullptr unbinds this binary.
+* @warning		Binary must be unbound before @ref IMsvLogging is released (and before binary is unloaded).
+* @see			MsvLogBind
+******************************************************************************************************/
+inline void MsvLogRateLimitBind(IMsvLogRateLimitRegistry* pRegistry)
+{
+	IMsvLogRateLimitRegistry* pPrevious = MsvLogRateLimitBinding().exchange(pRegistry, std::memory_order_acq_rel);
+	if (pPrevious && pPrevious != pRegistry)
+	{
+		pPrevious->UnregisterSites(&MsvLogRateLimitBinding());
+	}
+}
+
+/**************************************************************************************************//**
+* @brief			Register rate limited site.
+* @details		Registers site to bound rate limit registry (once), so its suppressed count is written even when
+*					site does not log anymore. It is called when site suppresses log call.
+* @param[in]	site						Call site state.
+* @param[in]	spLogger					Logger of summary.
+* @param[in]	logLevel					Log level of summary.
+* @param[in]	file						Source file of call site.
+* @param[in]	line						Source line of call site.
+* @note			Site is registered with logger of its first suppressed call.
+******************************************************************************************************/
+inline void MsvLogRateLimitRegister(MsvLogRateLimitSite& site, const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel, const char* file, uint32_t line)
+{
+	IMsvLogRateLimitRegistry* pRegistry = MsvLogRateLimitBinding().load(std::memory_order_acquire);
+	if (!pRegistry || site.pRegistry.load(std::memory_order_relaxed) == pRegistry)
+	{
+		return;
+	}
+
+	if (site.pRegistry.exchange(pRegistry, std::memory_order_relaxed) != pRegistry)
+	{
+		pRegistry->RegisterSite(site, &MsvLogRateLimitBinding(), spLogger, logLevel, file, line);
+	}
+}
+
+/**************************************************************************************************//**
+* @brief			Rate limit log call.
+* @details		Checks if log call is allowed (at most maxPerSecond calls in one second window).
+*					Suppressed calls are counted and their count is returned by first allowed call of next window
+*					(or written by rate limit registry, see @ref MsvLogRateLimitRegister).
+* @param[in]	site						Call site state.
+* @param[in]	maxPerSecond			Maximum number of log calls per second.
+* @param[out]	suppressed				Number of suppressed calls to report (0 when there is nothing to report).
+* @returns		bool
+* @retval		true						When log call is allowed.
+* @retval		false						When log call is suppressed.
+******************************************************************************************************/
+inline bool MsvLogRateLimit(MsvLogRateLimitSite& site, uint32_t maxPerSecond, uint64_t& suppressed)
+{
+	suppressed = 0;
+
+	int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	int64_t windowStart = site.windowStart.load(std::memory_order_relaxed);
+
+	if (now - windowStart >= 1000 && site.windowStart.compare_exchange_strong(windowStart, now, std::memory_order_relaxed))
+	{
+		//new window (only one thread opens it) -> report suppressed calls of previous windows
+		site.windowCount.store(0, std::memory_order_relaxed);
+		suppressed = site.suppressed.exchange(0, std::memory_order_relaxed);
+	}
+
+	if (site.windowCount.fetch_add(1, std::memory_order_relaxed) < maxPerSecond)
+	{
+		return true;
+	}
+
+	site.suppressed.fetch_add(1, std::memory_order_relaxed);
+
+	return false;
+}
+
+/**************************************************************************************************//**
+* @brief			Sample log call.
+* @details		Checks if log call is allowed (first of each n calls).
+* @param[in]	site						Call site state.
+* @param[in]	n							Sampling rate (1 in n calls is logged).
+* @returns		bool
+* @retval		true						When log call is allowed.
+* @retval		false						When log call is skipped.
+******************************************************************************************************/
+inline bool MsvLogSample(MsvLogSampleSite& site, uint64_t n)
+{
+	return n <= 1 || site.counter.fetch_add(1, std::memory_order_relaxed) % n == 0;
+}
+
+
+#endif // !MARSTECH_LOGRATELIMITER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,76 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Record
+* @details		Contains definition of @ref MsvLogRecord structure.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGRECORD_H
+#define MARSTECH_LOGRECORD_H
+
+
+#include "MsvLogContext.h"
+
+#include "mlogging/mlogging.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstddef>
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Inline payload size.
+* @details	Payloads up to this size are stored directly in log record (without allocation).
+******************************************************************************************************/
+#define MSV_LOG_RECORD_PAYLOAD_SIZE 192
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Record.
+* @details	Log record passed from log call to background thread of @ref MsvAsyncLogBackend.
+******************************************************************************************************/
+struct MsvLogRecord
+{
+	uint64_t ticks;												///< Log time (timestamp ticks, see @ref MsvTimestamp).
+	size_t threadId;												///< ID of logging thread.
+	uint32_t targetId;											///< ID of target (logger and its sinks) in backend.
+	MsvLogLevel level;											///< Log level.
+	uint32_t payloadSize;										///< Payload size (in bytes).
+	char* pLongPayload;											///< Allocated payload (when it does not fit to inline payload).
+	MsvLogContextData* pContext;								///< Captured log context (or nullptr, see @ref MsvLogContext).
+	char payload[MSV_LOG_RECORD_PAYLOAD_SIZE];				///< Inline payload.
+};
+
+
+#endif // !MARSTECH_LOGRECORD_H
+
+/** @} */	//End of group MSYS.
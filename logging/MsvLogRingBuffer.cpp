@@ -0,0 +1,160 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Ring Buffer
+* @details		Contains implementation of lock-free log ring buffer.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvLogRingBuffer.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvLogRingBuffer::MsvLogRingBuffer(size_t capacity):
+	m_mask(0),
+	m_enqueuePosition(0),
+	m_dequeuePosition(0)
+{
+	size_t powerOfTwo = 2;
+	while (powerOfTwo < capacity)
+	{
+		powerOfTwo <<= 1;
+	}
+
+	m_mask = powerOfTwo - 1;
+}
+
+
+MsvLogRingBuffer::~MsvLogRingBuffer()
+{
+	if (!m_spSlots)
+	{
+		return;
+	}
+
+	//release allocated payloads and contexts of unread records
+	while (MsvLogRingSlot* pSlot = BeginPop())
+	{
+		delete[] pSlot->record.pLongPayload;
+		MsvLogContext::Release(pSlot->record.pContext);
+		EndPop(pSlot);
+	}
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogRingBuffer public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvLogRingBuffer::Initialize()
+{
+	m_spSlots.reset(new (std::nothrow) MsvLogRingSlot[m_mask + 1]);
+	if (!m_spSlots)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	for (size_t i = 0; i <= m_mask; ++i)
+	{
+		m_spSlots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	return MSV_SUCCESS;
+}
+
+MsvLogRingSlot* MsvLogRingBuffer::BeginPush()
+{
+	size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+	while (true)
+	{
+		MsvLogRingSlot* pSlot = &m_spSlots[position & m_mask];
+		size_t sequence = pSlot->sequence.load(std::memory_order_acquire);
+		intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+		if (difference == 0)
+		{
+			//slot is free -> claim it
+			if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				return pSlot;
+			}
+		}
+		else if (difference < 0)
+		{
+			//slot has not been read yet -> full
+			return nullptr;
+		}
+		else
+		{
+			position = m_enqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void MsvLogRingBuffer::EndPush(MsvLogRingSlot* pSlot)
+{
+	size_t position = pSlot->sequence.load(std::memory_order_relaxed);
+	pSlot->sequence.store(position + 1, std::memory_order_release);
+}
+
+MsvLogRingSlot* MsvLogRingBuffer::BeginPop()
+{
+	size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+	MsvLogRingSlot* pSlot = &m_spSlots[position & m_mask];
+
+	if (pSlot->sequence.load(std::memory_order_acquire) != position + 1)
+	{
+		return nullptr;
+	}
+
+	return pSlot;
+}
+
+void MsvLogRingBuffer::EndPop(MsvLogRingSlot* pSlot)
+{
+	size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+	m_dequeuePosition.store(position + 1, std::memory_order_relaxed);
+	pSlot->sequence.store(position + m_mask + 1, std::memory_order_release);
+}
+
+bool MsvLogRingBuffer::IsEmpty() const
+{
+	size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+
+	return m_spSlots[position & m_mask].sequence.load(std::memory_order_acquire) != position + 1;
+}
+
+/** @} */	//End of group MSYS.
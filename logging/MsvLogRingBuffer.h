@@ -0,0 +1,158 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Ring Buffer
+* @details		Contains definition of lock-free log ring buffer.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGRINGBUFFER_H
+#define MARSTECH_LOGRINGBUFFER_H
+
+
+#include "MsvLogRecord.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Ring Slot.
+* @details	Slot of @ref MsvLogRingBuffer. Sequence tells if slot is free for producer or full for consumer.
+******************************************************************************************************/
+struct alignas(64) MsvLogRingSlot
+{
+	std::atomic<size_t> sequence;				///< Slot sequence.
+	MsvLogRecord record;							///< Log record.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Ring Buffer.
+* @details	Bounded lock-free multi producer single consumer queue of log records (Vyukov's bounded
+*				queue). Records are written directly to slots (two phase push and pop), so there is
+*				no copy and no allocation in log call.
+******************************************************************************************************/
+class MsvLogRingBuffer
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	capacity				Requested capacity (it is rounded up to power of two).
+	******************************************************************************************************/
+	MsvLogRingBuffer(size_t capacity);
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	******************************************************************************************************/
+	~MsvLogRingBuffer();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize ring buffer.
+	* @details		Allocates slots.
+	* @retval		MSV_ALLOCATION_ERROR		When memory allocation failed.
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize();
+
+	/**************************************************************************************************//**
+	* @brief			Begin push.
+	* @details		Claims free slot for producer.
+	* @returns		MsvLogRingSlot*
+	* @retval		nullptr						When ring buffer is full.
+	* @note			Claimed slot must be passed to @ref EndPush when record is written.
+	******************************************************************************************************/
+	MsvLogRingSlot* BeginPush();
+
+	/**************************************************************************************************//**
+	* @brief			End push.
+	* @details		Publishes written slot to consumer.
+	* @param[in]	pSlot							Slot returned by @ref BeginPush.
+	******************************************************************************************************/
+	void EndPush(MsvLogRingSlot* pSlot);
+
+	/**************************************************************************************************//**
+	* @brief			Begin pop.
+	* @details		Returns the oldest published slot.
+	* @returns		MsvLogRingSlot*
+	* @retval		nullptr						When ring buffer is empty.
+	* @warning		It must be called by one (consumer) thread only.
+	******************************************************************************************************/
+	MsvLogRingSlot* BeginPop();
+
+	/**************************************************************************************************//**
+	* @brief			End pop.
+	* @details		Releases read slot to producers.
+	* @param[in]	pSlot							Slot returned by @ref BeginPop.
+	******************************************************************************************************/
+	void EndPop(MsvLogRingSlot* pSlot);
+
+	/**************************************************************************************************//**
+	* @brief			Check if ring buffer is empty.
+	* @returns		bool
+	* @retval		true							When there is no published slot.
+	* @retval		false							When there is at least one published slot.
+	******************************************************************************************************/
+	bool IsEmpty() const;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Slots.
+	* @details	Ring of slots.
+	******************************************************************************************************/
+	std::unique_ptr<MsvLogRingSlot[]> m_spSlots;
+
+	/**************************************************************************************************//**
+	* @brief		Mask.
+	* @details	Capacity - 1 (capacity is power of two).
+	******************************************************************************************************/
+	size_t m_mask;
+
+	/**************************************************************************************************//**
+	* @brief		Enqueue position.
+	* @details	Position of next push (shared by producers).
+	******************************************************************************************************/
+	alignas(64) std::atomic<size_t> m_enqueuePosition;
+
+	/**************************************************************************************************//**
+	* @brief		Dequeue position.
+	* @details	Position of next pop (consumer only).
+	******************************************************************************************************/
+	alignas(64) std::atomic<size_t> m_dequeuePosition;
+};
+
+
+#endif // !MARSTECH_LOGRINGBUFFER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,461 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Rotator
+* @details		Contains implementation of @ref MsvLogRotator.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvLogRotator.h"
+
+#include "MsvLogIndexWriter.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <vector>
+
+#include <spdlog/details/os.h>
+#include <spdlog/sinks/rotating_file_sink.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif // _WIN32
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvLogRotator::MsvLogRotator():
+	m_running(false),
+	m_stop(false),
+	m_busy(false)
+{
+
+}
+
+
+MsvLogRotator::~MsvLogRotator()
+{
+	Stop();
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogRotator public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvLogRotator::Start()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_running)
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	m_stop = false;
+	m_running = true;
+	m_thread = std::thread(&MsvLogRotator::RotatorThread, this);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogRotator::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (!m_running)
+		{
+			return MSV_NOT_RUNNING_INFO;
+		}
+
+		m_running = false;
+		m_stop = true;
+	}
+
+	m_condition.notify_all();
+	m_thread.join();
+
+	return MSV_SUCCESS;
+}
+
+void MsvLogRotator::AddJob(const MsvLogRotatorJob& job)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (m_running)
+		{
+			m_jobs.push_back(job);
+			m_condition.notify_all();
+			return;
+		}
+	}
+
+	//sink might outlive stopped rotator -> rotation is synchronous
+	DoJob(job);
+}
+
+MsvErrorCode MsvLogRotator::WaitForIdle()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	if (!m_running)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	m_condition.wait(lock, [this] { return (m_jobs.empty() && !m_busy) || m_stop; });
+
+	return MSV_SUCCESS;
+}
+
+MsvLogFileHandle MsvLogRotator::OpenFile(const std::string& file, size_t maxLogFileSize, size_t& fileSize)
+{
+#ifdef _WIN32
+	HANDLE hFile = CreateFileA(file.c_str(), FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE)
+	{
+		return MSV_LOG_INVALID_FILE_HANDLE;
+	}
+
+	LARGE_INTEGER size;
+	fileSize = GetFileSizeEx(hFile, &size) ? static_cast<size_t>(size.QuadPart) : 0;
+
+	//allocation size does not change end of file (readers do not see reserved space)
+	if (fileSize < maxLogFileSize)
+	{
+		FILE_ALLOCATION_INFO allocationInfo;
+		allocationInfo.AllocationSize.QuadPart = static_cast<LONGLONG>(maxLogFileSize);
+		SetFileInformationByHandle(hFile, FileAllocationInfo, &allocationInfo, sizeof(allocationInfo));
+	}
+
+	return hFile;
+#else
+	int fd = open(file.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	if (fd < 0)
+	{
+		return MSV_LOG_INVALID_FILE_HANDLE;
+	}
+
+	off_t size = lseek(fd, 0, SEEK_END);
+	fileSize = size > 0 ? static_cast<size_t>(size) : 0;
+
+#ifdef FALLOC_FL_KEEP_SIZE
+	//blocks are allocated up front and file size is not changed (readers do not see reserved space)
+	if (fileSize < maxLogFileSize)
+	{
+		fallocate(fd, FALLOC_FL_KEEP_SIZE, static_cast<off_t>(fileSize), static_cast<off_t>(maxLogFileSize - fileSize));
+	}
+#else
+	(void)maxLogFileSize;
+#endif // FALLOC_FL_KEEP_SIZE
+
+	return fd;
+#endif // _WIN32
+}
+
+void MsvLogRotator::CloseFile(MsvLogFileHandle hFile, size_t fileSize)
+{
+	if (hFile == MSV_LOG_INVALID_FILE_HANDLE)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	//release space reserved behind end of file
+	FILE_ALLOCATION_INFO allocationInfo;
+	allocationInfo.AllocationSize.QuadPart = static_cast<LONGLONG>(fileSize);
+	SetFileInformationByHandle(hFile, FileAllocationInfo, &allocationInfo, sizeof(allocationInfo));
+
+	CloseHandle(hFile);
+#else
+	//release blocks reserved behind end of file
+	if (ftruncate(hFile, static_cast<off_t>(fileSize)) != 0)
+	{
+		//blocks stay reserved
+	}
+
+	close(hFile);
+#endif // _WIN32
+}
+
+void MsvLogRotator::RenameRotatedFiles(const std::string& logFile, size_t maxLogFiles, const std::shared_ptr<MsvLogCompressor>& spCompressor, uint64_t maxCompressedLogsSize, uint64_t rotationsCount)
+{
+	std::string indexFile = logFile + MSV_LOG_INDEX_EXTENSION;
+	if (spCompressor)
+	{
+		//compressed files are not indexed
+		spdlog::details::os::remove_if_exists(indexFile);
+
+		//rename is cheap, compression is done by compressor thread (rotations count is unique, so no file is overwritten)
+		std::string rotatedFile = logFile + ".rotated." + std::to_string(rotationsCount);
+		if (spdlog::details::os::rename(logFile, rotatedFile) == 0)
+		{
+			spCompressor->AddRotatedFile(rotatedFile, logFile, maxCompressedLogsSize);
+		}
+
+		return;
+	}
+
+	ShiftRotatedFiles(logFile, maxLogFiles, logFile);
+}
+
+uint64_t MsvLogRotator::RecoverFiles(const std::string& logFile, size_t maxLogFiles, const std::shared_ptr<MsvLogCompressor>& spCompressor, uint64_t maxCompressedLogsSize)
+{
+	std::map<uint64_t, std::string> rotatedFiles;
+	std::map<uint64_t, std::string> nextFiles;
+	FindTemporaryFiles(logFile, rotatedFiles, nextFiles);
+
+	uint64_t rotationsCount = 0;
+	if (!rotatedFiles.empty())
+	{
+		rotationsCount = rotatedFiles.rbegin()->first;
+	}
+
+	if (!nextFiles.empty())
+	{
+		rotationsCount = (std::max)(rotationsCount, nextFiles.rbegin()->first);
+	}
+
+	//rotated files are older than log file (the oldest one is recovered first)
+	for (const std::pair<const uint64_t, std::string>& rotatedFile: rotatedFiles)
+	{
+		if (spCompressor)
+		{
+			spCompressor->AddRotatedFile(rotatedFile.second, logFile, maxCompressedLogsSize);
+		}
+		else
+		{
+			ShiftRotatedFiles(logFile, maxLogFiles, rotatedFile.second);
+		}
+	}
+
+	//written next file has not been renamed to log file (log file is older than it)
+	for (const std::pair<const uint64_t, std::string>& nextFile: nextFiles)
+	{
+		std::ifstream file(nextFile.second, std::ios::binary | std::ios::ate);
+		bool written = file && file.tellg() > 0;
+		file.close();
+
+		if (!written)
+		{
+			//prepared file does not contain any log
+			spdlog::details::os::remove_if_exists(nextFile.second);
+			continue;
+		}
+
+		std::ifstream currentFile(logFile, std::ios::binary | std::ios::ate);
+		bool currentWritten = currentFile && currentFile.tellg() > 0;
+		currentFile.close();
+
+		if (currentWritten)
+		{
+			RenameRotatedFiles(logFile, maxLogFiles, spCompressor, maxCompressedLogsSize, ++rotationsCount);
+		}
+		else
+		{
+			spdlog::details::os::remove_if_exists(logFile);
+		}
+
+		//file which could not be renamed stays in place (it is recovered next time)
+		if (!spdlog::details::os::path_exists(logFile))
+		{
+			spdlog::details::os::rename(nextFile.second, logFile);
+		}
+	}
+
+	return rotationsCount;
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogRotator protected methods
+********************************************************************************************************************************/
+
+
+void MsvLogRotator::RotatorThread()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	while (true)
+	{
+		m_condition.wait(lock, [this] { return !m_jobs.empty() || m_stop; });
+
+		if (m_jobs.empty())
+		{
+			//stopped and all queued jobs are done
+			break;
+		}
+
+		MsvLogRotatorJob job = m_jobs.front();
+		m_jobs.pop_front();
+		m_busy = true;
+
+		lock.unlock();
+		DoJob(job);
+		lock.lock();
+
+		m_busy = false;
+		m_condition.notify_all();
+	}
+}
+
+void MsvLogRotator::DoJob(const MsvLogRotatorJob& job)
+{
+	MsvLogNextFile& nextFile = *job.spNextFile;
+	nextFile.currentRenamed = false;
+
+	if (!job.currentFile.empty())
+	{
+		CloseFile(job.hRotatedFile, job.rotatedFileSize);
+		RenameRotatedFiles(job.logFile, job.maxLogFiles, job.spCompressor, job.maxCompressedLogsSize, job.rotationsCount);
+
+		//file is renamed while sink writes to it (file which could not be renamed keeps its temporary name)
+		nextFile.currentRenamed = !spdlog::details::os::path_exists(job.logFile) && spdlog::details::os::rename(job.currentFile, job.logFile) == 0;
+	}
+
+	//rotations count is unique (temporary files of crashed process are recovered by sink), so no file is appended
+	nextFile.file = job.logFile + ".next." + std::to_string(job.rotationsCount);
+
+	size_t fileSize = 0;
+	nextFile.hFile = OpenFile(nextFile.file, job.maxLogFileSize, fileSize);
+
+	//sink takes prepared file (or rotates synchronously when it could not be opened)
+	nextFile.ready.store(true, std::memory_order_release);
+}
+
+void MsvLogRotator::ShiftRotatedFiles(const std::string& logFile, size_t maxLogFiles, const std::string& rotatedFile)
+{
+	//no rotated file is kept -> rotated file is removed
+	if (maxLogFiles == 0)
+	{
+		spdlog::details::os::remove_if_exists(rotatedFile);
+		spdlog::details::os::remove_if_exists(rotatedFile + MSV_LOG_INDEX_EXTENSION);
+		return;
+	}
+
+	//same names as spdlog rotating file sink ("name.1.ext" is the newest rotated file)
+	for (size_t i = maxLogFiles; i > 0; --i)
+	{
+		std::string sourceFile = i > 1 ? spdlog::sinks::rotating_file_sink_st::calc_filename(logFile, i - 1) : rotatedFile;
+		if (spdlog::details::os::path_exists(sourceFile))
+		{
+			std::string targetFile = spdlog::sinks::rotating_file_sink_st::calc_filename(logFile, i);
+			spdlog::details::os::remove_if_exists(targetFile);
+			spdlog::details::os::rename(sourceFile, targetFile);
+
+			//index is renamed with its log file
+			std::string sourceIndexFile = sourceFile + MSV_LOG_INDEX_EXTENSION;
+			std::string targetIndexFile = targetFile + MSV_LOG_INDEX_EXTENSION;
+			spdlog::details::os::remove_if_exists(targetIndexFile);
+			if (spdlog::details::os::path_exists(sourceIndexFile))
+			{
+				spdlog::details::os::rename(sourceIndexFile, targetIndexFile);
+			}
+		}
+	}
+}
+
+void MsvLogRotator::FindTemporaryFiles(const std::string& logFile, std::map<uint64_t, std::string>& rotatedFiles, std::map<uint64_t, std::string>& nextFiles)
+{
+	size_t separator = logFile.find_last_of("/\\");
+	std::string directory = separator == std::string::npos ? std::string(".") : logFile.substr(0, separator + 1);
+	std::string prefix = separator == std::string::npos ? logFile : logFile.substr(separator + 1);
+
+	std::vector<std::string> names;
+#ifdef _WIN32
+	WIN32_FIND_DATAA findData;
+	HANDLE hFind = FindFirstFileA((logFile + ".*").c_str(), &findData);
+	if (hFind != INVALID_HANDLE_VALUE)
+	{
+		do
+		{
+			names.push_back(findData.cFileName);
+		}
+		while (FindNextFileA(hFind, &findData));
+
+		FindClose(hFind);
+	}
+#else
+	DIR* pDirectory = opendir(directory.c_str());
+	if (pDirectory)
+	{
+		while (dirent* pEntry = readdir(pDirectory))
+		{
+			names.push_back(pEntry->d_name);
+		}
+
+		closedir(pDirectory);
+	}
+#endif // _WIN32
+
+	const std::string rotatedPrefix = prefix + ".rotated.";
+	const std::string nextPrefix = prefix + ".next.";
+
+	for (const std::string& name: names)
+	{
+		std::map<uint64_t, std::string>* pFiles = nullptr;
+		size_t numberStart = 0;
+		if (name.compare(0, rotatedPrefix.size(), rotatedPrefix) == 0)
+		{
+			pFiles = &rotatedFiles;
+			numberStart = rotatedPrefix.size();
+		}
+		else if (name.compare(0, nextPrefix.size(), nextPrefix) == 0)
+		{
+			pFiles = &nextFiles;
+			numberStart = nextPrefix.size();
+		}
+
+		//rotation number is the whole suffix (compressed "name.ext.rotated.N.gz" is not temporary file)
+		if (!pFiles || numberStart == name.size() || name.size() - numberStart > 19 || name.find_first_not_of("0123456789", numberStart) != std::string::npos)
+		{
+			continue;
+		}
+
+		(*pFiles)[std::strtoull(name.c_str() + numberStart, nullptr, 10)] = separator == std::string::npos ? name : directory + name;
+	}
+}
+
+/** @} */	//End of group MSYS.
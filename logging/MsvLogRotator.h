@@ -0,0 +1,283 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Rotator
+* @details		Contains definition of @ref MsvLogRotator.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGROTATOR_H
+#define MARSTECH_LOGROTATOR_H
+
+
+#include "MsvLogCompressor.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+MSV_ENABLE_WARNINGS
+
+
+#ifdef _WIN32
+typedef void* MsvLogFileHandle;																			///< Log file handle (HANDLE on Windows, file descriptor on other platforms).
+#define MSV_LOG_INVALID_FILE_HANDLE reinterpret_cast<void*>(static_cast<intptr_t>(-1))	///< Invalid log file handle (INVALID_HANDLE_VALUE).
+#else
+typedef int MsvLogFileHandle;																				///< @copydoc MsvLogFileHandle
+#define MSV_LOG_INVALID_FILE_HANDLE -1																		///< Invalid log file handle.
+#endif // _WIN32
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Next File.
+* @details	Log file prepared by @ref MsvLogRotator for next switchover of one sink. Sink takes it when
+*				it is ready (without locking), rotator prepares new one when previous rotation is done.
+******************************************************************************************************/
+struct MsvLogNextFile
+{
+	std::atomic<bool> ready;									///< True when file is prepared (it is owned by rotator other way).
+	MsvLogFileHandle hFile;										///< Prepared file (valid when it is ready).
+	std::string file;												///< Temporary name of prepared file (it is renamed to log file after switchover).
+	bool currentRenamed;											///< True when file written by sink has been renamed to log file (its index might be opened).
+};
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Rotator Job.
+* @details	Full log file which has been switched over (it is closed and renamed) and request for next file.
+******************************************************************************************************/
+struct MsvLogRotatorJob
+{
+	std::shared_ptr<MsvLogNextFile> spNextFile;			///< Next file of sink (it is prepared when job is done).
+	std::string logFile;											///< Log file path.
+	size_t maxLogFileSize;										///< Maximum size of log file (space reserved for next file).
+	size_t maxLogFiles;											///< Maximum number of rotated log files (when compressor is not set).
+	MsvLogFileHandle hRotatedFile;							///< Full log file (invalid handle when only next file is prepared).
+	size_t rotatedFileSize;										///< Size of full log file (in bytes).
+	std::string currentFile;									///< Temporary name of file which is written by sink now.
+	std::shared_ptr<MsvLogCompressor> spCompressor;		///< Log compressor (or nullptr).
+	uint64_t maxCompressedLogsSize;							///< Maximum size of all compressed rotated files (in bytes).
+	uint64_t rotationsCount;									///< Number of rotations of sink (it makes names of temporary files unique).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Rotator.
+* @details	Moves rotation of log files out of log backend thread. It prepares (opens and preallocates)
+*				next log file ahead of time, so switchover in sink is just swap of file handles, and it closes,
+*				renames and prunes rotated files in background thread.
+* @note		One rotator is shared by all batched file sinks of logger provider.
+******************************************************************************************************/
+class MsvLogRotator
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvLogRotator();
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	* @details	Stops rotator (all queued jobs are done).
+	******************************************************************************************************/
+	~MsvLogRotator();
+
+	/**************************************************************************************************//**
+	* @brief			Start rotator.
+	* @details		Starts background thread.
+	* @retval		MSV_ALREADY_RUNNING_INFO		When rotator is already running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Start();
+
+	/**************************************************************************************************//**
+	* @brief			Stop rotator.
+	* @details		Does all queued jobs and stops background thread.
+	* @retval		MSV_NOT_RUNNING_INFO			When rotator is not running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Stop();
+
+	/**************************************************************************************************//**
+	* @brief			Add job.
+	* @details		Queues job for background thread (it does not wait). Job is done immediately (in context
+	*					of caller) when rotator is not running.
+	* @param[in]	job								Rotator job.
+	******************************************************************************************************/
+	void AddJob(const MsvLogRotatorJob& job);
+
+	/**************************************************************************************************//**
+	* @brief			Wait for idle.
+	* @details		Waits until all queued jobs are done.
+	* @retval		MSV_NOT_RUNNING_INFO			When rotator is not running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode WaitForIdle();
+
+	/**************************************************************************************************//**
+	* @brief			Open file.
+	* @details		Opens log file for appending and reserves space for whole log file (file size is not
+	*					changed, so readers do not see reserved space).
+	* @param[in]	file								File path.
+	* @param[in]	maxLogFileSize					Maximum size of log file (in bytes).
+	* @param[out]	fileSize							Current size of file (in bytes).
+	* @returns		MsvLogFileHandle
+	* @retval		MSV_LOG_INVALID_FILE_HANDLE	When file could not be opened.
+	* @note			File is opened with delete sharing on Windows, so it might be renamed while it is open.
+	******************************************************************************************************/
+	static MsvLogFileHandle OpenFile(const std::string& file, size_t maxLogFileSize, size_t& fileSize);
+
+	/**************************************************************************************************//**
+	* @brief			Close file.
+	* @details		Releases space reserved behind end of file and closes it.
+	* @param[in]	hFile								File handle.
+	* @param[in]	fileSize							Size of written data (in bytes).
+	******************************************************************************************************/
+	static void CloseFile(MsvLogFileHandle hFile, size_t fileSize);
+
+	/**************************************************************************************************//**
+	* @brief			Rename rotated files.
+	* @details		Renames closed log file with its index like spdlog rotating file sink ("name.1.ext" is the
+	*					newest rotated file and the oldest ones are removed) or passes it to compressor and
+	*					removes index.
+	* @param[in]	logFile							Log file path.
+	* @param[in]	maxLogFiles						Maximum number of rotated log files (when compressor is not set).
+	* @param[in]	spCompressor					Log compressor (or nullptr).
+	* @param[in]	maxCompressedLogsSize		Maximum size of all compressed rotated files (in bytes).
+	* @param[in]	rotationsCount					Number of rotations (it makes names of files passed to compressor
+	*														unique).
+	* @note			Log file which could not be renamed stays in place.
+	******************************************************************************************************/
+	static void RenameRotatedFiles(const std::string& logFile, size_t maxLogFiles, const std::shared_ptr<MsvLogCompressor>& spCompressor, uint64_t maxCompressedLogsSize, uint64_t rotationsCount);
+
+	/**************************************************************************************************//**
+	* @brief			Recover files.
+	* @details		Recovers temporary files of crashed (or killed) process. Rotated files which have not been
+	*					compressed are passed to compressor (or renamed to rotated files when compressor is not
+	*					set), next files which have been written are rotated to log file (log file is rotated
+	*					before) and empty next files are removed.
+	* @param[in]	logFile							Log file path.
+	* @param[in]	maxLogFiles						Maximum number of rotated log files (when compressor is not set).
+	* @param[in]	spCompressor					Log compressor (or nullptr).
+	* @param[in]	maxCompressedLogsSize		Maximum size of all compressed rotated files (in bytes).
+	* @returns		uint64_t
+	* @retval		Number of rotations (sink continues with it, so names of temporary files stay unique).
+	* @note			It must be called before log file is opened by sink.
+	******************************************************************************************************/
+	static uint64_t RecoverFiles(const std::string& logFile, size_t maxLogFiles, const std::shared_ptr<MsvLogCompressor>& spCompressor, uint64_t maxCompressedLogsSize);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Rotator thread.
+	* @details	Does queued jobs until it is stopped.
+	******************************************************************************************************/
+	void RotatorThread();
+
+	/**************************************************************************************************//**
+	* @brief			Do job.
+	* @details		Closes and renames rotated file, renames switched file to log file and prepares next file.
+	* @param[in]	job								Rotator job.
+	******************************************************************************************************/
+	static void DoJob(const MsvLogRotatorJob& job);
+
+	/**************************************************************************************************//**
+	* @brief			Shift rotated files.
+	* @details		Shifts rotated files with their indexes ("name.1.ext" -> "name.2.ext", the oldest ones are
+	*					removed) and renames rotated file to the newest one.
+	* @param[in]	logFile							Log file path.
+	* @param[in]	maxLogFiles						Maximum number of rotated log files.
+	* @param[in]	rotatedFile						Rotated file (it is removed when no rotated file is kept).
+	******************************************************************************************************/
+	static void ShiftRotatedFiles(const std::string& logFile, size_t maxLogFiles, const std::string& rotatedFile);
+
+	/**************************************************************************************************//**
+	* @brief			Find temporary files.
+	* @details		Finds temporary files of log file ("name.ext.rotated.N" and "name.ext.next.N").
+	* @param[in]	logFile							Log file path.
+	* @param[out]	rotatedFiles					Rotated files which have not been compressed (by rotation number).
+	* @param[out]	nextFiles						Next files (by rotation number).
+	******************************************************************************************************/
+	static void FindTemporaryFiles(const std::string& logFile, std::map<uint64_t, std::string>& rotatedFiles, std::map<uint64_t, std::string>& nextFiles);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Condition.
+	* @details	Wakes rotator thread (new job, stop) and waiters for idle.
+	******************************************************************************************************/
+	std::condition_variable m_condition;
+
+	/**************************************************************************************************//**
+	* @brief		Jobs.
+	* @details	Queued rotator jobs.
+	******************************************************************************************************/
+	std::deque<MsvLogRotatorJob> m_jobs;
+
+	/**************************************************************************************************//**
+	* @brief		Rotator thread.
+	* @details	Background thread which rotates files.
+	******************************************************************************************************/
+	std::thread m_thread;
+
+	/**************************************************************************************************//**
+	* @brief		Running flag.
+	* @details	True when rotator is running.
+	******************************************************************************************************/
+	bool m_running;
+
+	/**************************************************************************************************//**
+	* @brief		Stop flag.
+	* @details	True when rotator thread should stop (after queued jobs are done).
+	******************************************************************************************************/
+	bool m_stop;
+
+	/**************************************************************************************************//**
+	* @brief		Busy flag.
+	* @details	True when rotator thread does job.
+	******************************************************************************************************/
+	bool m_busy;
+};
+
+
+#endif // !MARSTECH_LOGROTATOR_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,162 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Shipper
+* @details		Contains implementation of @ref MsvLogShipper.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvLogShipper.h"
+#include "MsvLogForwardingSink.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvLogShipper::MsvLogShipper(const char* socketPath, const char* spillFile, size_t bufferSize, size_t batchSize, uint64_t maxSpillSize):
+	m_socketPath(socketPath ? socketPath : ""),
+	m_spillFile(spillFile ? spillFile : ""),
+	m_bufferSize(bufferSize),
+	m_batchSize(batchSize),
+	m_maxSpillSize(maxSpillSize)
+{
+
+}
+
+
+MsvLogShipper::~MsvLogShipper()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvLogShipper public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvLogShipper::Initialize()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (m_spSink)
+	{
+		return MSV_ALREADY_INITIALIZED_INFO;
+	}
+
+	std::shared_ptr<MsvSocketSink> spSink(new (std::nothrow) MsvSocketSink(m_socketPath.c_str(), m_spillFile.c_str(), m_bufferSize, m_batchSize, m_maxSpillSize));
+	if (!spSink)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	MSV_RETURN_FAILED(spSink->Start());
+
+	m_spSink = spSink;
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															IMsvLogShipper public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvLogShipper::AttachLogger(std::shared_ptr<MsvLogger> spLogger)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!spLogger)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (!m_spSink)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	if (m_attachedLoggers.find(spLogger->name()) != m_attachedLoggers.end())
+	{
+		return MSV_ALREADY_EXISTS_ERROR;
+	}
+
+	//logger sinks are not changed (shipper sink is attached to forwarding sink of logger)
+	std::shared_ptr<MsvLogForwardingSink> spForwardingSink = MsvLogForwardingSink::GetForwardingSink(spLogger);
+	if (!spForwardingSink)
+	{
+		return MSV_NOT_FOUND_ERROR;
+	}
+
+	//shipper gets messages of configured log level (logger level is not changed)
+	MSV_RETURN_FAILED(spForwardingSink->AttachSink(m_spSink, true));
+
+	m_attachedLoggers.insert(spLogger->name());
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogShipper::Flush()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!m_spSink)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	return m_spSink->FlushRecords();
+}
+
+bool MsvLogShipper::IsConnected() const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	return m_spSink && m_spSink->IsConnected();
+}
+
+uint64_t MsvLogShipper::GetSpilledRecordsCount() const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	return m_spSink ? m_spSink->GetSpilledRecordsCount() : 0;
+}
+
+uint64_t MsvLogShipper::GetDroppedRecordsCount() const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	return m_spSink ? m_spSink->GetDroppedRecordsCount() : 0;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,162 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Shipper
+* @details		Contains definition of @ref MsvLogShipper.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGSHIPPER_H
+#define MARSTECH_LOGSHIPPER_H
+
+
+#include "IMsvLogShipper.h"
+#include "MsvSocketSink.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <mutex>
+#include <set>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Shipper.
+* @details	Implementation of log shipper interface. It shares one @ref MsvSocketSink by all attached
+*				loggers.
+* @see		IMsvLogShipper
+******************************************************************************************************/
+class MsvLogShipper:
+	public IMsvLogShipper
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	socketPath				Path of collector UNIX domain socket.
+	* @param[in]	spillFile				Spill file path.
+	* @param[in]	bufferSize				Maximum size of buffered records (in bytes).
+	* @param[in]	batchSize				Size of buffered records which are sent at once (in bytes).
+	* @param[in]	maxSpillSize			Maximum size of spill file (in bytes, 0 means unlimited).
+	******************************************************************************************************/
+	MsvLogShipper(const char* socketPath, const char* spillFile, size_t bufferSize, size_t batchSize, uint64_t maxSpillSize);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvLogShipper();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize shipper.
+	* @details		Creates and starts socket sink.
+	* @retval		MSV_ALLOCATION_ERROR			When sink could not be allocated.
+	* @retval		MSV_INVALID_DATA_ERROR		When socket path is too long or buffer size is zero.
+	* @retval		MSV_ALREADY_INITIALIZED_INFO	When shipper has been already initialized.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogShipper::AttachLogger(std::shared_ptr<MsvLogger> spLogger)
+	******************************************************************************************************/
+	virtual MsvErrorCode AttachLogger(std::shared_ptr<MsvLogger> spLogger) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogShipper::Flush()
+	******************************************************************************************************/
+	virtual MsvErrorCode Flush() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogShipper::IsConnected() const
+	******************************************************************************************************/
+	virtual bool IsConnected() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogShipper::GetSpilledRecordsCount() const
+	******************************************************************************************************/
+	virtual uint64_t GetSpilledRecordsCount() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogShipper::GetDroppedRecordsCount() const
+	******************************************************************************************************/
+	virtual uint64_t GetDroppedRecordsCount() const override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	mutable std::recursive_mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Socket path.
+	* @details	Path of collector UNIX domain socket.
+	******************************************************************************************************/
+	std::string m_socketPath;
+
+	/**************************************************************************************************//**
+	* @brief		Spill file.
+	* @details	Spill file path.
+	******************************************************************************************************/
+	std::string m_spillFile;
+
+	/**************************************************************************************************//**
+	* @brief		Buffer size.
+	* @details	Maximum size of buffered records (in bytes).
+	******************************************************************************************************/
+	size_t m_bufferSize;
+
+	/**************************************************************************************************//**
+	* @brief		Batch size.
+	* @details	Size of buffered records which are sent at once (in bytes).
+	******************************************************************************************************/
+	size_t m_batchSize;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum spill size.
+	* @details	Maximum size of spill file (in bytes, 0 means unlimited).
+	******************************************************************************************************/
+	uint64_t m_maxSpillSize;
+
+	/**************************************************************************************************//**
+	* @brief		Socket sink.
+	* @details	Sink shared by all attached loggers.
+	******************************************************************************************************/
+	std::shared_ptr<MsvSocketSink> m_spSink;
+
+	/**************************************************************************************************//**
+	* @brief		Attached loggers.
+	* @details	Names of attached loggers.
+	******************************************************************************************************/
+	std::set<std::string> m_attachedLoggers;
+};
+
+
+#endif // !MARSTECH_LOGSHIPPER_H
+
+/** @} */	//End of group MSYS.
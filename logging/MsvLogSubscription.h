@@ -0,0 +1,86 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Subscription
+* @details		Contains definition of log events and log subscribers.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGSUBSCRIPTION_H
+#define MARSTECH_LOGSUBSCRIPTION_H
+
+
+#include "mlogging/mlogging.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Event.
+* @details	Log record delivered to log subscribers. Logger name and message are valid only during
+*				subscriber call (copy them when they are needed later).
+******************************************************************************************************/
+struct MsvLogEvent
+{
+	std::chrono::system_clock::time_point time;			///< Log time.
+	MsvLogLevel level;											///< Log level.
+	size_t threadId;												///< ID of logging thread.
+	spdlog::string_view_t loggerName;						///< Logger name.
+	spdlog::string_view_t message;							///< Formatted message (with log context fields).
+};
+
+/**************************************************************************************************//**
+* @brief		Log subscriber.
+* @details	Callback which receives log events. It is called by background thread of async logging backend
+*				(it should return quickly, writing of records waits for it).
+******************************************************************************************************/
+typedef std::function<void(const MsvLogEvent& logEvent)> MsvLogSubscriber;
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Subscription.
+* @details	Log subscriber and its filter.
+******************************************************************************************************/
+struct MsvLogSubscription
+{
+	uint32_t subscriptionId;									///< Subscription ID.
+	MsvLogSubscriber subscriber;								///< Subscriber.
+	MsvLogLevel minLevel;										///< Minimum log level of delivered events.
+	std::string loggerName;										///< Logger name of delivered events (empty for all loggers).
+};
+
+
+#endif // !MARSTECH_LOGSUBSCRIPTION_H
+
+/** @} */	//End of group MSYS.
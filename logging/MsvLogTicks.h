@@ -0,0 +1,191 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Log Ticks
+* @details		Contains log calls with timestamp ticks as log time.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_LOGTICKS_H
+#define MARSTECH_LOGTICKS_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "msys/timestamp/MsvTimestamp.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Ticks flush level.
+* @details	Flush level of loggers which accept timestamp ticks as log time (loggers of
+*				@ref MsvAsyncLoggerProvider). Messages are never flushed by this level (it is above off level).
+* @note		Log calls use wall time when flush level of logger is changed.
+******************************************************************************************************/
+#define MSV_LOG_TICKS_FLUSH_LEVEL spdlog::level::n_levels
+
+/**************************************************************************************************//**
+* @brief		Ticks time flag.
+* @details	Log time with this bit carries timestamp ticks (see @ref MsvTimestamp::ReadTicks) instead of wall
+*				time (wall time does not reach it).
+******************************************************************************************************/
+#define MSV_LOG_TICKS_TIME_FLAG (static_cast<uint64_t>(1) << 62)
+
+
+/**************************************************************************************************//**
+* @brief			Log ticks enabled.
+* @details		Checks if logger accepts timestamp ticks as log time (relaxed load of flush level).
+* @param[in]	logger						Logger.
+* @returns		bool
+******************************************************************************************************/
+inline bool MsvLogTicksEnabled(const MsvLogger& logger)
+{
+	return logger.flush_level() == MSV_LOG_TICKS_FLUSH_LEVEL;
+}
+
+/**************************************************************************************************//**
+* @brief			Ticks to log time.
+* @details		Stores timestamp ticks to log time (they are not converted).
+* @param[in]	ticks							Timestamp ticks.
+* @returns		spdlog::log_clock::time_point
+******************************************************************************************************/
+inline spdlog::log_clock::time_point MsvLogTicksToTime(uint64_t ticks)
+{
+	return spdlog::log_clock::time_point(spdlog::log_clock::duration(static_cast<spdlog::log_clock::rep>(ticks | MSV_LOG_TICKS_TIME_FLAG)));
+}
+
+/**************************************************************************************************//**
+* @brief			Log time to ticks.
+* @details		Reads timestamp ticks from log time.
+* @param[in]	time							Log time.
+* @param[out]	ticks							Timestamp ticks.
+* @retval		true							When log time carries ticks.
+* @retval		false							When log time is wall time.
+******************************************************************************************************/
+inline bool MsvLogTimeToTicks(const spdlog::log_clock::time_point& time, uint64_t& ticks)
+{
+	uint64_t count = static_cast<uint64_t>(time.time_since_epoch().count());
+	if (!(count & MSV_LOG_TICKS_TIME_FLAG))
+	{
+		return false;
+	}
+
+	ticks = count & ~MSV_LOG_TICKS_TIME_FLAG;
+
+	return true;
+}
+
+/**************************************************************************************************//**
+* @brief			Log with ticks.
+* @details		Reads timestamp ticks, formats message and logs it with ticks as log time (spdlog does not read
+*					wall clock).
+* @param[in]	spLogger						Logger (ticks must be enabled, see @ref MsvLogTicksEnabled).
+* @param[in]	logLevel						Log level.
+* @param[in]	format						Format string.
+* @param[in]	arg							The first format argument.
+* @param[in]	args							Other format arguments.
+* @note			Formatting errors are passed to error handler of logger (message is logged again by logger).
+******************************************************************************************************/
+template<typename FormatString, typename Arg, typename... Args>
+inline void MsvLogTicks(const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel, const FormatString& format, Arg&& arg, Args&&... args)
+{
+	uint64_t ticks = MsvTimestamp::ReadTicks();
+
+	spdlog::memory_buf_t buffer;
+	try
+	{
+		fmt::format_to(std::back_inserter(buffer), format, arg, args...);
+	}
+	catch (const std::exception&)
+	{
+		spLogger->log(logLevel, format, std::forward<Arg>(arg), std::forward<Args>(args)...);
+		return;
+	}
+
+	spLogger->log(MsvLogTicksToTime(ticks), spdlog::source_loc{}, logLevel, spdlog::string_view_t(buffer.data(), buffer.size()));
+}
+
+/**************************************************************************************************//**
+* @brief			Log with ticks.
+* @details		Reads timestamp ticks and logs message (without formatting) with ticks as log time.
+* @param[in]	spLogger						Logger (ticks must be enabled, see @ref MsvLogTicksEnabled).
+* @param[in]	logLevel						Log level.
+* @param[in]	message						Message.
+******************************************************************************************************/
+inline void MsvLogTicks(const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel, spdlog::string_view_t message)
+{
+	spLogger->log(MsvLogTicksToTime(MsvTimestamp::ReadTicks()), spdlog::source_loc{}, logLevel, message);
+}
+
+/**************************************************************************************************//**
+* @brief			Log with ticks.
+* @details		Formats value (which is not string) and logs it with ticks as log time.
+* @param[in]	spLogger						Logger (ticks must be enabled, see @ref MsvLogTicksEnabled).
+* @param[in]	logLevel						Log level.
+* @param[in]	value							Value.
+******************************************************************************************************/
+template<typename T, typename std::enable_if<!std::is_convertible<const T&, spdlog::string_view_t>::value, int>::type = 0>
+inline void MsvLogTicks(const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel, const T& value)
+{
+	MsvLogTicks(spLogger, logLevel, "{}", value);
+}
+
+/**************************************************************************************************//**
+* @brief			Log write.
+* @details		Logs with ticks when logger accepts them (@ref MsvLogTicks) and by spdlog logger other way.
+* @param[in]	spLogger						Logger.
+* @param[in]	logLevel						Log level.
+* @param[in]	args							Format string and its arguments (or message).
+******************************************************************************************************/
+template<typename... Args>
+inline void MsvLogWrite(const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel, Args&&... args)
+{
+	if (MsvLogTicksEnabled(*spLogger))
+	{
+		MsvLogTicks(spLogger, logLevel, std::forward<Args>(args)...);
+	}
+	else
+	{
+		spLogger->log(logLevel, std::forward<Args>(args)...);
+	}
+}
+
+
+#endif // !MARSTECH_LOGTICKS_H
+
+/** @} */	//End of group MSYS.
@@ -32,8 +32,12 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 
 
 #include "MsvLogging.h"
-
-#include "mlogging/MsvSpdLogLoggerProvider.h"
+#include "MsvBinaryFileSink.h"
+#include "MsvBinaryLogger.h"
+#include "MsvFlightRecorder.h"
+#include "MsvLogCategory.h"
+#include "MsvLogLevelBinding.h"
+#include "MsvLogShipper.h"
 
 #include "merror/MsvErrorCodes.h"
 
@@ -43,15 +47,27 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 ********************************************************************************************************************************/
 
 
-MsvLogging::MsvLogging()
+MsvLogging::MsvLogging(std::shared_ptr<MsvTimestamp> spTimestamp):
+	m_spTimestamp(spTimestamp),
+	m_loggerHandlesCount(0),
+	m_logCategories(MSV_LOG_CAT_NONE)
 {
-
+	//bind log calls of this binary (other binaries bind themselves by MsvLogBind)
+	MsvLogCategoryBind(&m_logCategories);
+	MsvLogContextBind(&m_logContext);
+	MsvLogRateLimitBind(&m_logRateLimitRegistry);
 }
 
 
 MsvLogging::~MsvLogging()
 {
-	
+	//unbind this binary only when it has not been bound to other logging
+	const std::atomic<uint32_t>* pCategoryMask = &m_logCategories;
+	MsvLogCategoryMask().compare_exchange_strong(pCategoryMask, nullptr);
+	IMsvLogContext* pLogContext = &m_logContext;
+	MsvLogContextBinding().compare_exchange_strong(pLogContext, nullptr);
+	IMsvLogRateLimitRegistry* pRegistry = &m_logRateLimitRegistry;
+	MsvLogRateLimitBinding().compare_exchange_strong(pRegistry, nullptr);
 }
 
 
@@ -62,12 +78,13 @@ MsvLogging::~MsvLogging()
 
 MsvErrorCode MsvLogging::GetLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName) const
 {
-	if (!m_spSharedLoggerProvider)
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider = std::atomic_load(&m_spSharedLoggerProvider);
+	if (!spLoggerProvider)
 	{
 		return MSV_DOES_NOT_EXIST_ERROR;
 	}
 
-	spLogger = m_spSharedLoggerProvider->GetLogger(loggerName);
+	spLogger = spLoggerProvider->GetLogger(loggerName);
 	if (!spLogger)
 	{
 		return MSV_ALLOCATION_ERROR;
@@ -78,12 +95,13 @@ MsvErrorCode MsvLogging::GetLogger(std::shared_ptr<MsvLogger>& spLogger, const c
 
 MsvErrorCode MsvLogging::GetLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles) const
 {
-	if (!m_spSharedLoggerProvider)
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider = std::atomic_load(&m_spSharedLoggerProvider);
+	if (!spLoggerProvider)
 	{
 		return MSV_DOES_NOT_EXIST_ERROR;
 	}
 
-	spLogger = m_spSharedLoggerProvider->GetLogger(loggerName, logFile, maxLogFileSize, maxLogFiles);
+	spLogger = spLoggerProvider->GetLogger(loggerName, logFile, maxLogFileSize, maxLogFiles);
 	if (!spLogger)
 	{
 		return MSV_ALLOCATION_ERROR;
@@ -92,17 +110,63 @@ MsvErrorCode MsvLogging::GetLogger(std::shared_ptr<MsvLogger>& spLogger, const c
 	return MSV_SUCCESS;
 }
 
+MsvErrorCode MsvLogging::GetLoggerHandle(MsvLoggerHandle& handle, const char* loggerName) const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	std::map<std::string, MsvLoggerHandle>::iterator loggerHandle = m_loggerHandles.find(loggerName);
+	if (loggerHandle != m_loggerHandles.end())
+	{
+		handle = loggerHandle->second;
+		return MSV_SUCCESS;
+	}
+
+	MsvLoggerHandle newHandle = m_loggerHandlesCount.load(std::memory_order_relaxed);
+	if (newHandle >= MSV_LOGGER_HANDLES_MAX)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	std::shared_ptr<MsvLogger> spLogger;
+	MSV_RETURN_FAILED(GetLogger(spLogger, loggerName));
+
+	m_loggerHandles[loggerName] = newHandle;
+	m_handleLoggers[newHandle] = spLogger;
+
+	//publish slot (it is not changed anymore)
+	m_loggerHandlesCount.store(newHandle + 1, std::memory_order_release);
+
+	handle = newHandle;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogging::GetLoggerByHandle(std::shared_ptr<MsvLogger>& spLogger, MsvLoggerHandle handle) const
+{
+	if (handle >= m_loggerHandlesCount.load(std::memory_order_acquire))
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	spLogger = m_handleLoggers[handle];
+
+	return MSV_SUCCESS;
+}
+
 MsvErrorCode MsvLogging::GetLoggerProvider(std::shared_ptr<IMsvLoggerProvider>& spLoggerProvider, const char* logFolder, const char* logFile, int maxLogFileSize, int maxLogFiles) const
 {
 	std::lock_guard<std::recursive_mutex> lock(m_lock);
 
 	if (!m_spSharedLoggerProvider)
 	{
-		m_spSharedLoggerProvider.reset(new (std::nothrow) MsvLoggerProvider(logFolder, logFile, maxLogFileSize, maxLogFiles));
-		if (!m_spSharedLoggerProvider)
+		std::shared_ptr<MsvSyncLoggerProvider> spNewLoggerProvider(new (std::nothrow) MsvSyncLoggerProvider(logFolder, logFile, maxLogFileSize, maxLogFiles));
+		if (!spNewLoggerProvider)
 		{
 			return MSV_ALLOCATION_ERROR;
 		}
+
+		m_spSharedSyncLoggerProvider = spNewLoggerProvider;
+		std::atomic_store(&m_spSharedLoggerProvider, std::shared_ptr<IMsvLoggerProvider>(spNewLoggerProvider));
 	}
 
 	spLoggerProvider = m_spSharedLoggerProvider;
@@ -110,6 +174,34 @@ MsvErrorCode MsvLogging::GetLoggerProvider(std::shared_ptr<IMsvLoggerProvider>&
 	return MSV_SUCCESS;
 }
 
+MsvErrorCode MsvLogging::GetAsyncLoggerProvider(std::shared_ptr<IMsvAsyncLoggerProvider>& spLoggerProvider, const char* logFolder, const char* logFile, int maxLogFileSize, int maxLogFiles, size_t queueSize, MsvLogOverflowPolicy overflowPolicy) const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!m_spSharedAsyncLoggerProvider)
+	{
+		if (m_spSharedLoggerProvider)
+		{
+			return MSV_ALREADY_EXISTS_ERROR;
+		}
+
+		std::shared_ptr<MsvAsyncLoggerProvider> spAsyncLoggerProvider(new (std::nothrow) MsvAsyncLoggerProvider(logFolder, logFile, maxLogFileSize, maxLogFiles, queueSize, overflowPolicy, m_spTimestamp));
+		if (!spAsyncLoggerProvider)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+
+		MSV_RETURN_FAILED(spAsyncLoggerProvider->Initialize());
+
+		m_spSharedAsyncLoggerProvider = spAsyncLoggerProvider;
+		std::atomic_store(&m_spSharedLoggerProvider, std::shared_ptr<IMsvLoggerProvider>(spAsyncLoggerProvider));
+	}
+
+	spLoggerProvider = m_spSharedAsyncLoggerProvider;
+
+	return MSV_SUCCESS;
+}
+
 MsvErrorCode MsvLogging::SetLoggerProvider(std::shared_ptr<IMsvLoggerProvider> spLoggerProvider)
 {
 	std::lock_guard<std::recursive_mutex> lock(m_lock);
@@ -124,22 +216,220 @@ MsvErrorCode MsvLogging::SetLoggerProvider(std::shared_ptr<IMsvLoggerProvider> s
 		return MSV_INVALID_DATA_ERROR;
 	}
 
-	m_spSharedLoggerProvider = spLoggerProvider;
+	std::atomic_store(&m_spSharedLoggerProvider, spLoggerProvider);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogging::GetBinaryLogger(std::shared_ptr<IMsvBinaryLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles) const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	std::map<std::string, std::shared_ptr<IMsvBinaryLogger>>::iterator logger = m_binaryLoggers.find(loggerName);
+	if (logger != m_binaryLoggers.end())
+	{
+		spLogger = logger->second;
+		return MSV_SUCCESS;
+	}
+
+	if (!m_spBinaryLogBackend)
+	{
+		//binary records can not be mixed with dropped records summary -> block policy
+		std::shared_ptr<MsvAsyncLogBackend> spBackend(new (std::nothrow) MsvAsyncLogBackend(8192, MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_BLOCK, 100, m_spTimestamp));
+		std::shared_ptr<MsvBinaryLogSiteRegistry> spSiteRegistry(new (std::nothrow) MsvBinaryLogSiteRegistry());
+		if (!spBackend || !spSiteRegistry)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+
+		MSV_RETURN_FAILED(spBackend->Start());
+
+		m_spBinaryLogBackend = spBackend;
+		m_spBinaryLogSiteRegistry = spSiteRegistry;
+	}
+
+	std::shared_ptr<MsvBinaryFileSink> spSink(new (std::nothrow) MsvBinaryFileSink(loggerName, logFile, static_cast<size_t>(maxLogFileSize), static_cast<size_t>(maxLogFiles), m_spBinaryLogSiteRegistry));
+	if (!spSink)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	MSV_RETURN_FAILED(spSink->Initialize());
+
+	uint32_t targetId = 0;
+	MSV_RETURN_FAILED(m_spBinaryLogBackend->AddTarget(targetId, loggerName, std::vector<spdlog::sink_ptr>{spSink}));
+
+	std::shared_ptr<IMsvBinaryLogger> spBinaryLogger(new (std::nothrow) MsvBinaryLogger(loggerName, m_spBinaryLogBackend, targetId, m_spBinaryLogSiteRegistry));
+	if (!spBinaryLogger)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	m_binaryLoggers[loggerName] = spBinaryLogger;
+	spLogger = spBinaryLogger;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogging::GetStructuredLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles) const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (m_structuredLoggers.find(loggerName) != m_structuredLoggers.end())
+	{
+		return GetLogger(spLogger, loggerName, logFile, maxLogFileSize, maxLogFiles);
+	}
+
+	//provider creates logger with formatter (it rejects loggers which have been already created)
+	if (m_spSharedAsyncLoggerProvider)
+	{
+		MSV_RETURN_FAILED(m_spSharedAsyncLoggerProvider->GetStructuredLogger(spLogger, loggerName, logFile, maxLogFileSize, maxLogFiles));
+	}
+	else if (m_spSharedSyncLoggerProvider)
+	{
+		MSV_RETURN_FAILED(m_spSharedSyncLoggerProvider->GetStructuredLogger(spLogger, loggerName, logFile, maxLogFileSize, maxLogFiles));
+	}
+	else
+	{
+		return MSV_DOES_NOT_EXIST_ERROR;
+	}
+
+	m_structuredLoggers.insert(loggerName);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogging::GetFlightRecorder(std::shared_ptr<IMsvFlightRecorder>& spFlightRecorder, const char* recorderFile, uint32_t recordsCount) const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!m_spSharedFlightRecorder)
+	{
+		std::shared_ptr<MsvFlightRecorder> spNewFlightRecorder(new (std::nothrow) MsvFlightRecorder(recorderFile, recordsCount));
+		if (!spNewFlightRecorder)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+
+		MSV_RETURN_FAILED(spNewFlightRecorder->Initialize());
+
+		m_spSharedFlightRecorder = spNewFlightRecorder;
+	}
+
+	spFlightRecorder = m_spSharedFlightRecorder;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogging::GetLogShipper(std::shared_ptr<IMsvLogShipper>& spLogShipper, const char* socketPath, const char* spillFile, size_t bufferSize, size_t batchSize, uint64_t maxSpillSize) const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!m_spSharedLogShipper)
+	{
+		std::shared_ptr<MsvLogShipper> spNewLogShipper(new (std::nothrow) MsvLogShipper(socketPath, spillFile, bufferSize, batchSize, maxSpillSize));
+		if (!spNewLogShipper)
+		{
+			return MSV_ALLOCATION_ERROR;
+		}
+
+		MSV_RETURN_FAILED(spNewLogShipper->Initialize());
+
+		m_spSharedLogShipper = spNewLogShipper;
+	}
+
+	spLogShipper = m_spSharedLogShipper;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvLogging::GetLogLevelBinding(std::shared_ptr<IMsvLogLevelBinding>& spLogLevelBinding, std::shared_ptr<IMsvActiveConfig> spActiveConfig, uint32_t refreshPeriod) const
+{
+	std::shared_ptr<MsvLogLevelBinding> spNewLogLevelBinding(new (std::nothrow) MsvLogLevelBinding(spActiveConfig, refreshPeriod, &m_logCategories));
+	if (!spNewLogLevelBinding)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	MSV_RETURN_FAILED(spNewLogLevelBinding->Start());
+
+	spLogLevelBinding = spNewLogLevelBinding;
 
 	return MSV_SUCCESS;
 }
 
 MsvErrorCode MsvLogging::SetLogLevel(MsvLogLevel logLevel)
 {
-	if (!m_spSharedLoggerProvider)
+	std::shared_ptr<IMsvLoggerProvider> spLoggerProvider = std::atomic_load(&m_spSharedLoggerProvider);
+	if (!spLoggerProvider)
 	{
 		return MSV_DOES_NOT_EXIST_ERROR;
 	}
 
-	m_spSharedLoggerProvider->SetLogLevel(logLevel);
+	spLoggerProvider->SetLogLevel(logLevel);
 
 	return MSV_SUCCESS;
 }
 
+void MsvLogging::SetLogCategories(uint32_t categories)
+{
+	m_logCategories.store(categories, std::memory_order_relaxed);
+}
+
+uint32_t MsvLogging::GetLogCategories() const
+{
+	return m_logCategories.load(std::memory_order_relaxed);
+}
+
+const std::atomic<uint32_t>* MsvLogging::GetLogCategoriesMask() const
+{
+	return &m_logCategories;
+}
+
+IMsvLogContext* MsvLogging::GetLogContext() const
+{
+	return &m_logContext;
+}
+
+IMsvLogRateLimitRegistry* MsvLogging::GetLogRateLimitRegistry() const
+{
+	return &m_logRateLimitRegistry;
+}
+
+MsvErrorCode MsvLogging::Subscribe(uint32_t& subscriptionId, MsvLogSubscriber subscriber, MsvLogLevel minLevel, const char* loggerName)
+{
+	std::shared_ptr<IMsvAsyncLoggerProvider> spAsyncLoggerProvider;
+
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_lock);
+		spAsyncLoggerProvider = m_spSharedAsyncLoggerProvider;
+	}
+
+	if (!spAsyncLoggerProvider)
+	{
+		return MSV_DOES_NOT_EXIST_ERROR;
+	}
+
+	return spAsyncLoggerProvider->Subscribe(subscriptionId, subscriber, minLevel, loggerName);
+}
+
+MsvErrorCode MsvLogging::Unsubscribe(uint32_t subscriptionId)
+{
+	std::shared_ptr<IMsvAsyncLoggerProvider> spAsyncLoggerProvider;
+
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_lock);
+		spAsyncLoggerProvider = m_spSharedAsyncLoggerProvider;
+	}
+
+	if (!spAsyncLoggerProvider)
+	{
+		return MSV_DOES_NOT_EXIST_ERROR;
+	}
+
+	//subscriber might be running -> it is waited for without lock of logging
+	return spAsyncLoggerProvider->Unsubscribe(subscriptionId);
+}
+
 
 /** @} */	//End of group MSYS.
@@ -36,6 +36,22 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 
 
 #include "IMsvLogging.h"
+#include "MsvAsyncLogBackend.h"
+#include "MsvAsyncLoggerProvider.h"
+#include "MsvBinaryLogSiteRegistry.h"
+#include "MsvLogContext.h"
+#include "MsvLogRateLimitRegistry.h"
+#include "MsvSyncLoggerProvider.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <set>
+#include <string>
+
+MSV_ENABLE_WARNINGS
 
 
 /**************************************************************************************************//**
@@ -48,9 +64,11 @@ class MsvLogging:
 {
 public:
 	/**************************************************************************************************//**
-	* @brief		Constructor.
+	* @brief			Constructor.
+	* @param[in]	spTimestamp				Timestamp of async and binary log records (backends create their own
+	*												when it is nullptr).
 	******************************************************************************************************/
-	MsvLogging();
+	MsvLogging(std::shared_ptr<MsvTimestamp> spTimestamp = nullptr);
 
 	/**************************************************************************************************//**
 	* @brief		Virtual destructor.
@@ -67,21 +85,96 @@ public:
 	******************************************************************************************************/
 	virtual MsvErrorCode GetLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles) const override;
 
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetLoggerHandle(MsvLoggerHandle& handle, const char* loggerName) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetLoggerHandle(MsvLoggerHandle& handle, const char* loggerName = "MsvLogger") const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetLoggerByHandle(std::shared_ptr<MsvLogger>& spLogger, MsvLoggerHandle handle) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetLoggerByHandle(std::shared_ptr<MsvLogger>& spLogger, MsvLoggerHandle handle) const override;
+
 	/**************************************************************************************************//**
 	* @copydoc IMsvLogging::GetLoggerProvider(std::shared_ptr<IMsvLoggerProvider>& spLoggerProvider, const char* logFolder = "", const char* logFile = "msvlog.txt", int maxLogFileSize = 10485760, int maxLogFiles = 3) const
 	******************************************************************************************************/
 	virtual MsvErrorCode GetLoggerProvider(std::shared_ptr<IMsvLoggerProvider>& spLoggerProvider, const char* logFolder = "", const char* logFile = "msvlog.txt", int maxLogFileSize = 10485760, int maxLogFiles = 3) const override;
 
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetAsyncLoggerProvider(std::shared_ptr<IMsvAsyncLoggerProvider>& spLoggerProvider, const char* logFolder = "", const char* logFile = "msvlog.txt", int maxLogFileSize = 10485760, int maxLogFiles = 3, size_t queueSize = 8192, MsvLogOverflowPolicy overflowPolicy = MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_BLOCK) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetAsyncLoggerProvider(std::shared_ptr<IMsvAsyncLoggerProvider>& spLoggerProvider, const char* logFolder = "", const char* logFile = "msvlog.txt", int maxLogFileSize = 10485760, int maxLogFiles = 3, size_t queueSize = 8192, MsvLogOverflowPolicy overflowPolicy = MsvLogOverflowPolicy::MSV_LOG_OVERFLOW_BLOCK) const override;
+
 	/**************************************************************************************************//**
 	* @copydoc IMsvLogging::SetLoggerProvider(std::shared_ptr<IMsvLoggerProvider> spLoggerProvider)
 	******************************************************************************************************/
 	virtual MsvErrorCode SetLoggerProvider(std::shared_ptr<IMsvLoggerProvider> spLoggerProvider) override;
 
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetBinaryLogger(std::shared_ptr<IMsvBinaryLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize = 10485760, int maxLogFiles = 3) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetBinaryLogger(std::shared_ptr<IMsvBinaryLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize = 10485760, int maxLogFiles = 3) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetStructuredLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize = 10485760, int maxLogFiles = 3) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetStructuredLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize = 10485760, int maxLogFiles = 3) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetFlightRecorder(std::shared_ptr<IMsvFlightRecorder>& spFlightRecorder, const char* recorderFile = "msvflight.rec", uint32_t recordsCount = 65536) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetFlightRecorder(std::shared_ptr<IMsvFlightRecorder>& spFlightRecorder, const char* recorderFile = "msvflight.rec", uint32_t recordsCount = 65536) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetLogShipper(std::shared_ptr<IMsvLogShipper>& spLogShipper, const char* socketPath = "msvlog.sock", const char* spillFile = "msvlogspill.bin", size_t bufferSize = 4194304, size_t batchSize = 65536, uint64_t maxSpillSize = 67108864) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetLogShipper(std::shared_ptr<IMsvLogShipper>& spLogShipper, const char* socketPath = "msvlog.sock", const char* spillFile = "msvlogspill.bin", size_t bufferSize = 4194304, size_t batchSize = 65536, uint64_t maxSpillSize = 67108864) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetLogLevelBinding(std::shared_ptr<IMsvLogLevelBinding>& spLogLevelBinding, std::shared_ptr<IMsvActiveConfig> spActiveConfig, uint32_t refreshPeriod = 1000) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetLogLevelBinding(std::shared_ptr<IMsvLogLevelBinding>& spLogLevelBinding, std::shared_ptr<IMsvActiveConfig> spActiveConfig, uint32_t refreshPeriod = 1000) const override;
+
 	/**************************************************************************************************//**
 	* @copydoc IMsvLogging::SetLogLevel(MsvLogLevel logLevel)
 	******************************************************************************************************/
 	virtual MsvErrorCode SetLogLevel(MsvLogLevel logLevel) override;
 
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::SetLogCategories(uint32_t categories)
+	******************************************************************************************************/
+	virtual void SetLogCategories(uint32_t categories) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetLogCategories() const
+	******************************************************************************************************/
+	virtual uint32_t GetLogCategories() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetLogCategoriesMask() const
+	******************************************************************************************************/
+	virtual const std::atomic<uint32_t>* GetLogCategoriesMask() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetLogContext() const
+	******************************************************************************************************/
+	virtual IMsvLogContext* GetLogContext() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::GetLogRateLimitRegistry() const
+	******************************************************************************************************/
+	virtual IMsvLogRateLimitRegistry* GetLogRateLimitRegistry() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::Subscribe(uint32_t& subscriptionId, MsvLogSubscriber subscriber, MsvLogLevel minLevel = MsvLogLevel::trace, const char* loggerName = nullptr)
+	******************************************************************************************************/
+	virtual MsvErrorCode Subscribe(uint32_t& subscriptionId, MsvLogSubscriber subscriber, MsvLogLevel minLevel = MsvLogLevel::trace, const char* loggerName = nullptr) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLogging::Unsubscribe(uint32_t subscriptionId)
+	******************************************************************************************************/
+	virtual MsvErrorCode Unsubscribe(uint32_t subscriptionId) override;
+
 protected:
 	/**************************************************************************************************//**
 	* @brief		Thread mutex.
@@ -91,9 +184,102 @@ protected:
 
 	/**************************************************************************************************//**
 	* @brief		Shared logger provider.
-	* @details	It is returned by @ref GetLoggerProvider.
+	* @details	It is returned by @ref GetLoggerProvider. It is set under lock, but it is read without locking
+	*				(it must be accessed by std::atomic_load and std::atomic_store).
 	******************************************************************************************************/
 	mutable std::shared_ptr<IMsvLoggerProvider> m_spSharedLoggerProvider;
+
+	/**************************************************************************************************//**
+	* @brief		Timestamp.
+	* @details	Timestamp of async and binary log records (shared timestamp of SYS).
+	******************************************************************************************************/
+	std::shared_ptr<MsvTimestamp> m_spTimestamp;
+
+	/**************************************************************************************************//**
+	* @brief		Shared sync logger provider.
+	* @details	It is created by @ref GetLoggerProvider (it is shared logger provider too).
+	******************************************************************************************************/
+	mutable std::shared_ptr<MsvSyncLoggerProvider> m_spSharedSyncLoggerProvider;
+
+	/**************************************************************************************************//**
+	* @brief		Shared async logger provider.
+	* @details	It is returned by @ref GetAsyncLoggerProvider (it is shared logger provider too).
+	******************************************************************************************************/
+	mutable std::shared_ptr<MsvAsyncLoggerProvider> m_spSharedAsyncLoggerProvider;
+
+	/**************************************************************************************************//**
+	* @brief		Binary log backend.
+	* @details	Async log backend shared by all binary loggers (it is created with first binary logger).
+	******************************************************************************************************/
+	mutable std::shared_ptr<MsvAsyncLogBackend> m_spBinaryLogBackend;
+
+	/**************************************************************************************************//**
+	* @brief		Binary log site registry.
+	* @details	Call site registry shared by all binary loggers.
+	******************************************************************************************************/
+	mutable std::shared_ptr<MsvBinaryLogSiteRegistry> m_spBinaryLogSiteRegistry;
+
+	/**************************************************************************************************//**
+	* @brief		Binary loggers.
+	* @details	Created binary loggers (key is logger name).
+	******************************************************************************************************/
+	mutable std::map<std::string, std::shared_ptr<IMsvBinaryLogger>> m_binaryLoggers;
+
+	/**************************************************************************************************//**
+	* @brief		Structured loggers.
+	* @details	Names of loggers with JSON lines formatter.
+	******************************************************************************************************/
+	mutable std::set<std::string> m_structuredLoggers;
+
+	/**************************************************************************************************//**
+	* @brief		Shared flight recorder.
+	* @details	It is returned by @ref GetFlightRecorder.
+	******************************************************************************************************/
+	mutable std::shared_ptr<IMsvFlightRecorder> m_spSharedFlightRecorder;
+
+	/**************************************************************************************************//**
+	* @brief		Shared log shipper.
+	* @details	It is returned by @ref GetLogShipper.
+	******************************************************************************************************/
+	mutable std::shared_ptr<IMsvLogShipper> m_spSharedLogShipper;
+
+	/**************************************************************************************************//**
+	* @brief		Logger handles.
+	* @details	Logger handles by logger name (key is logger name).
+	******************************************************************************************************/
+	mutable std::map<std::string, MsvLoggerHandle> m_loggerHandles;
+
+	/**************************************************************************************************//**
+	* @brief		Handle loggers.
+	* @details	Loggers with handle (index is handle). Slot is written only once before its handle is published
+	*				by @ref m_loggerHandlesCount, so it is read without locking.
+	******************************************************************************************************/
+	mutable std::array<std::shared_ptr<MsvLogger>, MSV_LOGGER_HANDLES_MAX> m_handleLoggers;
+
+	/**************************************************************************************************//**
+	* @brief		Logger handles count.
+	* @details	Number of published logger handles.
+	******************************************************************************************************/
+	mutable std::atomic<MsvLoggerHandle> m_loggerHandlesCount;
+
+	/**************************************************************************************************//**
+	* @brief		Log categories.
+	* @details	Global mask of enabled log categories (one for all binaries, they read it by cached address).
+	******************************************************************************************************/
+	mutable std::atomic<uint32_t> m_logCategories;
+
+	/**************************************************************************************************//**
+	* @brief		Log context.
+	* @details	Log context interface (other binaries change thread local context of this library by it).
+	******************************************************************************************************/
+	mutable MsvLogContext m_logContext;
+
+	/**************************************************************************************************//**
+	* @brief		Log rate limit registry.
+	* @details	Registry of rate limited log call sites (it is destroyed first, so it writes its summaries to
+	*				existing loggers).
+	******************************************************************************************************/
+	mutable MsvLogRateLimitRegistry m_logRateLimitRegistry;
 };
 
 
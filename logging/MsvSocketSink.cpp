@@ -0,0 +1,717 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Socket Sink
+* @details		Contains implementation of @ref MsvSocketSink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvSocketSink.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <new>
+
+#include <spdlog/pattern_formatter.h>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <afunix.h>
+
+#pragma comment(lib, "Ws2_32.lib")
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif // _WIN32
+
+MSV_ENABLE_WARNINGS
+
+
+#ifdef _WIN32
+#define MSV_INVALID_SOCKET static_cast<uintptr_t>(INVALID_SOCKET)
+#else
+#define MSV_INVALID_SOCKET -1
+#endif // _WIN32
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+
+/**************************************************************************************************//**
+* @brief			Get record size.
+* @details		Returns size of length prefixed record.
+* @param[in]	pRecord						Record (its little endian size prefix).
+* @returns		size_t
+* @retval		Record size including prefix (in bytes).
+******************************************************************************************************/
+static size_t GetRecordSize(const char* pRecord)
+{
+	size_t recordSize = sizeof(uint32_t);
+	for (size_t i = 0; i < sizeof(uint32_t); ++i)
+	{
+		recordSize += static_cast<size_t>(static_cast<uint8_t>(pRecord[i])) << (8 * i);
+	}
+
+	return recordSize;
+}
+
+/**************************************************************************************************//**
+* @brief			Get records size.
+* @details		Returns size of leading records which are whole in data and whose size does not exceed limit.
+* @param[in]	pData							Length prefixed records.
+* @param[in]	size							Data size.
+* @param[in]	limit							Maximum size of records.
+* @returns		size_t
+* @retval		Size of whole records (in bytes).
+******************************************************************************************************/
+static size_t GetRecordsSize(const char* pData, size_t size, uint64_t limit)
+{
+	size_t recordsSize = 0;
+	while (recordsSize + sizeof(uint32_t) <= size)
+	{
+		size_t recordSize = GetRecordSize(pData + recordsSize);
+		if (recordsSize + recordSize > size || recordsSize + recordSize > limit)
+		{
+			break;
+		}
+
+		recordsSize += recordSize;
+	}
+
+	return recordsSize;
+}
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvSocketSink::MsvSocketSink(const char* socketPath, const char* spillFile, size_t bufferSize, size_t batchSize, uint64_t maxSpillSize):
+	m_socketPath(socketPath ? socketPath : ""),
+	m_spillFile(spillFile ? spillFile : ""),
+	m_bufferSize(bufferSize),
+	m_batchSize(batchSize),
+	m_maxSpillSize(maxSpillSize),
+	m_spFormatter(new (std::nothrow) spdlog::pattern_formatter()),
+	m_running(false),
+	m_stop(false),
+	m_flushRequests(0),
+	m_flushesDone(0),
+	m_connected(false),
+	m_spilledRecords(0),
+	m_droppedRecords(0),
+	m_nextConnect(std::chrono::steady_clock::now()),
+	m_pSpillFile(nullptr),
+	m_spillSize(0),
+	m_spillOffset(0),
+	m_socket(MSV_INVALID_SOCKET)
+{
+
+}
+
+
+MsvSocketSink::~MsvSocketSink()
+{
+	Stop();
+}
+
+
+/********************************************************************************************************************************
+*															MsvSocketSink public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvSocketSink::Start()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_running)
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	if (m_bufferSize == 0 || m_socketPath.empty() || m_socketPath.size() >= sizeof(sockaddr_un::sun_path))
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (!m_spFormatter)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	//buffers are never reallocated by log calls
+	try
+	{
+		m_buffer.reserve(m_bufferSize);
+		m_batch.reserve(m_bufferSize);
+	}
+	catch (const std::bad_alloc&)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+#ifdef _WIN32
+	WSADATA wsaData;
+	if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+#endif // _WIN32
+
+	//spill file of previous run is sent before new records
+	m_spillOffset = 0;
+	m_spillSize = 0;
+	if (!m_spillFile.empty())
+	{
+		std::ifstream spillFile(m_spillFile, std::ios::binary | std::ios::ate);
+		if (spillFile.is_open())
+		{
+			std::streamoff spillSize = spillFile.tellg();
+			m_spillSize = spillSize > 0 ? static_cast<uint64_t>(spillSize) : 0;
+		}
+	}
+
+	m_stop = false;
+	m_running = true;
+	m_thread = std::thread(&MsvSocketSink::SenderThread, this);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvSocketSink::Stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (!m_running)
+		{
+			return MSV_NOT_RUNNING_INFO;
+		}
+
+		m_running = false;
+		m_stop = true;
+	}
+
+	m_condition.notify_all();
+	m_thread.join();
+
+	Disconnect();
+
+	if (m_pSpillFile)
+	{
+		std::fclose(m_pSpillFile);
+		m_pSpillFile = nullptr;
+	}
+
+	if (m_spillReader.is_open())
+	{
+		m_spillReader.close();
+	}
+
+#ifdef _WIN32
+	WSACleanup();
+#endif // _WIN32
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvSocketSink::FlushRecords()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	if (!m_running)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	uint64_t flushRequest = ++m_flushRequests;
+	m_condition.notify_all();
+	m_condition.wait(lock, [this, flushRequest] { return m_flushesDone >= flushRequest || m_stop; });
+
+	return MSV_SUCCESS;
+}
+
+bool MsvSocketSink::IsConnected() const
+{
+	return m_connected.load(std::memory_order_relaxed);
+}
+
+uint64_t MsvSocketSink::GetSpilledRecordsCount() const
+{
+	return m_spilledRecords.load(std::memory_order_relaxed);
+}
+
+uint64_t MsvSocketSink::GetDroppedRecordsCount() const
+{
+	return m_droppedRecords.load(std::memory_order_relaxed);
+}
+
+void MsvSocketSink::log(const spdlog::details::log_msg& msg)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (!m_running)
+	{
+		return;
+	}
+
+	m_formatted.clear();
+	m_spFormatter->format(msg, m_formatted);
+
+	//logging thread never waits for collector (nor for disk)
+	size_t size = m_formatted.size();
+	if (m_buffer.size() + sizeof(uint32_t) + size > m_bufferSize)
+	{
+		m_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	//record size is little endian
+	char prefix[sizeof(uint32_t)];
+	for (size_t i = 0; i < sizeof(prefix); ++i)
+	{
+		prefix[i] = static_cast<char>((size >> (8 * i)) & 0xFF);
+	}
+
+	m_buffer.insert(m_buffer.end(), prefix, prefix + sizeof(prefix));
+	m_buffer.insert(m_buffer.end(), m_formatted.data(), m_formatted.data() + size);
+
+	if (m_buffer.size() >= m_batchSize && m_buffer.size() - sizeof(prefix) - size < m_batchSize)
+	{
+		m_condition.notify_all();
+	}
+}
+
+void MsvSocketSink::flush()
+{
+	FlushRecords();
+}
+
+void MsvSocketSink::set_pattern(const std::string& pattern)
+{
+	set_formatter(std::unique_ptr<spdlog::formatter>(new (std::nothrow) spdlog::pattern_formatter(pattern)));
+}
+
+void MsvSocketSink::set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter)
+{
+	if (!sink_formatter)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_lock);
+	m_spFormatter = std::move(sink_formatter);
+}
+
+
+/********************************************************************************************************************************
+*															MsvSocketSink protected methods
+********************************************************************************************************************************/
+
+
+void MsvSocketSink::SenderThread()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	while (true)
+	{
+		m_condition.wait_for(lock, std::chrono::milliseconds(MSV_SOCKET_SINK_SEND_INTERVAL), [this] { return m_buffer.size() >= m_batchSize || m_flushRequests != m_flushesDone || m_stop; });
+
+		bool stop = m_stop;
+		uint64_t flushRequests = m_flushRequests;
+
+		//logging threads fill the other buffer while batch is sent
+		m_batch.swap(m_buffer);
+
+		lock.unlock();
+		if (!m_batch.empty())
+		{
+			SendBatch(m_batch);
+			m_batch.clear();
+		}
+		else
+		{
+			//connection is kept ready for next records (spilled records are sent first)
+			if (ReplaySpill())
+			{
+				Connect();
+			}
+		}
+		lock.lock();
+
+		m_flushesDone = flushRequests;
+		m_condition.notify_all();
+
+		if (stop && m_buffer.empty())
+		{
+			break;
+		}
+	}
+}
+
+void MsvSocketSink::SendBatch(const std::vector<char>& batch)
+{
+	//batch is spilled behind spilled records which have not been sent yet (records keep their order)
+	size_t sent = (ReplaySpill() && Connect()) ? SendData(batch.data(), batch.size()) : 0;
+	if (sent == batch.size())
+	{
+		return;
+	}
+
+	//find start of the first record which has not been sent whole
+	size_t recordStart = GetRecordsSize(batch.data(), batch.size(), sent);
+
+	//collector drops incomplete record when connection is closed
+	if (sent != recordStart)
+	{
+		Disconnect();
+	}
+
+	Spill(batch.data() + recordStart, batch.size() - recordStart);
+}
+
+size_t MsvSocketSink::SendData(const char* pData, size_t size)
+{
+	std::chrono::steady_clock::time_point timeout = std::chrono::steady_clock::now() + std::chrono::milliseconds(MSV_SOCKET_SINK_SEND_TIMEOUT);
+	size_t sent = 0;
+
+	while (sent < size && m_socket != MSV_INVALID_SOCKET)
+	{
+#ifdef _WIN32
+		int result = send(static_cast<SOCKET>(m_socket), pData + sent, static_cast<int>((std::min)(size - sent, static_cast<size_t>(INT_MAX))), 0);
+		if (result != SOCKET_ERROR)
+		{
+			sent += static_cast<size_t>(result);
+			continue;
+		}
+
+		if (WSAGetLastError() != WSAEWOULDBLOCK)
+		{
+			Disconnect();
+			break;
+		}
+#else
+		ssize_t result = send(m_socket, pData + sent, size - sent, MSG_NOSIGNAL);
+		if (result >= 0)
+		{
+			sent += static_cast<size_t>(result);
+			continue;
+		}
+
+		if (errno == EINTR)
+		{
+			continue;
+		}
+
+		if (errno != EAGAIN && errno != EWOULDBLOCK)
+		{
+			Disconnect();
+			break;
+		}
+#endif // _WIN32
+
+		//collector is slow -> wait for it until timeout
+		int64_t remaining = std::chrono::duration_cast<std::chrono::milliseconds>(timeout - std::chrono::steady_clock::now()).count();
+		if (remaining <= 0)
+		{
+			break;
+		}
+
+#ifdef _WIN32
+		WSAPOLLFD pollFd = {static_cast<SOCKET>(m_socket), POLLWRNORM, 0};
+		WSAPoll(&pollFd, 1, static_cast<INT>(remaining));
+#else
+		pollfd pollFd = {m_socket, POLLOUT, 0};
+		poll(&pollFd, 1, static_cast<int>(remaining));
+#endif // _WIN32
+	}
+
+	return sent;
+}
+
+bool MsvSocketSink::Connect()
+{
+	if (m_socket != MSV_INVALID_SOCKET)
+	{
+		return true;
+	}
+
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	if (now < m_nextConnect)
+	{
+		return false;
+	}
+	m_nextConnect = now + std::chrono::milliseconds(MSV_SOCKET_SINK_RECONNECT_INTERVAL);
+
+	sockaddr_un address;
+	std::memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	std::memcpy(address.sun_path, m_socketPath.c_str(), m_socketPath.size());
+
+#ifdef _WIN32
+	SOCKET newSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (newSocket == INVALID_SOCKET)
+	{
+		return false;
+	}
+
+	//collector socket is local -> connect does not wait (it fails when collector does not listen)
+	u_long nonBlocking = 1;
+	if (connect(newSocket, reinterpret_cast<const sockaddr*>(&address), static_cast<int>(sizeof(address))) == SOCKET_ERROR || ioctlsocket(newSocket, FIONBIO, &nonBlocking) == SOCKET_ERROR)
+	{
+		closesocket(newSocket);
+		return false;
+	}
+
+	m_socket = static_cast<uintptr_t>(newSocket);
+#else
+	int newSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (newSocket < 0)
+	{
+		return false;
+	}
+
+	fcntl(newSocket, F_SETFD, FD_CLOEXEC);
+
+#ifdef SO_NOSIGPIPE
+	int noSigPipe = 1;
+	setsockopt(newSocket, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif // SO_NOSIGPIPE
+
+	//non-blocking connect of UNIX socket fails immediately when collector does not accept connections
+	int flags = fcntl(newSocket, F_GETFL, 0);
+	if (fcntl(newSocket, F_SETFL, flags | O_NONBLOCK) != 0 || connect(newSocket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+	{
+		close(newSocket);
+		return false;
+	}
+
+	m_socket = newSocket;
+#endif // _WIN32
+
+	m_connected.store(true, std::memory_order_relaxed);
+
+	return true;
+}
+
+void MsvSocketSink::Disconnect()
+{
+	if (m_socket == MSV_INVALID_SOCKET)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	closesocket(static_cast<SOCKET>(m_socket));
+#else
+	close(m_socket);
+#endif // _WIN32
+
+	m_socket = MSV_INVALID_SOCKET;
+	m_connected.store(false, std::memory_order_relaxed);
+}
+
+void MsvSocketSink::Spill(const char* pData, size_t size)
+{
+	if (!size)
+	{
+		return;
+	}
+
+	if (!m_pSpillFile && !m_spillFile.empty())
+	{
+		m_pSpillFile = std::fopen(m_spillFile.c_str(), "ab");
+	}
+
+	//records which do not fit to spill file are dropped
+	size_t spillSize = size;
+	if (m_maxSpillSize)
+	{
+		spillSize = GetRecordsSize(pData, size, m_spillSize < m_maxSpillSize ? m_maxSpillSize - m_spillSize : 0);
+	}
+
+	uint64_t records = 0;
+	for (size_t position = 0; position < spillSize; position += GetRecordSize(pData + position))
+	{
+		++records;
+	}
+
+	uint64_t droppedRecords = 0;
+	for (size_t position = spillSize; position < size; position += GetRecordSize(pData + position))
+	{
+		++droppedRecords;
+	}
+
+	//records are lost when spill file could not be written
+	bool spilled = !spillSize;
+	if (m_pSpillFile && spillSize)
+	{
+		size_t written = std::fwrite(pData, 1, spillSize, m_pSpillFile);
+		m_spillSize += written;
+		spilled = written == spillSize && std::fflush(m_pSpillFile) == 0;
+	}
+
+	if (spilled)
+	{
+		m_spilledRecords.fetch_add(records, std::memory_order_relaxed);
+	}
+	else
+	{
+		droppedRecords += records;
+	}
+
+	if (droppedRecords)
+	{
+		m_droppedRecords.fetch_add(droppedRecords, std::memory_order_relaxed);
+	}
+}
+
+bool MsvSocketSink::ReplaySpill()
+{
+	if (m_spillOffset >= m_spillSize)
+	{
+		return true;
+	}
+
+	if (!Connect())
+	{
+		return false;
+	}
+
+	if (!m_spillReader.is_open())
+	{
+		m_spillReader.open(m_spillFile, std::ios::binary);
+		if (!m_spillReader.is_open())
+		{
+			RemoveSpill();
+			return true;
+		}
+	}
+
+	while (m_spillOffset < m_spillSize)
+	{
+		//read chunk of spilled records (or the whole record when it is bigger than buffer)
+		size_t chunkSize = static_cast<size_t>((std::min)(static_cast<uint64_t>((std::max)(m_bufferSize, sizeof(uint32_t))), m_spillSize - m_spillOffset));
+		try
+		{
+			m_replay.resize(chunkSize);
+		}
+		catch (const std::bad_alloc&)
+		{
+			return false;
+		}
+
+		m_spillReader.clear();
+		m_spillReader.seekg(static_cast<std::streamoff>(m_spillOffset));
+		m_spillReader.read(m_replay.data(), static_cast<std::streamsize>(chunkSize));
+
+		size_t recordsSize = GetRecordsSize(m_replay.data(), static_cast<size_t>(m_spillReader.gcount()), m_spillSize - m_spillOffset);
+		if (!recordsSize && m_spillReader.gcount() >= static_cast<std::streamsize>(sizeof(uint32_t)) && GetRecordSize(m_replay.data()) <= m_spillSize - m_spillOffset)
+		{
+			recordsSize = GetRecordSize(m_replay.data());
+			try
+			{
+				m_replay.resize(recordsSize);
+			}
+			catch (const std::bad_alloc&)
+			{
+				return false;
+			}
+
+			m_spillReader.read(m_replay.data() + chunkSize, static_cast<std::streamsize>(recordsSize - chunkSize));
+			if (m_spillReader.gcount() != static_cast<std::streamsize>(recordsSize - chunkSize))
+			{
+				recordsSize = 0;
+			}
+		}
+
+		//spill file is damaged (it has been changed or written partially)
+		if (!recordsSize)
+		{
+			RemoveSpill();
+			return true;
+		}
+
+		size_t sent = SendData(m_replay.data(), recordsSize);
+		size_t sentRecordsSize = GetRecordsSize(m_replay.data(), recordsSize, sent);
+		m_spillOffset += sentRecordsSize;
+
+		if (sent != recordsSize)
+		{
+			//collector drops incomplete record when connection is closed
+			if (sent != sentRecordsSize)
+			{
+				Disconnect();
+			}
+
+			return false;
+		}
+	}
+
+	//all spilled records have been sent
+	RemoveSpill();
+
+	return true;
+}
+
+void MsvSocketSink::RemoveSpill()
+{
+	if (m_spillReader.is_open())
+	{
+		m_spillReader.close();
+	}
+
+	if (m_pSpillFile)
+	{
+		std::fclose(m_pSpillFile);
+		m_pSpillFile = nullptr;
+	}
+
+	if (!m_spillFile.empty())
+	{
+		std::remove(m_spillFile.c_str());
+	}
+
+	m_spillSize = 0;
+	m_spillOffset = 0;
+	m_replay.clear();
+}
+
+/** @} */	//End of group MSYS.
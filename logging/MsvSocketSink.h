@@ -0,0 +1,421 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Socket Sink
+* @details		Contains definition of @ref MsvSocketSink.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_SOCKETSINK_H
+#define MARSTECH_SOCKETSINK_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <spdlog/sinks/sink.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Socket sink send interval.
+* @details	Maximum time records wait in buffer before they are sent (in milliseconds).
+******************************************************************************************************/
+#define MSV_SOCKET_SINK_SEND_INTERVAL 100
+
+/**************************************************************************************************//**
+* @brief		Socket sink send timeout.
+* @details	Maximum time of sending one batch (in milliseconds). Rest of batch is spilled to file when
+*				collector does not read it in time.
+******************************************************************************************************/
+#define MSV_SOCKET_SINK_SEND_TIMEOUT 100
+
+/**************************************************************************************************//**
+* @brief		Socket sink reconnect interval.
+* @details	Minimum time between connection attempts (in milliseconds).
+******************************************************************************************************/
+#define MSV_SOCKET_SINK_RECONNECT_INTERVAL 1000
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Socket Sink.
+* @details	Spdlog sink which streams length prefixed records to UNIX domain socket. Log calls format record
+*				and copy it to bounded buffer (no system call). Background thread swaps buffers and sends whole
+*				batch (when batch size is reached, every @ref MSV_SOCKET_SINK_SEND_INTERVAL and on flush),
+*				connects to collector (non-blocking, at most once per @ref MSV_SOCKET_SINK_RECONNECT_INTERVAL)
+*				and appends records which could not be sent to spill file. Spilled records (also spill file of
+*				previous run) are sent before new records when collector is connected again, spill file is
+*				removed when it is sent whole. Records which do not fit to spill file are dropped.
+* @note		Connection is closed when batch is interrupted in the middle of record, so collector never
+*				receives partial record followed by another one (interrupted record is spilled whole).
+******************************************************************************************************/
+class MsvSocketSink:
+	public spdlog::sinks::sink
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	socketPath						Path of collector UNIX domain socket.
+	* @param[in]	spillFile						Spill file path.
+	* @param[in]	bufferSize						Maximum size of buffered records (in bytes).
+	* @param[in]	batchSize						Size of buffered records which wakes background thread (in bytes).
+	* @param[in]	maxSpillSize					Maximum size of spill file (in bytes, 0 means unlimited).
+	******************************************************************************************************/
+	MsvSocketSink(const char* socketPath, const char* spillFile, size_t bufferSize, size_t batchSize, uint64_t maxSpillSize);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Stops background thread (buffered records are sent or spilled).
+	******************************************************************************************************/
+	virtual ~MsvSocketSink();
+
+	/**************************************************************************************************//**
+	* @brief			Start sink.
+	* @details		Allocates buffers and starts background thread (it connects to collector and sends spill file
+	*					of previous run).
+	* @retval		MSV_INVALID_DATA_ERROR		When socket path is too long or buffer size is zero.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_ALREADY_RUNNING_INFO		When sink is already running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Start();
+
+	/**************************************************************************************************//**
+	* @brief			Stop sink.
+	* @details		Sends (or spills) buffered records and stops background thread.
+	* @retval		MSV_NOT_RUNNING_INFO			When sink is not running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Stop();
+
+	/**************************************************************************************************//**
+	* @brief			Flush records.
+	* @details		Waits until buffered records are sent or spilled.
+	* @retval		MSV_NOT_RUNNING_INFO			When sink is not running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode FlushRecords();
+
+	/**************************************************************************************************//**
+	* @brief			Is connected.
+	* @details		Returns true when sink is connected to collector.
+	* @returns		bool
+	******************************************************************************************************/
+	bool IsConnected() const;
+
+	/**************************************************************************************************//**
+	* @brief			Get spilled records count.
+	* @details		Returns number of records written to spill file.
+	* @returns		uint64_t
+	******************************************************************************************************/
+	uint64_t GetSpilledRecordsCount() const;
+
+	/**************************************************************************************************//**
+	* @brief			Get dropped records count.
+	* @details		Returns number of records dropped because buffer was full or spill file was full or it could not
+	*					be written.
+	* @returns		uint64_t
+	******************************************************************************************************/
+	uint64_t GetDroppedRecordsCount() const;
+
+	/**************************************************************************************************//**
+	* @brief			Log message.
+	* @details		Formats message and copies it to buffer (it is dropped when buffer is full).
+	* @param[in]	msg						Log message.
+	******************************************************************************************************/
+	virtual void log(const spdlog::details::log_msg& msg) override;
+
+	/**************************************************************************************************//**
+	* @brief			Flush.
+	* @details		Waits until buffered records are sent or spilled (see @ref FlushRecords).
+	******************************************************************************************************/
+	virtual void flush() override;
+
+	/**************************************************************************************************//**
+	* @brief			Set pattern.
+	* @details		Sets pattern of shipped records.
+	* @param[in]	pattern					Formatting pattern.
+	******************************************************************************************************/
+	virtual void set_pattern(const std::string& pattern) override;
+
+	/**************************************************************************************************//**
+	* @brief			Set formatter.
+	* @details		Sets formatter of shipped records.
+	* @param[in]	sink_formatter			Formatter.
+	******************************************************************************************************/
+	virtual void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Sender thread.
+	* @details	Sends buffered records in batches until it is stopped.
+	******************************************************************************************************/
+	void SenderThread();
+
+	/**************************************************************************************************//**
+	* @brief			Send batch.
+	* @details		Sends batch to collector (after spilled records) and spills records which have not been sent.
+	* @param[in]	batch							Batch of length prefixed records.
+	******************************************************************************************************/
+	void SendBatch(const std::vector<char>& batch);
+
+	/**************************************************************************************************//**
+	* @brief			Send data.
+	* @details		Sends data to connected collector until it is sent or send timeout elapses.
+	* @param[in]	pData							Data.
+	* @param[in]	size							Data size.
+	* @returns		size_t
+	* @retval		Number of sent bytes.
+	******************************************************************************************************/
+	size_t SendData(const char* pData, size_t size);
+
+	/**************************************************************************************************//**
+	* @brief			Connect.
+	* @details		Connects to collector (when it is not connected and reconnect interval elapsed).
+	* @returns		bool
+	* @retval		true							When sink is connected.
+	* @retval		false							When sink is not connected.
+	******************************************************************************************************/
+	bool Connect();
+
+	/**************************************************************************************************//**
+	* @brief			Disconnect.
+	* @details		Closes connection to collector.
+	******************************************************************************************************/
+	void Disconnect();
+
+	/**************************************************************************************************//**
+	* @brief			Spill.
+	* @details		Appends records to spill file.
+	* @param[in]	pData							Length prefixed records.
+	* @param[in]	size							Records size.
+	******************************************************************************************************/
+	void Spill(const char* pData, size_t size);
+
+	/**************************************************************************************************//**
+	* @brief			Replay spill.
+	* @details		Sends spilled records to collector (they are sent before new records). Spill file is removed
+	*					when all its records have been sent.
+	* @returns		bool
+	* @retval		true							When spill file is empty (all spilled records have been sent).
+	* @retval		false							When some spilled records have not been sent yet.
+	******************************************************************************************************/
+	bool ReplaySpill();
+
+	/**************************************************************************************************//**
+	* @brief		Remove spill.
+	* @details	Closes and removes spill file (rest of records is lost).
+	******************************************************************************************************/
+	void RemoveSpill();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks buffer, formatter and thread state.
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Condition.
+	* @details	Wakes sender thread (full batch, flush, stop) and flush waiters.
+	******************************************************************************************************/
+	std::condition_variable m_condition;
+
+	/**************************************************************************************************//**
+	* @brief		Socket path.
+	* @details	Path of collector UNIX domain socket.
+	******************************************************************************************************/
+	std::string m_socketPath;
+
+	/**************************************************************************************************//**
+	* @brief		Spill file.
+	* @details	Spill file path.
+	******************************************************************************************************/
+	std::string m_spillFile;
+
+	/**************************************************************************************************//**
+	* @brief		Buffer size.
+	* @details	Maximum size of buffered records (in bytes).
+	******************************************************************************************************/
+	size_t m_bufferSize;
+
+	/**************************************************************************************************//**
+	* @brief		Batch size.
+	* @details	Size of buffered records which wakes sender thread (in bytes).
+	******************************************************************************************************/
+	size_t m_batchSize;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum spill size.
+	* @details	Maximum size of spill file (in bytes, 0 means unlimited).
+	******************************************************************************************************/
+	uint64_t m_maxSpillSize;
+
+	/**************************************************************************************************//**
+	* @brief		Formatter.
+	* @details	Formats shipped records.
+	******************************************************************************************************/
+	std::unique_ptr<spdlog::formatter> m_spFormatter;
+
+	/**************************************************************************************************//**
+	* @brief		Formatted record.
+	* @details	Reusable buffer of formatted record.
+	******************************************************************************************************/
+	spdlog::memory_buf_t m_formatted;
+
+	/**************************************************************************************************//**
+	* @brief		Buffer.
+	* @details	Length prefixed records which wait for sender thread.
+	******************************************************************************************************/
+	std::vector<char> m_buffer;
+
+	/**************************************************************************************************//**
+	* @brief		Batch.
+	* @details	Length prefixed records which are sent by sender thread (it is swapped with buffer).
+	******************************************************************************************************/
+	std::vector<char> m_batch;
+
+	/**************************************************************************************************//**
+	* @brief		Sender thread.
+	******************************************************************************************************/
+	std::thread m_thread;
+
+	/**************************************************************************************************//**
+	* @brief		Running flag.
+	* @details	True when sink is running.
+	******************************************************************************************************/
+	bool m_running;
+
+	/**************************************************************************************************//**
+	* @brief		Stop flag.
+	* @details	True when sender thread should stop (after buffered records are sent).
+	******************************************************************************************************/
+	bool m_stop;
+
+	/**************************************************************************************************//**
+	* @brief		Flush requests.
+	* @details	Number of flush requests.
+	******************************************************************************************************/
+	uint64_t m_flushRequests;
+
+	/**************************************************************************************************//**
+	* @brief		Flushes done.
+	* @details	Number of flush requests done by sender thread.
+	******************************************************************************************************/
+	uint64_t m_flushesDone;
+
+	/**************************************************************************************************//**
+	* @brief		Connected flag.
+	******************************************************************************************************/
+	std::atomic<bool> m_connected;
+
+	/**************************************************************************************************//**
+	* @brief		Spilled records.
+	* @details	Number of records written to spill file.
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_spilledRecords;
+
+	/**************************************************************************************************//**
+	* @brief		Dropped records.
+	* @details	Number of records dropped because buffer was full or spill file was full or it could not be
+	*				written.
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_droppedRecords;
+
+	/**************************************************************************************************//**
+	* @brief		Next connect.
+	* @details	Time of next connection attempt.
+	******************************************************************************************************/
+	std::chrono::steady_clock::time_point m_nextConnect;
+
+	/**************************************************************************************************//**
+	* @brief		Spill file handle.
+	* @details	Spill file opened for appending (nullptr until the first record is spilled).
+	******************************************************************************************************/
+	FILE* m_pSpillFile;
+
+	/**************************************************************************************************//**
+	* @brief		Spill reader.
+	* @details	Spill file opened for reading of spilled records (closed until they are replayed).
+	******************************************************************************************************/
+	std::ifstream m_spillReader;
+
+	/**************************************************************************************************//**
+	* @brief		Spill size.
+	* @details	Size of spill file (in bytes, it is used by sender thread only).
+	******************************************************************************************************/
+	uint64_t m_spillSize;
+
+	/**************************************************************************************************//**
+	* @brief		Spill offset.
+	* @details	Offset of the first spilled record which has not been sent (in bytes, it is used by sender
+	*				thread only).
+	******************************************************************************************************/
+	uint64_t m_spillOffset;
+
+	/**************************************************************************************************//**
+	* @brief		Replay buffer.
+	* @details	Reusable buffer of spilled records which are sent.
+	******************************************************************************************************/
+	std::vector<char> m_replay;
+
+#ifdef _WIN32
+	/**************************************************************************************************//**
+	* @brief		Socket.
+	* @details	Collector socket (INVALID_SOCKET when it is not connected).
+	******************************************************************************************************/
+	uintptr_t m_socket;
+#else
+	/**************************************************************************************************//**
+	* @brief		Socket descriptor.
+	* @details	Collector socket (-1 when it is not connected).
+	******************************************************************************************************/
+	int m_socket;
+#endif // _WIN32
+};
+
+
+#endif // !MARSTECH_SOCKETSINK_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,326 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Structured Log
+* @details		Contains definition of @ref MsvLogField and structured logging macros.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_STRUCTUREDLOG_H
+#define MARSTECH_STRUCTUREDLOG_H
+
+
+#include "MsvJsonEncoder.h"
+#include "MsvLogMacros.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		Structured record marker.
+* @details	First byte of structured record payload. Payload behind marker contains encoded JSON members
+*				("msg" and fields) which are written by @ref MsvJsonLinesFormatter as they are.
+******************************************************************************************************/
+#define MSV_STRUCTURED_LOG_MARKER '\x1e'
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Field Type.
+* @details	Type of structured log field value.
+******************************************************************************************************/
+enum class MsvLogFieldType: uint8_t
+{
+	MSV_LOG_FIELD_INTEGER = 0,				///< Signed integer.
+	MSV_LOG_FIELD_UNSIGNED,					///< Unsigned integer.
+	MSV_LOG_FIELD_DOUBLE,					///< Floating point value.
+	MSV_LOG_FIELD_BOOL,						///< Bool.
+	MSV_LOG_FIELD_STRING						///< String (it is not copied).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Log Field.
+* @details	Typed key-value field of structured log record. It does not copy key or string value, so it
+*				must not outlive them (it lives just during log call).
+******************************************************************************************************/
+class MsvLogField
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	key					Field key (JSON member name).
+	* @param[in]	value					Signed integer value.
+	******************************************************************************************************/
+	template<class T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+	MsvLogField(const char* key, T value):
+		m_key(key),
+		m_type(MsvLogFieldType::MSV_LOG_FIELD_INTEGER)
+	{
+		m_value.integer = static_cast<int64_t>(value);
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	key					Field key (JSON member name).
+	* @param[in]	value					Unsigned integer value.
+	******************************************************************************************************/
+	template<class T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+	MsvLogField(const char* key, T value):
+		m_key(key),
+		m_type(MsvLogFieldType::MSV_LOG_FIELD_UNSIGNED)
+	{
+		m_value.unsignedInteger = static_cast<uint64_t>(value);
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	key					Field key (JSON member name).
+	* @param[in]	value					Floating point value.
+	******************************************************************************************************/
+	template<class T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+	MsvLogField(const char* key, T value):
+		m_key(key),
+		m_type(MsvLogFieldType::MSV_LOG_FIELD_DOUBLE)
+	{
+		m_value.floatingPoint = static_cast<double>(value);
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	key					Field key (JSON member name).
+	* @param[in]	value					Bool value.
+	******************************************************************************************************/
+	MsvLogField(const char* key, bool value):
+		m_key(key),
+		m_type(MsvLogFieldType::MSV_LOG_FIELD_BOOL)
+	{
+		m_value.boolean = value;
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	key					Field key (JSON member name).
+	* @param[in]	value					String value (null terminated).
+	******************************************************************************************************/
+	MsvLogField(const char* key, const char* value):
+		m_key(key),
+		m_type(MsvLogFieldType::MSV_LOG_FIELD_STRING)
+	{
+		m_value.string.pData = value ? value : "";
+		m_value.string.size = value ? strlen(value) : 0;
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	key					Field key (JSON member name).
+	* @param[in]	value					String value.
+	******************************************************************************************************/
+	MsvLogField(const char* key, const std::string& value):
+		m_key(key),
+		m_type(MsvLogFieldType::MSV_LOG_FIELD_STRING)
+	{
+		m_value.string.pData = value.data();
+		m_value.string.size = value.size();
+	}
+
+	/**************************************************************************************************//**
+	* @brief			Encode.
+	* @details		Appends field as JSON member (with leading comma).
+	* @param[out]	buffer				Output buffer.
+	******************************************************************************************************/
+	void Encode(MsvJsonBuffer& buffer) const
+	{
+		buffer.push_back(',');
+		MsvJsonAppendString(buffer, m_key, strlen(m_key));
+		buffer.push_back(':');
+
+		switch (m_type)
+		{
+		case MsvLogFieldType::MSV_LOG_FIELD_INTEGER:
+			MsvJsonAppendInteger(buffer, m_value.integer);
+			break;
+		case MsvLogFieldType::MSV_LOG_FIELD_UNSIGNED:
+			MsvJsonAppendUnsigned(buffer, m_value.unsignedInteger);
+			break;
+		case MsvLogFieldType::MSV_LOG_FIELD_DOUBLE:
+			MsvJsonAppendDouble(buffer, m_value.floatingPoint);
+			break;
+		case MsvLogFieldType::MSV_LOG_FIELD_BOOL:
+			MsvJsonAppendBool(buffer, m_value.boolean);
+			break;
+		case MsvLogFieldType::MSV_LOG_FIELD_STRING:
+			MsvJsonAppendString(buffer, m_value.string.pData, m_value.string.size);
+			break;
+		}
+	}
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Key.
+	* @details	Field key (JSON member name).
+	******************************************************************************************************/
+	const char* m_key;
+
+	/**************************************************************************************************//**
+	* @brief		Type.
+	* @details	Type of field value.
+	******************************************************************************************************/
+	MsvLogFieldType m_type;
+
+	/**************************************************************************************************//**
+	* @brief		Value.
+	* @details	Field value (by type).
+	******************************************************************************************************/
+	union
+	{
+		int64_t integer;
+		uint64_t unsignedInteger;
+		double floatingPoint;
+		bool boolean;
+		struct
+		{
+			const char* pData;
+			size_t size;
+		} string;
+	} m_value;
+};
+
+
+/**************************************************************************************************//**
+* @brief			Get structured log buffer.
+* @details		Returns thread local buffer for encoding of structured records (it is reused, so
+*					encoding does not allocate after first records).
+* @returns		MsvJsonBuffer&
+******************************************************************************************************/
+inline MsvJsonBuffer& MsvStructuredLogBuffer()
+{
+	thread_local MsvJsonBuffer buffer;
+	return buffer;
+}
+
+/**************************************************************************************************//**
+* @brief			Encode structured record.
+* @details		Encodes marker, message and fields as JSON members ("msg":"message","key":value...).
+* @param[out]	buffer				Output buffer (it is cleared first).
+* @param[in]	message				Message.
+* @param[in]	fields				Typed fields.
+******************************************************************************************************/
+inline void MsvStructuredLogEncode(MsvJsonBuffer& buffer, const char* message, std::initializer_list<MsvLogField> fields)
+{
+	buffer.clear();
+	buffer.push_back(MSV_STRUCTURED_LOG_MARKER);
+	MsvJsonAppendRaw(buffer, "\"msg\":", 6);
+	MsvJsonAppendString(buffer, message, strlen(message));
+
+	for (const MsvLogField& field: fields)
+	{
+		field.Encode(buffer);
+	}
+}
+
+/**************************************************************************************************//**
+* @brief			Structured log.
+* @details		Encodes structured record to thread local buffer and logs it (without formatting, see
+*					@ref MsvLogWrite).
+* @param[in]	spLogger				Logger (use structured logger from @ref IMsvLogging::GetStructuredLogger).
+* @param[in]	logLevel				Log level.
+* @param[in]	message				Message.
+* @param[in]	fields				Typed fields.
+******************************************************************************************************/
+inline void MsvStructuredLog(const std::shared_ptr<MsvLogger>& spLogger, MsvLogLevel logLevel, const char* message, std::initializer_list<MsvLogField> fields)
+{
+	MsvJsonBuffer& buffer = MsvStructuredLogBuffer();
+	MsvStructuredLogEncode(buffer, message, fields);
+	MsvLogWrite(spLogger, logLevel, spdlog::string_view_t(buffer.data(), buffer.size()));
+}
+
+
+/**************************************************************************************************//**
+* @brief		Structured log macro.
+* @details	Logs message with typed fields (@ref MsvLogField) when runtime log level is enabled. Fields
+*				are not evaluated when log level is disabled.
+*				Example: MSV_SLOG_INFO(spLogger, "Module started.", {"module", name}, {"durationMs", 12});
+******************************************************************************************************/
+#define MSV_SLOG(spLogger, logLevel, message, ...) \
+	do \
+	{ \
+		if (spLogger && spLogger->should_log(logLevel)) \
+		{ \
+			MsvStructuredLog(spLogger, logLevel, message, {__VA_ARGS__}); \
+		} \
+	} while (0)
+
+#define MSV_SLOG_DISABLED(spLogger) MSV_LOG_DISABLED(spLogger)				///< Structured log call removed at compile time (see @ref MSV_LOG_ACTIVE_LEVEL).
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_TRACE
+#define MSV_SLOG_TRACE(spLogger, message, ...) MSV_SLOG(spLogger, spdlog::level::trace, message, __VA_ARGS__)			///< Structured log trace.
+#else
+#define MSV_SLOG_TRACE(spLogger, message, ...) MSV_SLOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_DEBUG
+#define MSV_SLOG_DEBUG(spLogger, message, ...) MSV_SLOG(spLogger, spdlog::level::debug, message, __VA_ARGS__)			///< Structured log debug.
+#else
+#define MSV_SLOG_DEBUG(spLogger, message, ...) MSV_SLOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_INFO
+#define MSV_SLOG_INFO(spLogger, message, ...) MSV_SLOG(spLogger, spdlog::level::info, message, __VA_ARGS__)				///< Structured log info.
+#else
+#define MSV_SLOG_INFO(spLogger, message, ...) MSV_SLOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_WARN
+#define MSV_SLOG_WARN(spLogger, message, ...) MSV_SLOG(spLogger, spdlog::level::warn, message, __VA_ARGS__)				///< Structured log warning.
+#else
+#define MSV_SLOG_WARN(spLogger, message, ...) MSV_SLOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_ERROR
+#define MSV_SLOG_ERROR(spLogger, message, ...) MSV_SLOG(spLogger, spdlog::level::err, message, __VA_ARGS__)				///< Structured log error.
+#else
+#define MSV_SLOG_ERROR(spLogger, message, ...) MSV_SLOG_DISABLED(spLogger)
+#endif
+
+#if MSV_LOG_ACTIVE_LEVEL <= MSV_LOG_LEVEL_CRITICAL
+#define MSV_SLOG_CRITICAL(spLogger, message, ...) MSV_SLOG(spLogger, spdlog::level::critical, message, __VA_ARGS__)	///< Structured log critical.
+#else
+#define MSV_SLOG_CRITICAL(spLogger, message, ...) MSV_SLOG_DISABLED(spLogger)
+#endif
+
+
+#endif // !MARSTECH_STRUCTUREDLOG_H
+
+/** @} */	//End of group MSYS.
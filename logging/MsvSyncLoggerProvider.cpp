@@ -0,0 +1,224 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Sync Logger Provider Implementation
+* @details		Contains implementation of sync logger provider.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvSyncLoggerProvider.h"
+#include "MsvJsonLinesFormatter.h"
+#include "MsvLogForwardingSink.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <spdlog/sinks/dist_sink.h>
+#include <spdlog/sinks/rotating_file_sink.h>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvSyncLoggerProvider::MsvSyncLoggerProvider(const char* logFolder, const char* logFile, int maxLogFileSize, int maxLogFiles):
+	m_logFolder(logFolder ? logFolder : ""),
+	m_logFile(logFile ? logFile : "msvlog.txt"),
+	m_maxLogFileSize(maxLogFileSize),
+	m_maxLogFiles(maxLogFiles),
+	m_logLevel(spdlog::level::info)
+{
+
+}
+
+
+MsvSyncLoggerProvider::~MsvSyncLoggerProvider()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvSyncLoggerProvider public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvSyncLoggerProvider::GetStructuredLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	//logger might have been returned as text logger (its formatter is not changed)
+	if (m_loggers.find(loggerName) != m_loggers.end())
+	{
+		return MSV_ALREADY_EXISTS_ERROR;
+	}
+
+	std::unique_ptr<spdlog::formatter> spFormatter(new (std::nothrow) MsvJsonLinesFormatter());
+	if (!spFormatter)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spdlog::sink_ptr spFileSink = CreateFileSink(logFile, maxLogFileSize, maxLogFiles);
+	if (!spFileSink)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	//logger is not returned by other calls until lock is released
+	std::shared_ptr<MsvLogger> spNewLogger = CreateLogger(loggerName, spFileSink);
+	if (!spNewLogger)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spNewLogger->set_formatter(std::move(spFormatter));
+	spLogger = spNewLogger;
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															IMsvLoggerProvider public methods
+********************************************************************************************************************************/
+
+
+std::shared_ptr<MsvLogger> MsvSyncLoggerProvider::GetLogger(const char* loggerName)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	std::map<std::string, std::shared_ptr<MsvLogger>>::iterator logger = m_loggers.find(loggerName);
+	if (logger != m_loggers.end())
+	{
+		return logger->second;
+	}
+
+	if (!m_spDefaultFileSink)
+	{
+		m_spDefaultFileSink = CreateFileSink(m_logFile.c_str(), m_maxLogFileSize, m_maxLogFiles);
+		if (!m_spDefaultFileSink)
+		{
+			return nullptr;
+		}
+	}
+
+	return CreateLogger(loggerName, m_spDefaultFileSink);
+}
+
+std::shared_ptr<MsvLogger> MsvSyncLoggerProvider::GetLogger(const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	std::map<std::string, std::shared_ptr<MsvLogger>>::iterator logger = m_loggers.find(loggerName);
+	if (logger != m_loggers.end())
+	{
+		return logger->second;
+	}
+
+	spdlog::sink_ptr spFileSink = CreateFileSink(logFile, maxLogFileSize, maxLogFiles);
+	if (!spFileSink)
+	{
+		return nullptr;
+	}
+
+	return CreateLogger(loggerName, spFileSink);
+}
+
+void MsvSyncLoggerProvider::SetLogLevel(MsvLogLevel logLevel)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	m_logLevel = logLevel;
+
+	for (std::pair<const std::string, std::shared_ptr<MsvLogger>>& logger: m_loggers)
+	{
+		MsvLogForwardingSink::SetLoggerLevel(logger.second, logLevel);
+	}
+}
+
+
+/********************************************************************************************************************************
+*															MsvSyncLoggerProvider protected methods
+********************************************************************************************************************************/
+
+
+std::shared_ptr<MsvLogger> MsvSyncLoggerProvider::CreateLogger(const std::string& loggerName, spdlog::sink_ptr spFileSink)
+{
+	//file sink might be shared -> its level is kept (logger level is set to distribution sink)
+	std::shared_ptr<spdlog::sinks::dist_sink_mt> spLevelSink(new (std::nothrow) spdlog::sinks::dist_sink_mt());
+	if (!spLevelSink)
+	{
+		return nullptr;
+	}
+
+	spLevelSink->add_sink(spFileSink);
+
+	std::shared_ptr<spdlog::sinks::sink> spForwardingSink(new (std::nothrow) MsvLogForwardingSink());
+	if (!spForwardingSink)
+	{
+		return nullptr;
+	}
+
+	//sinks are not changed after logger is returned (flight recorder and log shipper attach to forwarding sink)
+	std::shared_ptr<MsvLogger> spLogger(new (std::nothrow) MsvLogger(loggerName, {spLevelSink, spForwardingSink}));
+	if (!spLogger)
+	{
+		return nullptr;
+	}
+
+	MsvLogForwardingSink::SetLoggerLevel(spLogger, m_logLevel);
+	m_loggers[loggerName] = spLogger;
+
+	return spLogger;
+}
+
+spdlog::sink_ptr MsvSyncLoggerProvider::CreateFileSink(const char* logFile, int maxLogFileSize, int maxLogFiles)
+{
+	std::string logFilePath = m_logFolder;
+	if (!logFilePath.empty() && logFilePath.back() != '/' && logFilePath.back() != '\\')
+	{
+		logFilePath += "/";
+	}
+	logFilePath += logFile ? logFile : m_logFile.c_str();
+
+	try
+	{
+		return std::make_shared<spdlog::sinks::rotating_file_sink_mt>(logFilePath, static_cast<size_t>(maxLogFileSize), static_cast<size_t>(maxLogFiles));
+	}
+	catch (const spdlog::spdlog_ex&)
+	{
+		return nullptr;
+	}
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,182 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Sync Logger Provider Implementation
+* @details		Contains definition of sync logger provider.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_SYNCLOGGERPROVIDER_H
+#define MARSTECH_SYNCLOGGERPROVIDER_H
+
+
+#include "mlogging/mlogging.h"
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <map>
+#include <mutex>
+#include <string>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Sync Logger Provider Implementation.
+* @details	Implementation of logger provider interface. Loggers write to rotating files in context of logging
+*				thread. Each logger has its own file sink level (configured log level) and @ref MsvLogForwardingSink,
+*				sinks are created before logger is returned and they are not changed later.
+* @see		IMsvLoggerProvider
+******************************************************************************************************/
+class MsvSyncLoggerProvider:
+	public IMsvLoggerProvider
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	logFolder				Path to log folder where log files will be stored.
+	* @param[in]	logFile					Default log file name.
+	* @param[in]	maxLogFileSize			Maximum size of one log file (in bytes).
+	* @param[in]	maxLogFiles				Maximum number of log files (rotating logger, the oldest file will be deleted).
+	******************************************************************************************************/
+	MsvSyncLoggerProvider(const char* logFolder = "", const char* logFile = "msvlog.txt", int maxLogFileSize = 10485760, int maxLogFiles = 3);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvSyncLoggerProvider();
+
+	/**************************************************************************************************//**
+	* @brief			Get structured logger.
+	* @details		Creates logger which writes JSON lines (@ref MsvJsonLinesFormatter) to its own log file.
+	*					Formatter is set before logger is returned.
+	* @param[out]	spLogger					Shared pointer to logger.
+	* @param[in]	loggerName				Logger name.
+	* @param[in]	logFile					Log file (JSON lines).
+	* @param[in]	maxLogFileSize			Maximum size of one log file (in bytes).
+	* @param[in]	maxLogFiles				Maximum number of log files.
+	* @retval		MSV_ALREADY_EXISTS_ERROR	When logger with this name has been already created.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode GetStructuredLogger(std::shared_ptr<MsvLogger>& spLogger, const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles);
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLoggerProvider::GetLogger(const char* loggerName)
+	******************************************************************************************************/
+	virtual std::shared_ptr<MsvLogger> GetLogger(const char* loggerName = "MsvLogger") override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLoggerProvider::GetLogger(const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles)
+	******************************************************************************************************/
+	virtual std::shared_ptr<MsvLogger> GetLogger(const char* loggerName, const char* logFile, int maxLogFileSize, int maxLogFiles) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvLoggerProvider::SetLogLevel(MsvLogLevel logLevel)
+	******************************************************************************************************/
+	virtual void SetLogLevel(MsvLogLevel logLevel) override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Create logger.
+	* @details		Creates logger with its own file sink level (distribution sink of file sink) and forwarding
+	*					sink.
+	* @param[in]	loggerName				Logger name.
+	* @param[in]	spFileSink				Destination file sink (it might be shared by more loggers).
+	* @returns		std::shared_ptr<MsvLogger>
+	* @retval		nullptr					When memory allocation failed.
+	******************************************************************************************************/
+	std::shared_ptr<MsvLogger> CreateLogger(const std::string& loggerName, spdlog::sink_ptr spFileSink);
+
+	/**************************************************************************************************//**
+	* @brief			Create file sink.
+	* @details		Creates thread safe rotating file sink.
+	* @param[in]	logFile					Log file name (in log folder).
+	* @param[in]	maxLogFileSize			Maximum size of one log file (in bytes).
+	* @param[in]	maxLogFiles				Maximum number of log files.
+	* @returns		spdlog::sink_ptr
+	* @retval		nullptr					When file sink creation failed.
+	******************************************************************************************************/
+	spdlog::sink_ptr CreateFileSink(const char* logFile, int maxLogFileSize, int maxLogFiles);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	std::recursive_mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Loggers.
+	* @details	Created loggers (key is logger name).
+	******************************************************************************************************/
+	std::map<std::string, std::shared_ptr<MsvLogger>> m_loggers;
+
+	/**************************************************************************************************//**
+	* @brief		Default file sink.
+	* @details	File sink of loggers created without log file.
+	******************************************************************************************************/
+	spdlog::sink_ptr m_spDefaultFileSink;
+
+	/**************************************************************************************************//**
+	* @brief		Log folder.
+	* @details	Path to log folder where log files are stored.
+	******************************************************************************************************/
+	std::string m_logFolder;
+
+	/**************************************************************************************************//**
+	* @brief		Default log file.
+	* @details	Log file name of loggers created without log file.
+	******************************************************************************************************/
+	std::string m_logFile;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum log file size.
+	* @details	Maximum size of one default log file (in bytes).
+	******************************************************************************************************/
+	int m_maxLogFileSize;
+
+	/**************************************************************************************************//**
+	* @brief		Maximum log files.
+	* @details	Maximum number of default log files.
+	******************************************************************************************************/
+	int m_maxLogFiles;
+
+	/**************************************************************************************************//**
+	* @brief		Log level.
+	* @details	Log level of all loggers.
+	******************************************************************************************************/
+	MsvLogLevel m_logLevel;
+};
+
+
+#endif // !MARSTECH_SYNCLOGGERPROVIDER_H
+
+/** @} */	//End of group MSYS.
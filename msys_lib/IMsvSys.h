@@ -47,6 +47,7 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 #include "msys/logging/IMsvLogging.h"
 #include "msys/modules/IMsvModules.h"
 #include "msys/threading/IMsvThreading.h"
+#include "msys/timestamp/IMsvTimestamp.h"
 
 MSV_DISABLE_ALL_WARNINGS
 
@@ -122,6 +123,19 @@ public:
 	* @see			IMsvThreading
 	******************************************************************************************************/
 	virtual MsvErrorCode GetMsvThreading(std::shared_ptr<IMsvThreading>& spThreading) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get timestamp interface.
+	* @details		Returns timestamp interface with cheap tick reads and lazy conversion of ticks to wall time.
+	*					It is used by logging too (log records store ticks).
+	*					Each call of this method returns same interface (same shared pointer).
+	* @param[out]	spTimestamp						Shared pointer to timestamp interface @ref IMsvTimestamp.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			When @ref IMsvSys is singleton, timestamp interface is singleton too.
+	* @see			IMsvTimestamp
+	******************************************************************************************************/
+	virtual MsvErrorCode GetMsvTimestamp(std::shared_ptr<IMsvTimestamp>& spTimestamp) const = 0;
 };
 
 
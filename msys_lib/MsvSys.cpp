@@ -86,7 +86,9 @@ MsvErrorCode MsvSys::GetMsvLogging(std::shared_ptr<IMsvLogging>& spLogging) cons
 
 	if (!m_spLogging)
 	{
-		m_spLogging.reset(new (std::nothrow) MsvLogging());
+		MSV_RETURN_FAILED(InitializeTimestamp());
+
+		m_spLogging.reset(new (std::nothrow) MsvLogging(m_spTimestamp));
 		if (!m_spLogging)
 		{
 			return MSV_ALLOCATION_ERROR;
@@ -134,5 +136,42 @@ MsvErrorCode MsvSys::GetMsvThreading(std::shared_ptr<IMsvThreading>& spThreading
 	return MSV_SUCCESS;
 }
 
+MsvErrorCode MsvSys::GetMsvTimestamp(std::shared_ptr<IMsvTimestamp>& spTimestamp) const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	MSV_RETURN_FAILED(InitializeTimestamp());
+
+	spTimestamp = m_spTimestamp;
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvSys protected methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvSys::InitializeTimestamp() const
+{
+	if (m_spTimestamp)
+	{
+		return MSV_SUCCESS;
+	}
+
+	std::shared_ptr<MsvTimestamp> spTimestamp(new (std::nothrow) MsvTimestamp());
+	if (!spTimestamp)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	MSV_RETURN_FAILED(spTimestamp->Initialize());
+
+	m_spTimestamp = spTimestamp;
+
+	return MSV_SUCCESS;
+}
+
 
 /** @} */	//End of group MSYS.
@@ -37,6 +37,8 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 
 #include "IMsvSys.h"
 
+#include "msys/timestamp/MsvTimestamp.h"
+
 MSV_DISABLE_ALL_WARNINGS
 
 #include <mutex>
@@ -83,6 +85,21 @@ public:
 	******************************************************************************************************/
 	virtual MsvErrorCode GetMsvThreading(std::shared_ptr<IMsvThreading>& spThreading) const override;
 
+	/**************************************************************************************************//**
+	* @copydoc IMsvSys::GetMsvTimestamp(std::shared_ptr<IMsvTimestamp>& spTimestamp) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetMsvTimestamp(std::shared_ptr<IMsvTimestamp>& spTimestamp) const override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Initialize timestamp.
+	* @details		Creates and initializes shared timestamp when it does not exist yet.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @warning		It must be called under lock.
+	******************************************************************************************************/
+	MsvErrorCode InitializeTimestamp() const;
+
 protected:
 	/**************************************************************************************************//**
 	* @brief		Thread mutex.
@@ -117,6 +134,13 @@ protected:
 	* @see		IMsvThreading
 	******************************************************************************************************/
 	mutable std::shared_ptr<IMsvThreading> m_spThreading;
+
+	/**************************************************************************************************//**
+	* @brief		Shared Timestamp.
+	* @details	It is returned by @ref GetMsvTimestamp and it is used by shared logging.
+	* @see		IMsvTimestamp
+	******************************************************************************************************/
+	mutable std::shared_ptr<MsvTimestamp> m_spTimestamp;
 };
 
 
@@ -0,0 +1,233 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Fiber Scheduler Interface
+* @details		Contains definition of @ref IMsvFiberScheduler, @ref IMsvFiberEvent and @ref IMsvFiberMutex interfaces.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_IFIBERSCHEDULER_H
+#define MARSTECH_IFIBERSCHEDULER_H
+
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Fiber Event Interface.
+* @details	Fiber aware counterpart of @ref IMsvEvent. Waiting fiber yields to its scheduler thread
+*				instead of blocking it, so other fibers are executed meanwhile.
+* @see		IMsvFiberScheduler
+******************************************************************************************************/
+class IMsvFiberEvent
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvFiberEvent() {}
+
+	/**************************************************************************************************//**
+	* @brief			Set event.
+	* @details		Wakes one waiting fiber (or all waiting fibers when notifyAll is true). Event stays set
+	*					when there is no waiter and next waiter continues immediately.
+	* @param[in]	notifyAll						True to wake all waiters, false to wake one waiter.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			It might be called from any thread (fiber or not).
+	******************************************************************************************************/
+	virtual MsvErrorCode SetEvent(bool notifyAll = false) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Reset event.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode ResetEvent() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Wait for event.
+	* @details		Suspends current fiber until event is set. Set event is consumed by waiter (auto reset).
+	* @retval		MSV_INVALID_DATA_ERROR		When it is not called from fiber.
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When scheduler is stopping (wait has been cancelled).
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode WaitForEvent() = 0;
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Fiber Mutex Interface.
+* @details	Fiber aware mutex. Fiber which can not lock mutex yields to its scheduler thread instead of
+*				blocking it. Ownership is handed over to waiters in FIFO order.
+* @see		IMsvFiberScheduler
+******************************************************************************************************/
+class IMsvFiberMutex
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvFiberMutex() {}
+
+	/**************************************************************************************************//**
+	* @brief			Lock mutex.
+	* @details		Suspends current fiber until mutex is locked by it.
+	* @retval		MSV_INVALID_DATA_ERROR		When it is not called from fiber.
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When scheduler is stopping (wait has been cancelled, mutex is not
+	*														locked).
+	* @retval		MSV_SUCCESS						On success.
+	* @warning		Mutex is not recursive.
+	******************************************************************************************************/
+	virtual MsvErrorCode Lock() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Try lock mutex.
+	* @returns		bool
+	* @retval		true				When mutex has been locked.
+	* @retval		false				When mutex is locked by other fiber.
+	******************************************************************************************************/
+	virtual bool TryLock() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Unlock mutex.
+	* @details		Hands ownership over to the first waiting fiber (when any waits).
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When mutex is not locked.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Unlock() = 0;
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Fiber Scheduler Interface.
+* @details	Stackful fibers (user mode threads) executed by small number of scheduler threads (one per
+*				CPU core by default). Fibers have small pooled stacks, so tens of thousands of long lived
+*				sessions might be written as sequential code. Fiber is bound to one scheduler thread for
+*				its whole life.
+* @warning	Fiber must not block its thread (e.g. by @ref IMsvEvent or std::mutex) - use
+*				@ref IMsvFiberEvent, @ref IMsvFiberMutex and @ref YieldFiber instead.
+* @see		IMsvFiberEvent
+* @see		IMsvFiberMutex
+******************************************************************************************************/
+class IMsvFiberScheduler
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvFiberScheduler() {}
+
+	/**************************************************************************************************//**
+	* @brief			Start scheduler.
+	* @details		Starts scheduler threads.
+	* @param[in]	threadsCount						Number of scheduler threads (0 means number of CPU cores).
+	* @param[in]	stackSize							Stack size of fibers in bytes.
+	* @retval		MSV_ALREADY_RUNNING_INFO		When scheduler is already running.
+	* @retval		MSV_ALLOCATION_ERROR				When memory allocation failed.
+	* @retval		MSV_SUCCESS							On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Start(uint16_t threadsCount = 0, size_t stackSize = 64 * 1024) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Stop scheduler.
+	* @details		Stops accepting new fibers, waits until all spawned fibers finish and stops scheduler
+	*					threads. Waits of fibers which wait for event or mutex (and nothing wakes them) are
+	*					cancelled - @ref IMsvFiberEvent::WaitForEvent and @ref IMsvFiberMutex::Lock return
+	*					MSV_NOT_INITIALIZED_ERROR (and so do all next waits), so fibers might finish.
+	* @retval		MSV_NOT_RUNNING_INFO				When scheduler is not running.
+	* @retval		MSV_SUCCESS							On success.
+	* @warning		Fiber which ignores cancelled wait and never finishes (e.g. it yields forever) blocks it.
+	******************************************************************************************************/
+	virtual MsvErrorCode Stop() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Check if scheduler is running.
+	* @returns		bool
+	* @retval		true				When scheduler is running.
+	* @retval		false				When scheduler is not running.
+	******************************************************************************************************/
+	virtual bool IsRunning() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Spawn fiber.
+	* @details		Executes fiber function in new fiber. Fibers are assigned to scheduler threads in round
+	*					robin order.
+	* @param[in]	fiber									Fiber function.
+	* @param[in]	pContext								Context passed to fiber function.
+	* @retval		MSV_NOT_RUNNING_INFO				When scheduler is not running.
+	* @retval		MSV_INVALID_DATA_ERROR			When fiber function is empty.
+	* @retval		MSV_ALLOCATION_ERROR				When memory allocation failed.
+	* @retval		MSV_SUCCESS							On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Spawn(std::function<void(void*)> fiber, void* pContext) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Yield fiber.
+	* @details		Suspends current fiber and lets other ready fibers of the same thread run.
+	* @retval		MSV_INVALID_DATA_ERROR			When it is not called from fiber.
+	* @retval		MSV_SUCCESS							On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode YieldFiber() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get fibers count.
+	* @details		Returns number of spawned fibers which have not finished yet.
+	* @returns		size_t
+	******************************************************************************************************/
+	virtual size_t GetFibersCount() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get fiber event interface.
+	* @param[out]	spEvent								Shared pointer to fiber event interface @ref IMsvFiberEvent.
+	* @retval		MSV_ALLOCATION_ERROR				When memory allocation failed.
+	* @retval		MSV_SUCCESS							On success.
+	* @see			IMsvFiberEvent
+	******************************************************************************************************/
+	virtual MsvErrorCode GetEvent(std::shared_ptr<IMsvFiberEvent>& spEvent) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get fiber mutex interface.
+	* @param[out]	spMutex								Shared pointer to fiber mutex interface @ref IMsvFiberMutex.
+	* @retval		MSV_ALLOCATION_ERROR				When memory allocation failed.
+	* @retval		MSV_SUCCESS							On success.
+	* @see			IMsvFiberMutex
+	******************************************************************************************************/
+	virtual MsvErrorCode GetMutex(std::shared_ptr<IMsvFiberMutex>& spMutex) = 0;
+};
+
+
+#endif // !MARSTECH_IFIBERSCHEDULER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,137 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Notifier Interface
+* @details		Contains definition of @ref IMsvNotifier interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_INOTIFIER_H
+#define MARSTECH_INOTIFIER_H
+
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Notifier Interface.
+* @details	Wake condition shared by more threads (wait group). Each notification is a token which
+*				is consumed by exactly one waiter, so notifier wakes just as many waiters as requested
+*				(wake-one and wake-n semantics) instead of waking all of them. Each token is given either to
+*				waiters (@ref WaitForNotification) or to attached workers (@ref AttachWorker), never to both.
+* @note		Tokens are not lost when there is no waiter. They are consumed by next waiters.
+******************************************************************************************************/
+class IMsvNotifier
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvNotifier() {}
+
+	/**************************************************************************************************//**
+	* @brief			Notify one waiter.
+	* @details		Adds one token and wakes one waiter (when any waits).
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode NotifyOne() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Notify waiters.
+	* @details		Adds count tokens and wakes up to count waiters.
+	* @param[in]	count								Number of tokens (waiters to wake).
+	* @retval		MSV_INVALID_DATA_ERROR		When count is zero.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Notify(uint32_t count) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Notify all waiters.
+	* @details		Adds one token for each current waiter and wakes all of them.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode NotifyAll() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Wait for notification.
+	* @details		Consumes one token. Returns immediately (without locking) when token is available,
+	*					waits for notification other way.
+	* @param[in]	timeout			Timeout in microseconds (0 means infinite).
+	* @returns		bool
+	* @retval		true				When token has been consumed.
+	* @retval		false				When timeout elapsed.
+	******************************************************************************************************/
+	virtual bool WaitForNotification(uint64_t timeout = 0) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get waiters count.
+	* @details		Returns number of threads which wait for notification right now.
+	* @returns		uint32_t
+	* @note			External waiters (attached workers) are not counted.
+	******************************************************************************************************/
+	virtual uint32_t GetWaitersCount() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Attach worker.
+	* @details		Returns synchronization objects for workers (@ref IMsvWorker, @ref IMsvUniqueWorker)
+	*					which can not wait by @ref WaitForNotification. Notifier treats them as external
+	*					waiters - atomic fast path is disabled and each notification increments predicate
+	*					and notifies condition variable.
+	* @param[out]	spConditionVariable				Shared condition variable.
+	* @param[out]	spConditionVariableMutex		Shared condition variable mutex.
+	* @param[out]	spConditionVariablePredicate	Shared condition variable predicate.
+	* @retval		MSV_SUCCESS							On success.
+	* @note			It is called by @ref IMsvThreading when worker is created with notifier.
+	* @see			DetachWorker
+	******************************************************************************************************/
+	virtual MsvErrorCode AttachWorker(std::shared_ptr<std::condition_variable>& spConditionVariable, std::shared_ptr<std::mutex>& spConditionVariableMutex, std::shared_ptr<uint64_t>& spConditionVariablePredicate) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Detach worker.
+	* @details		Removes one external waiter. Atomic fast path is enabled again when all attached workers
+	*					have been detached.
+	* @retval		MSV_NOT_INITIALIZED_INFO		When no worker is attached.
+	* @retval		MSV_SUCCESS							On success.
+	* @note			It is called by @ref IMsvThreading when worker created with notifier is destroyed.
+	******************************************************************************************************/
+	virtual MsvErrorCode DetachWorker() = 0;
+};
+
+
+#endif // !MARSTECH_INOTIFIER_H
+
+/** @} */	//End of group MSYS.
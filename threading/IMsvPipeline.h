@@ -0,0 +1,162 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Pipeline Interface
+* @details		Contains definition of @ref IMsvPipeline interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_IPIPELINE_H
+#define MARSTECH_IPIPELINE_H
+
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Pipeline Overflow Policy.
+* @details	Defines what happens when item is pushed to stage with full input buffer.
+******************************************************************************************************/
+enum class MsvPipelineOverflow: int32_t
+{
+	MSV_PIPELINE_BLOCK = 0,			///< Producer (upstream stage or caller of @ref IMsvPipeline::Push) waits for free space (backpressure).
+	MSV_PIPELINE_SHED					///< Item is dropped and counted (load shedding).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Pipeline Stage Statistics.
+* @details	Snapshot of one stage statistics returned by @ref IMsvPipeline::GetStageStats.
+******************************************************************************************************/
+struct MsvPipelineStageStats
+{
+	std::string name;						///< Stage name.
+	uint16_t parallelism;				///< Number of threads which execute stage function.
+	size_t capacity;						///< Input buffer capacity.
+	size_t occupancy;						///< Number of items waiting in input buffer.
+	uint64_t processed;					///< Number of items processed by stage function.
+	uint64_t dropped;						///< Number of items dropped by overflow policy @ref MsvPipelineOverflow::MSV_PIPELINE_SHED.
+	uint64_t throughput;					///< Average number of processed items per second since pipeline start.
+	uint64_t busyTime;					///< Time spent in stage function (microseconds, summary of all stage threads).
+	uint64_t blockedTime;				///< Time producers waited for free space in input buffer (microseconds).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Pipeline Interface.
+* @details	Staged pipeline (e.g. ingest -> parse -> enrich -> persist). Stages are executed by their own
+*				threads and they are connected by bounded buffers, so memory is stable under bursts. Full
+*				buffer blocks upstream (backpressure) or sheds load (see @ref MsvPipelineOverflow).
+* @note		Items are passed as std::shared_ptr<void>. Stage functions cast them to real type.
+******************************************************************************************************/
+class IMsvPipeline
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvPipeline() {}
+
+	/**************************************************************************************************//**
+	* @brief			Add stage.
+	* @details		Adds stage to the end of pipeline. Output of stage is input of next stage.
+	* @param[in]	stageName					Stage name (used in statistics).
+	* @param[in]	stageFunction				Stage function. It might modify (replace) item. Item is passed to next
+	*													stage when it returns true, it is filtered out other way.
+	* @param[in]	parallelism					Number of threads which execute stage function.
+	* @param[in]	bufferSize					Capacity of stage input buffer (number of items).
+	* @param[in]	overflow						Policy when input buffer is full.
+	* @retval		MSV_INVALID_DATA_ERROR	When stage function is empty or parallelism or buffer size is zero.
+	* @retval		MSV_STILL_RUNNING_ERROR	When pipeline is running.
+	* @retval		MSV_ALLOCATION_ERROR		When memory allocation failed.
+	* @retval		MSV_SUCCESS					On success.
+	* @warning		Stages must be added before @ref Start.
+	******************************************************************************************************/
+	virtual MsvErrorCode AddStage(const char* stageName, std::function<bool(std::shared_ptr<void>& spItem)> stageFunction, uint16_t parallelism = 1, size_t bufferSize = 1024, MsvPipelineOverflow overflow = MsvPipelineOverflow::MSV_PIPELINE_BLOCK) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Start pipeline.
+	* @details		Starts threads of all stages.
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When there is no stage.
+	* @retval		MSV_ALREADY_RUNNING_INFO	When pipeline is already running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Start() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Stop pipeline.
+	* @details		Stops accepting new items, waits until all buffered items are processed by all stages
+	*					and stops threads of all stages.
+	* @retval		MSV_NOT_RUNNING_INFO		When pipeline is not running.
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Stop() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Push item.
+	* @details		Pushes item to input buffer of the first stage. Waits for free space or drops the item
+	*					when buffer is full (depends on overflow policy of the first stage).
+	* @param[in]	spItem						Item to process.
+	* @retval		MSV_INVALID_DATA_ERROR	When item is empty.
+	* @retval		MSV_NOT_RUNNING_INFO		When pipeline is not running (item is not processed).
+	* @retval		MSV_SUCCESS					On success (item has been accepted or shed by overflow policy).
+	******************************************************************************************************/
+	virtual MsvErrorCode Push(std::shared_ptr<void> spItem) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Check if pipeline is running.
+	* @returns		bool
+	* @retval		true				When pipeline is running.
+	* @retval		false				When pipeline is not running.
+	******************************************************************************************************/
+	virtual bool IsRunning() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get stage statistics.
+	* @details		Returns statistics of all stages (in stage order). Stage with the highest occupancy
+	*					(or busy time) is the bottleneck.
+	* @param[out]	stats							Statistics of all stages.
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode GetStageStats(std::vector<MsvPipelineStageStats>& stats) const = 0;
+};
+
+
+#endif // !MARSTECH_IPIPELINE_H
+
+/** @} */	//End of group MSYS.
@@ -40,6 +40,11 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 #include "mthreading/IMsvUniqueWorker.h"
 #include "mthreading/IMsvWorker.h"
 
+#include "IMsvFiberScheduler.h"
+#include "IMsvNotifier.h"
+#include "IMsvPipeline.h"
+#include "IMsvVirtualScheduler.h"
+
 MSV_DISABLE_ALL_WARNINGS
 
 #include <mutex>
@@ -69,6 +74,75 @@ public:
 	******************************************************************************************************/
 	virtual MsvErrorCode GetEvent(std::shared_ptr<IMsvEvent>& spEvent) const = 0;
 
+	/**************************************************************************************************//**
+	* @brief			Get fiber scheduler interface.
+	* @details		Returns fiber scheduler interface for massive concurrency. Stackful fibers with small
+	*					pooled stacks are executed by one thread per CPU core (by default), so long lived
+	*					sessions might be written as sequential code instead of callbacks.
+	* @param[out]	spFiberScheduler				Shared pointer to fiber scheduler interface @ref IMsvFiberScheduler.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Each call returns independent scheduler (it must be started).
+	* @see			IMsvFiberScheduler
+	******************************************************************************************************/
+	virtual MsvErrorCode GetFiberScheduler(std::shared_ptr<IMsvFiberScheduler>& spFiberScheduler) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get notifier interface.
+	* @details		Returns notifier interface (wait group) for waking more threads which share one wake
+	*					condition. It wakes just requested number of waiters instead of all of them.
+	* @param[out]	spNotifier						Shared pointer to notifier interface @ref IMsvNotifier.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			It replaces condition variable, mutex and predicate triple when more workers share one
+	*					wake condition (see @ref GetUniqueWorker and @ref GetWorker).
+	* @see			IMsvNotifier
+	******************************************************************************************************/
+	virtual MsvErrorCode GetNotifier(std::shared_ptr<IMsvNotifier>& spNotifier) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get pipeline interface.
+	* @details		Returns pipeline interface for staged processing (e.g. ingest -> parse -> enrich -> persist).
+	*					Stages are connected by bounded buffers with backpressure and each stage has its own
+	*					parallelism and statistics.
+	* @param[out]	spPipeline						Shared pointer to pipeline interface @ref IMsvPipeline.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @see			IMsvPipeline
+	******************************************************************************************************/
+	virtual MsvErrorCode GetPipeline(std::shared_ptr<IMsvPipeline>& spPipeline) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get virtual scheduler interface.
+	* @details		Returns deterministic scheduler driven by virtual clock. Periodic tasks and event timeouts
+	*					are executed in virtual time, so hours of timer driven behaviour might be simulated in
+	*					seconds. Order of tasks with the same virtual time is given by seed, so race orderings
+	*					might be reproduced exactly.
+	* @param[out]	spVirtualScheduler			Shared pointer to virtual scheduler interface @ref IMsvVirtualScheduler.
+	* @param[in]	seed								Seed of task ordering.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			It is intended for tests. Each call returns independent scheduler.
+	* @see			IMsvVirtualScheduler
+	******************************************************************************************************/
+	virtual MsvErrorCode GetVirtualScheduler(std::shared_ptr<IMsvVirtualScheduler>& spVirtualScheduler, uint64_t seed = 0) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get virtual threading interface.
+	* @details		Returns threading interface whose events (@ref IMsvEvent) and unique workers
+	*					(@ref IMsvUniqueWorker) are driven by virtual time of virtual scheduler, so existing users
+	*					of these interfaces might run in virtual time. Blocking wait for event executes scheduled
+	*					tasks until event is set. Other interfaces are real ones.
+	* @param[out]	spVirtualThreading			Shared pointer to virtual threading interface @ref IMsvThreading.
+	* @param[in]	spVirtualScheduler			Virtual scheduler which drives events and unique workers.
+	* @retval		MSV_INVALID_DATA_ERROR		When virtual scheduler is nullptr.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			It is intended for tests. Events must be waited by thread which runs virtual scheduler.
+	* @see			IMsvVirtualScheduler
+	******************************************************************************************************/
+	virtual MsvErrorCode GetVirtualThreading(std::shared_ptr<IMsvThreading>& spVirtualThreading, std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler) const = 0;
+
 	/**************************************************************************************************//**
 	* @brief			Get shared thread pool interface.
 	* @details		Returns shared thread pool interface for asynchronous tasks.
@@ -113,6 +187,20 @@ public:
 	******************************************************************************************************/
 	virtual MsvErrorCode GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<std::condition_variable> spConditionVariable = nullptr, std::shared_ptr<std::mutex> spConditionVariableMutex = nullptr, std::shared_ptr<uint64_t> spConditionVariablePredicate = nullptr) const = 0;
 
+	/**************************************************************************************************//**
+	* @brief			Get unique worker interface.
+	* @details		Returns unique worker interface for asynchronous tasks which shares wake condition
+	*					with other workers by notifier.
+	* @param[out]	spUniqueWorker						Shared pointer to unique worker interface @ref IMsvUniqueWorker.
+	* @param[in]	spNotifier							Shared notifier (see @ref GetNotifier).
+	* @retval		MSV_INVALID_DATA_ERROR			When notifier is empty.
+	* @retval		MSV_ALLOCATION_ERROR				When memory allocation failed.
+	* @retval		MSV_SUCCESS							On success.
+	* @see			IMsvUniqueWorker
+	* @see			IMsvNotifier
+	******************************************************************************************************/
+	virtual MsvErrorCode GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<IMsvNotifier> spNotifier) const = 0;
+
 	/**************************************************************************************************//**
 	* @brief			Get worker interface.
 	* @details		Returns worker interface for asynchronous tasks. It is thread which executes
@@ -129,6 +217,20 @@ public:
 	* @see			IMsvWorker
 	******************************************************************************************************/
 	virtual MsvErrorCode GetWorker(std::shared_ptr<IMsvWorker>& spWorker, std::shared_ptr<std::condition_variable> spConditionVariable = nullptr, std::shared_ptr<std::mutex> spConditionVariableMutex = nullptr, std::shared_ptr<uint64_t> spConditionVariablePredicate = nullptr) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get worker interface.
+	* @details		Returns worker interface for asynchronous tasks which shares wake condition
+	*					with other workers by notifier.
+	* @param[out]	spWorker								Shared pointer to worker interface @ref IMsvWorker.
+	* @param[in]	spNotifier							Shared notifier (see @ref GetNotifier).
+	* @retval		MSV_INVALID_DATA_ERROR			When notifier is empty.
+	* @retval		MSV_ALLOCATION_ERROR				When memory allocation failed.
+	* @retval		MSV_SUCCESS							On success.
+	* @see			IMsvWorker
+	* @see			IMsvNotifier
+	******************************************************************************************************/
+	virtual MsvErrorCode GetWorker(std::shared_ptr<IMsvWorker>& spWorker, std::shared_ptr<IMsvNotifier> spNotifier) const = 0;
 };
 
 
@@ -0,0 +1,218 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Virtual Scheduler Interface
+* @details		Contains definition of @ref IMsvVirtualScheduler and @ref IMsvVirtualEvent interfaces.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_IVIRTUALSCHEDULER_H
+#define MARSTECH_IVIRTUALSCHEDULER_H
+
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Virtual Event Interface.
+* @details	Event driven by virtual time of @ref IMsvVirtualScheduler. It is virtual time counterpart of
+*				@ref IMsvEvent - waiting does not block thread, waiter continuation is scheduled when event is
+*				set or when timeout elapses.
+* @see		IMsvVirtualScheduler
+******************************************************************************************************/
+class IMsvVirtualEvent
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvVirtualEvent() {}
+
+	/**************************************************************************************************//**
+	* @brief			Set event.
+	* @details		Wakes one waiter (or all waiters when notifyAll is true). Event stays set when there
+	*					is no waiter and next waiter is woken immediately.
+	* @param[in]	notifyAll						True to wake all waiters, false to wake one waiter.
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When scheduler has been destroyed (and there is a waiter).
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Woken waiter is chosen by seeded random generator of scheduler (deterministic order).
+	******************************************************************************************************/
+	virtual MsvErrorCode SetEvent(bool notifyAll = false) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Reset event.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode ResetEvent() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Check if event is set.
+	* @returns		bool
+	* @retval		true				When event is set.
+	* @retval		false				When event is not set.
+	******************************************************************************************************/
+	virtual bool IsSet() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Wait for event.
+	* @details		Registers waiter continuation. It is executed by scheduler when event is set (signaled
+	*					is true) or when timeout elapses (signaled is false).
+	* @param[in]	continuation					Waiter continuation.
+	* @param[in]	pContext							Context passed to continuation.
+	* @param[in]	timeout							Timeout in virtual microseconds (0 means infinite).
+	* @retval		MSV_INVALID_DATA_ERROR		When continuation is empty.
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When scheduler has been destroyed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Set event is consumed by woken waiter (auto reset).
+	******************************************************************************************************/
+	virtual MsvErrorCode WaitForEvent(std::function<void(void* pContext, bool signaled)> continuation, void* pContext, uint64_t timeout = 0) = 0;
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Virtual Scheduler Interface.
+* @details	Deterministic scheduler driven by virtual clock. Tasks, periodic tasks (virtual time counterpart
+*				of @ref IMsvUniqueWorker period) and event timeouts are executed in virtual time order by
+*				thread which calls @ref RunFor or @ref RunUntilIdle, so hours of timer driven behaviour are
+*				simulated in seconds.
+* @note		Tasks with the same virtual time are ordered by seeded random generator. The same seed
+*				reproduces exactly the same order, different seeds explore different orderings (races).
+******************************************************************************************************/
+class IMsvVirtualScheduler
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvVirtualScheduler() {}
+
+	/**************************************************************************************************//**
+	* @brief			Get virtual time.
+	* @details		Returns current virtual time in microseconds (starts at 0).
+	* @returns		uint64_t
+	******************************************************************************************************/
+	virtual uint64_t GetTime() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get seed.
+	* @details		Returns seed of random generator which orders tasks with the same virtual time.
+	* @returns		uint64_t
+	******************************************************************************************************/
+	virtual uint64_t GetSeed() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Add task.
+	* @details		Schedules one shot task.
+	* @param[in]	task								Task to execute.
+	* @param[in]	pContext							Context passed to task.
+	* @param[in]	delay								Delay in virtual microseconds.
+	* @retval		MSV_INVALID_DATA_ERROR		When task is empty.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::function<void(void*)> task, void* pContext, uint64_t delay = 0) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Add periodic task.
+	* @details		Schedules task which is executed each period until it is removed.
+	* @param[out]	taskId							ID of periodic task (see @ref RemovePeriodicTask).
+	* @param[in]	task								Task to execute.
+	* @param[in]	pContext							Context passed to task.
+	* @param[in]	period							Period in virtual microseconds.
+	* @retval		MSV_INVALID_DATA_ERROR		When task is empty or period is zero.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode AddPeriodicTask(uint64_t& taskId, std::function<void(void*)> task, void* pContext, uint64_t period) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Remove periodic task.
+	* @param[in]	taskId							ID of periodic task.
+	* @retval		MSV_NOT_FOUND_ERROR			When periodic task does not exist.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode RemovePeriodicTask(uint64_t taskId) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get virtual event.
+	* @details		Returns new event driven by this scheduler.
+	* @param[out]	spEvent							Shared pointer to virtual event interface @ref IMsvVirtualEvent.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	* @note			Event might outlive scheduler (it fails with MSV_NOT_INITIALIZED_ERROR then).
+	******************************************************************************************************/
+	virtual MsvErrorCode GetEvent(std::shared_ptr<IMsvVirtualEvent>& spEvent) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Run for duration.
+	* @details		Executes all tasks scheduled up to current time + duration and moves virtual time
+	*					to the end of duration.
+	* @param[in]	duration							Duration in virtual microseconds.
+	* @returns		uint64_t
+	* @retval		Number of executed tasks.
+	******************************************************************************************************/
+	virtual uint64_t RunFor(uint64_t duration) = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Run until idle.
+	* @details		Executes tasks until there is no scheduled task except periodic tasks and event waiters
+	*					without timeout.
+	* @returns		uint64_t
+	* @retval		Number of executed tasks.
+	******************************************************************************************************/
+	virtual uint64_t RunUntilIdle() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Run next task.
+	* @details		Executes one (the earliest) scheduled task including periodic tasks and moves virtual
+	*					time to it.
+	* @returns		bool
+	* @retval		true				When task has been executed.
+	* @retval		false				When there is no scheduled task.
+	* @note			It is used by blocking waits of virtual threading (see @ref IMsvThreading::GetVirtualThreading).
+	******************************************************************************************************/
+	virtual bool RunNextTask() = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get pending tasks count.
+	* @details		Returns number of scheduled tasks (including periodic tasks and event timeouts).
+	* @returns		size_t
+	******************************************************************************************************/
+	virtual size_t GetPendingTasksCount() const = 0;
+};
+
+
+#endif // !MARSTECH_IVIRTUALSCHEDULER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,279 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Fiber
+* @details		Contains implementation of @ref MsvFiber.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvFiber.h"
+
+#include "merror/MsvErrorCodes.h"
+
+#ifdef _WIN32
+MSV_DISABLE_ALL_WARNINGS
+
+#include <windows.h>
+
+MSV_ENABLE_WARNINGS
+#endif // _WIN32
+
+
+/**************************************************************************************************//**
+* @brief		Current fiber.
+* @details	Fiber executed by this thread (nullptr when thread executes scheduler loop or it is not
+*				scheduler thread). Fibers never migrate between threads, so thread local storage is safe.
+******************************************************************************************************/
+thread_local MsvFiber* t_pCurrentFiber = nullptr;
+
+#ifndef _WIN32
+/**************************************************************************************************//**
+* @brief		Starting fiber.
+* @details	Passes fiber to its entry (makecontext can pass just int arguments).
+******************************************************************************************************/
+thread_local MsvFiber* t_pStartingFiber = nullptr;
+#endif // !_WIN32
+
+
+#ifdef _WIN32
+/**************************************************************************************************//**
+* @brief			Win32 fiber entry.
+* @param[in]	pParameter				Started fiber.
+******************************************************************************************************/
+void WINAPI MsvFiberEntry(LPVOID pParameter)
+{
+	MsvFiber::FiberMain(static_cast<MsvFiber*>(pParameter));
+}
+#else
+/**************************************************************************************************//**
+* @brief			POSIX fiber entry.
+******************************************************************************************************/
+void MsvFiberEntry()
+{
+	MsvFiber::FiberMain(t_pStartingFiber);
+}
+#endif // _WIN32
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvFiber::MsvFiber(MsvFiberThread* pThread, size_t stackSize):
+	m_pThread(pThread),
+	m_stackSize(stackSize),
+	m_context(),
+	m_pContext(nullptr),
+	m_waiting(false),
+	m_cancelled(false)
+{
+
+}
+
+
+MsvFiber::~MsvFiber()
+{
+#ifdef _WIN32
+	if (m_context.pFiber)
+	{
+		DeleteFiber(m_context.pFiber);
+	}
+#endif // _WIN32
+}
+
+
+/********************************************************************************************************************************
+*															MsvFiber public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvFiber::Initialize()
+{
+#ifdef _WIN32
+	m_context.pFiber = CreateFiber(m_stackSize, MsvFiberEntry, this);
+	if (!m_context.pFiber)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+#else
+	m_spStack.reset(new (std::nothrow) char[m_stackSize]);
+	if (!m_spStack || getcontext(&m_context.context) != 0)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	m_context.context.uc_stack.ss_sp = m_spStack.get();
+	m_context.context.uc_stack.ss_size = m_stackSize;
+	m_context.context.uc_link = nullptr;
+	makecontext(&m_context.context, MsvFiberEntry, 0);
+#endif // _WIN32
+
+	return MSV_SUCCESS;
+}
+
+void MsvFiber::SetTask(std::function<void(void*)> task, void* pContext)
+{
+	m_task = task;
+	m_pContext = pContext;
+}
+
+MsvFiberThread* MsvFiber::GetThread() const
+{
+	return m_pThread;
+}
+
+void MsvFiber::Run()
+{
+	t_pCurrentFiber = this;
+
+#ifdef _WIN32
+	SwitchToFiber(m_context.pFiber);
+#else
+	t_pStartingFiber = this;
+	swapcontext(&m_pThread->schedulerContext.context, &m_context.context);
+#endif // _WIN32
+
+	t_pCurrentFiber = nullptr;
+}
+
+void MsvFiber::SwitchToScheduler(MsvFiberSwitchReason reason)
+{
+	m_pThread->switchReason = reason;
+
+#ifdef _WIN32
+	SwitchToFiber(m_pThread->schedulerContext.pFiber);
+#else
+	swapcontext(&m_context.context, &m_pThread->schedulerContext.context);
+#endif // _WIN32
+}
+
+MsvErrorCode MsvFiber::PrepareSuspend()
+{
+	std::lock_guard<std::mutex> lock(m_pThread->lock);
+
+	if (!m_pThread->running)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	m_waiting = true;
+	m_cancelled = false;
+
+	return MSV_SUCCESS;
+}
+
+void MsvFiber::Resume()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_pThread->lock);
+
+		if (!m_waiting)
+		{
+			//wait has been cancelled -> fiber is already queued
+			return;
+		}
+
+		m_waiting = false;
+		m_pThread->readyFibers.push_back(this);
+	}
+
+	m_pThread->condition.notify_one();
+}
+
+bool MsvFiber::Cancel()
+{
+	if (!m_waiting)
+	{
+		return false;
+	}
+
+	m_waiting = false;
+	m_cancelled = true;
+	m_pThread->readyFibers.push_back(this);
+
+	return true;
+}
+
+bool MsvFiber::IsCancelled() const
+{
+	return m_cancelled;
+}
+
+MsvFiber* MsvFiber::GetCurrentFiber()
+{
+	return t_pCurrentFiber;
+}
+
+MsvErrorCode MsvFiber::ConvertThreadToFiber(MsvFiberContext& context)
+{
+#ifdef _WIN32
+	context.pFiber = ::ConvertThreadToFiber(nullptr);
+	if (!context.pFiber)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+#else
+	//scheduler context is filled by swapcontext
+	(void)context;
+#endif // _WIN32
+
+	return MSV_SUCCESS;
+}
+
+void MsvFiber::ConvertFiberToThread(MsvFiberContext& context)
+{
+#ifdef _WIN32
+	::ConvertFiberToThread();
+	context.pFiber = nullptr;
+#else
+	(void)context;
+#endif // _WIN32
+}
+
+
+/********************************************************************************************************************************
+*															MsvFiber protected methods
+********************************************************************************************************************************/
+
+
+void MsvFiber::FiberMain(MsvFiber* pFiber)
+{
+	while (true)
+	{
+		pFiber->m_task(pFiber->m_pContext);
+
+		//release captured resources before fiber is pooled
+		pFiber->m_task = nullptr;
+		pFiber->m_pContext = nullptr;
+
+		pFiber->SwitchToScheduler(MsvFiberSwitchReason::MSV_FIBER_FINISH);
+	}
+}
+
+/** @} */	//End of group MSYS.
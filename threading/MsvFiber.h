@@ -0,0 +1,287 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Fiber
+* @details		Contains platform fiber @ref MsvFiber used by @ref MsvFiberScheduler.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_FIBER_H
+#define MARSTECH_FIBER_H
+
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <ucontext.h>
+#endif // !_WIN32
+
+MSV_ENABLE_WARNINGS
+
+
+class MsvFiber;
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Fiber Switch Reason.
+* @details	Reason why fiber has switched back to its scheduler thread.
+******************************************************************************************************/
+enum class MsvFiberSwitchReason: int32_t
+{
+	MSV_FIBER_YIELD = 0,			///< Fiber is ready to continue (it is queued again).
+	MSV_FIBER_SUSPEND,			///< Fiber waits (it is queued by waker).
+	MSV_FIBER_FINISH				///< Fiber function has finished (fiber is returned to pool).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Fiber Context.
+* @details	Platform execution context (Win32 fiber or POSIX user context).
+******************************************************************************************************/
+struct MsvFiberContext
+{
+#ifdef _WIN32
+	void* pFiber;									///< Win32 fiber handle.
+#else
+	ucontext_t context;							///< POSIX user context.
+#endif // _WIN32
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Fiber Thread.
+* @details	Scheduler thread and its fibers. Fiber is bound to one thread for its whole life.
+******************************************************************************************************/
+struct MsvFiberThread
+{
+	std::thread thread;											///< Scheduler thread.
+	std::mutex lock;												///< Locks ready queue, fibers pool and counters.
+	std::condition_variable condition;						///< Notified when fiber is ready or thread should stop.
+	std::deque<MsvFiber*> readyFibers;						///< Fibers ready to run.
+	std::vector<std::unique_ptr<MsvFiber>> fibers;		///< All fibers of this thread (owner).
+	std::vector<MsvFiber*> idleFibers;						///< Pool of finished fibers (reused by new fibers).
+	size_t liveFibers;											///< Number of spawned fibers which have not finished yet.
+	bool running;													///< False when thread should stop (waiting fibers are cancelled).
+	MsvFiberContext schedulerContext;						///< Context of thread scheduler loop (accessed by owner thread only).
+	MsvFiberSwitchReason switchReason;						///< Reason of last switch to scheduler loop (accessed by owner thread only).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Fiber.
+* @details	Stackful fiber bound to one @ref MsvFiberThread. Fiber executes tasks in loop, so it (and its
+*				stack) is reused by next task when its task finishes.
+******************************************************************************************************/
+class MsvFiber
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	pThread				Thread which executes this fiber.
+	* @param[in]	stackSize			Stack size in bytes.
+	******************************************************************************************************/
+	MsvFiber(MsvFiberThread* pThread, size_t stackSize);
+
+	/**************************************************************************************************//**
+	* @brief		Destructor.
+	******************************************************************************************************/
+	~MsvFiber();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize fiber.
+	* @details		Allocates stack and creates fiber context.
+	* @retval		MSV_ALLOCATION_ERROR		When memory allocation failed.
+	* @retval		MSV_SUCCESS					On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize();
+
+	/**************************************************************************************************//**
+	* @brief			Set task.
+	* @details		Sets task which is executed when fiber is switched to.
+	* @param[in]	task						Fiber function.
+	* @param[in]	pContext					Context passed to fiber function.
+	******************************************************************************************************/
+	void SetTask(std::function<void(void*)> task, void* pContext);
+
+	/**************************************************************************************************//**
+	* @brief			Get thread.
+	* @returns		MsvFiberThread*
+	******************************************************************************************************/
+	MsvFiberThread* GetThread() const;
+
+	/**************************************************************************************************//**
+	* @brief			Run fiber.
+	* @details		Switches from scheduler loop to this fiber. It returns when fiber switches back.
+	* @warning		It must be called by owner thread from its scheduler loop.
+	******************************************************************************************************/
+	void Run();
+
+	/**************************************************************************************************//**
+	* @brief			Switch to scheduler.
+	* @details		Switches from this fiber back to scheduler loop of its thread.
+	* @param[in]	reason					Reason of switch.
+	* @warning		It must be called from this fiber.
+	******************************************************************************************************/
+	void SwitchToScheduler(MsvFiberSwitchReason reason);
+
+	/**************************************************************************************************//**
+	* @brief			Prepare suspend.
+	* @details		Marks fiber as waiting (it must be called before fiber is registered as waiter and
+	*					switched to scheduler with @ref MsvFiberSwitchReason::MSV_FIBER_SUSPEND).
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When scheduler is stopping (fiber must not wait).
+	* @retval		MSV_SUCCESS						On success.
+	* @warning		It must be called from this fiber.
+	******************************************************************************************************/
+	MsvErrorCode PrepareSuspend();
+
+	/**************************************************************************************************//**
+	* @brief			Resume fiber.
+	* @details		Queues waiting fiber to its thread. It does nothing when fiber has been already resumed
+	*					or its wait has been cancelled. It might be called from any thread.
+	******************************************************************************************************/
+	void Resume();
+
+	/**************************************************************************************************//**
+	* @brief			Cancel wait.
+	* @details		Queues waiting fiber to its thread and marks its wait as cancelled (see
+	*					@ref IsCancelled).
+	* @returns		bool
+	* @retval		true						When fiber has been waiting.
+	* @retval		false						When fiber has not been waiting.
+	* @warning		It must be called by owner thread from its scheduler loop with thread lock held.
+	******************************************************************************************************/
+	bool Cancel();
+
+	/**************************************************************************************************//**
+	* @brief			Check if wait has been cancelled.
+	* @returns		bool
+	* @retval		true						When last wait of fiber has been cancelled by stopping scheduler.
+	* @retval		false						When fiber has been resumed by waker.
+	* @warning		It must be called from this fiber.
+	******************************************************************************************************/
+	bool IsCancelled() const;
+
+	/**************************************************************************************************//**
+	* @brief			Get current fiber.
+	* @returns		MsvFiber*
+	* @retval		nullptr				When it is not called from fiber.
+	******************************************************************************************************/
+	static MsvFiber* GetCurrentFiber();
+
+	/**************************************************************************************************//**
+	* @brief			Convert thread to fiber.
+	* @details		Initializes scheduler context of calling thread (it must be called by scheduler thread
+	*					before any fiber is run).
+	* @param[out]	context					Scheduler context.
+	* @retval		MSV_ALLOCATION_ERROR	When conversion failed.
+	* @retval		MSV_SUCCESS				On success.
+	******************************************************************************************************/
+	static MsvErrorCode ConvertThreadToFiber(MsvFiberContext& context);
+
+	/**************************************************************************************************//**
+	* @brief			Convert fiber to thread.
+	* @details		Releases scheduler context of calling thread.
+	* @param[in]	context					Scheduler context.
+	******************************************************************************************************/
+	static void ConvertFiberToThread(MsvFiberContext& context);
+
+	/**************************************************************************************************//**
+	* @brief			Fiber main loop.
+	* @details		Executes tasks and switches back to scheduler when task finishes. It is called by
+	*					platform fiber entry.
+	* @param[in]	pFiber					Executed fiber.
+	******************************************************************************************************/
+	static void FiberMain(MsvFiber* pFiber);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread.
+	* @details	Thread which executes this fiber.
+	******************************************************************************************************/
+	MsvFiberThread* m_pThread;
+
+	/**************************************************************************************************//**
+	* @brief		Stack size.
+	* @details	Stack size in bytes.
+	******************************************************************************************************/
+	size_t m_stackSize;
+
+	/**************************************************************************************************//**
+	* @brief		Context.
+	* @details	Execution context of this fiber.
+	******************************************************************************************************/
+	MsvFiberContext m_context;
+
+#ifndef _WIN32
+	/**************************************************************************************************//**
+	* @brief		Stack.
+	* @details	Stack of this fiber (Win32 fibers allocate stack by themselves).
+	******************************************************************************************************/
+	std::unique_ptr<char[]> m_spStack;
+#endif // !_WIN32
+
+	/**************************************************************************************************//**
+	* @brief		Task.
+	* @details	Fiber function.
+	******************************************************************************************************/
+	std::function<void(void*)> m_task;
+
+	/**************************************************************************************************//**
+	* @brief		Task context.
+	* @details	Context passed to fiber function.
+	******************************************************************************************************/
+	void* m_pContext;
+
+	/**************************************************************************************************//**
+	* @brief		Waiting flag.
+	* @details	True when fiber waits and it has not been resumed yet (locked by thread lock).
+	******************************************************************************************************/
+	bool m_waiting;
+
+	/**************************************************************************************************//**
+	* @brief		Cancelled flag.
+	* @details	True when last wait of fiber has been cancelled (accessed by owner thread only).
+	******************************************************************************************************/
+	bool m_cancelled;
+};
+
+
+#endif // !MARSTECH_FIBER_H
+
+/** @} */	//End of group MSYS.
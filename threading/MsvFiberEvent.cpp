@@ -0,0 +1,149 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Fiber Event Implementation
+* @details		Contains implementation of @ref MsvFiberEvent.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvFiberEvent.h"
+#include "MsvFiber.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvFiberEvent::MsvFiberEvent():
+	m_set(false)
+{
+
+}
+
+
+MsvFiberEvent::~MsvFiberEvent()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															IMsvFiberEvent public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvFiberEvent::SetEvent(bool notifyAll)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_waiters.empty())
+	{
+		m_set = true;
+		return MSV_SUCCESS;
+	}
+
+	//fibers are resumed under lock -> cancelled waiter can not finish (and be released) before it is resumed
+	if (notifyAll)
+	{
+		for (MsvFiber* pFiber: m_waiters)
+		{
+			pFiber->Resume();
+		}
+
+		m_waiters.clear();
+	}
+	else
+	{
+		m_waiters.front()->Resume();
+		m_waiters.pop_front();
+	}
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvFiberEvent::ResetEvent()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	m_set = false;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvFiberEvent::WaitForEvent()
+{
+	MsvFiber* pFiber = MsvFiber::GetCurrentFiber();
+	if (!pFiber)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (m_set)
+		{
+			//auto reset -> set event is consumed by this waiter
+			m_set = false;
+			return MSV_SUCCESS;
+		}
+
+		MSV_RETURN_FAILED(pFiber->PrepareSuspend());
+		m_waiters.push_back(pFiber);
+	}
+
+	//fiber might be resumed before it is suspended, but it is run by its own thread only after switch
+	pFiber->SwitchToScheduler(MsvFiberSwitchReason::MSV_FIBER_SUSPEND);
+
+	if (pFiber->IsCancelled())
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		std::deque<MsvFiber*>::iterator it = std::find(m_waiters.begin(), m_waiters.end(), pFiber);
+		if (it != m_waiters.end())
+		{
+			m_waiters.erase(it);
+			return MSV_NOT_INITIALIZED_ERROR;
+		}
+
+		//event has been set before wait has been cancelled -> it is consumed by this waiter
+	}
+
+	return MSV_SUCCESS;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,109 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Fiber Event Implementation
+* @details		Contains implementation @ref MsvFiberEvent of @ref IMsvFiberEvent interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_FIBEREVENT_H
+#define MARSTECH_FIBEREVENT_H
+
+
+#include "IMsvFiberScheduler.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <deque>
+#include <mutex>
+
+MSV_ENABLE_WARNINGS
+
+
+class MsvFiber;
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Fiber Event Implementation.
+* @details	Implementation of fiber event interface. Waiting fibers are suspended and queued again to
+*				their threads when event is set.
+* @see		IMsvFiberEvent
+******************************************************************************************************/
+class MsvFiberEvent:
+	public IMsvFiberEvent
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvFiberEvent();
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvFiberEvent();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberEvent::SetEvent(bool notifyAll)
+	******************************************************************************************************/
+	virtual MsvErrorCode SetEvent(bool notifyAll = false) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberEvent::ResetEvent()
+	******************************************************************************************************/
+	virtual MsvErrorCode ResetEvent() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberEvent::WaitForEvent()
+	******************************************************************************************************/
+	virtual MsvErrorCode WaitForEvent() override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Mutex.
+	* @details	Locks this object for thread safety access (it is never held while fiber is suspended).
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Waiters.
+	* @details	Suspended fibers (in FIFO order).
+	******************************************************************************************************/
+	std::deque<MsvFiber*> m_waiters;
+
+	/**************************************************************************************************//**
+	* @brief		Set flag.
+	* @details	True when event has been set and there was no waiter.
+	******************************************************************************************************/
+	bool m_set;
+};
+
+
+#endif // !MARSTECH_FIBEREVENT_H
+
+/** @} */	//End of group MSYS.
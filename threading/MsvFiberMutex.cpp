@@ -0,0 +1,146 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Fiber Mutex Implementation
+* @details		Contains implementation of @ref MsvFiberMutex.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvFiberMutex.h"
+#include "MsvFiber.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvFiberMutex::MsvFiberMutex():
+	m_locked(false)
+{
+
+}
+
+
+MsvFiberMutex::~MsvFiberMutex()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															IMsvFiberMutex public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvFiberMutex::Lock()
+{
+	MsvFiber* pFiber = MsvFiber::GetCurrentFiber();
+	if (!pFiber)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (!m_locked)
+		{
+			m_locked = true;
+			return MSV_SUCCESS;
+		}
+
+		MSV_RETURN_FAILED(pFiber->PrepareSuspend());
+		m_waiters.push_back(pFiber);
+	}
+
+	//ownership is handed over by unlock (mutex stays locked)
+	pFiber->SwitchToScheduler(MsvFiberSwitchReason::MSV_FIBER_SUSPEND);
+
+	if (pFiber->IsCancelled())
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		std::deque<MsvFiber*>::iterator it = std::find(m_waiters.begin(), m_waiters.end(), pFiber);
+		if (it != m_waiters.end())
+		{
+			m_waiters.erase(it);
+			return MSV_NOT_INITIALIZED_ERROR;
+		}
+
+		//ownership has been handed over before wait has been cancelled -> mutex is locked by this fiber
+	}
+
+	return MSV_SUCCESS;
+}
+
+bool MsvFiberMutex::TryLock()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_locked)
+	{
+		return false;
+	}
+
+	m_locked = true;
+
+	return true;
+}
+
+MsvErrorCode MsvFiberMutex::Unlock()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (!m_locked)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	if (m_waiters.empty())
+	{
+		m_locked = false;
+		return MSV_SUCCESS;
+	}
+
+	//fiber is resumed under lock -> cancelled waiter can not finish (and be released) before it is resumed
+	m_waiters.front()->Resume();
+	m_waiters.pop_front();
+
+	return MSV_SUCCESS;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,109 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Fiber Mutex Implementation
+* @details		Contains implementation @ref MsvFiberMutex of @ref IMsvFiberMutex interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_FIBERMUTEX_H
+#define MARSTECH_FIBERMUTEX_H
+
+
+#include "IMsvFiberScheduler.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <deque>
+#include <mutex>
+
+MSV_ENABLE_WARNINGS
+
+
+class MsvFiber;
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Fiber Mutex Implementation.
+* @details	Implementation of fiber mutex interface. Fibers which can not lock mutex are suspended and
+*				ownership is handed over to them by @ref Unlock.
+* @see		IMsvFiberMutex
+******************************************************************************************************/
+class MsvFiberMutex:
+	public IMsvFiberMutex
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvFiberMutex();
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvFiberMutex();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberMutex::Lock()
+	******************************************************************************************************/
+	virtual MsvErrorCode Lock() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberMutex::TryLock()
+	******************************************************************************************************/
+	virtual bool TryLock() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberMutex::Unlock()
+	******************************************************************************************************/
+	virtual MsvErrorCode Unlock() override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Mutex.
+	* @details	Locks this object for thread safety access (it is never held while fiber is suspended).
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Waiters.
+	* @details	Suspended fibers (in FIFO order).
+	******************************************************************************************************/
+	std::deque<MsvFiber*> m_waiters;
+
+	/**************************************************************************************************//**
+	* @brief		Locked flag.
+	* @details	True when mutex is owned by any fiber.
+	******************************************************************************************************/
+	bool m_locked;
+};
+
+
+#endif // !MARSTECH_FIBERMUTEX_H
+
+/** @} */	//End of group MSYS.
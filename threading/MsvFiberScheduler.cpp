@@ -0,0 +1,313 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Fiber Scheduler Implementation
+* @details		Contains implementation of @ref MsvFiberScheduler.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvFiberScheduler.h"
+#include "MsvFiberEvent.h"
+#include "MsvFiberMutex.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvFiberScheduler::MsvFiberScheduler():
+	m_nextThread(0),
+	m_stackSize(0),
+	m_running(false),
+	m_fibersCount(0)
+{
+
+}
+
+
+MsvFiberScheduler::~MsvFiberScheduler()
+{
+	Stop();
+}
+
+
+/********************************************************************************************************************************
+*															IMsvFiberScheduler public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvFiberScheduler::Start(uint16_t threadsCount, size_t stackSize)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (m_running)
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	if (threadsCount == 0)
+	{
+		threadsCount = static_cast<uint16_t>(std::thread::hardware_concurrency());
+		if (threadsCount == 0)
+		{
+			threadsCount = 1;
+		}
+	}
+
+	m_stackSize = stackSize;
+	m_nextThread = 0;
+
+	for (uint16_t i = 0; i < threadsCount; ++i)
+	{
+		std::unique_ptr<MsvFiberThread> spThread(new (std::nothrow) MsvFiberThread());
+		if (!spThread)
+		{
+			m_threads.clear();
+			return MSV_ALLOCATION_ERROR;
+		}
+
+		spThread->liveFibers = 0;
+		spThread->running = true;
+		m_threads.push_back(std::move(spThread));
+	}
+
+	for (std::unique_ptr<MsvFiberThread>& spThread: m_threads)
+	{
+		spThread->thread = std::thread(&MsvFiberScheduler::SchedulerThread, this, spThread.get());
+	}
+
+	m_running = true;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvFiberScheduler::Stop()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!m_running)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	m_running = false;
+
+	for (std::unique_ptr<MsvFiberThread>& spThread: m_threads)
+	{
+		{
+			std::lock_guard<std::mutex> threadLock(spThread->lock);
+			spThread->running = false;
+		}
+
+		spThread->condition.notify_one();
+	}
+
+	for (std::unique_ptr<MsvFiberThread>& spThread: m_threads)
+	{
+		spThread->thread.join();
+	}
+
+	m_threads.clear();
+
+	return MSV_SUCCESS;
+}
+
+bool MsvFiberScheduler::IsRunning() const
+{
+	return m_running;
+}
+
+MsvErrorCode MsvFiberScheduler::Spawn(std::function<void(void*)> fiber, void* pContext)
+{
+	if (!fiber)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!m_running)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	MsvFiberThread* pThread = m_threads[m_nextThread].get();
+	m_nextThread = (m_nextThread + 1) % m_threads.size();
+
+	{
+		std::lock_guard<std::mutex> threadLock(pThread->lock);
+
+		MsvFiber* pFiber = nullptr;
+
+		if (!pThread->idleFibers.empty())
+		{
+			//reuse pooled fiber (and its stack)
+			pFiber = pThread->idleFibers.back();
+			pThread->idleFibers.pop_back();
+		}
+		else
+		{
+			std::unique_ptr<MsvFiber> spFiber(new (std::nothrow) MsvFiber(pThread, m_stackSize));
+			if (!spFiber)
+			{
+				return MSV_ALLOCATION_ERROR;
+			}
+
+			MSV_RETURN_FAILED(spFiber->Initialize());
+
+			pFiber = spFiber.get();
+			pThread->fibers.push_back(std::move(spFiber));
+		}
+
+		pFiber->SetTask(fiber, pContext);
+		pThread->readyFibers.push_back(pFiber);
+		++pThread->liveFibers;
+		++m_fibersCount;
+	}
+
+	pThread->condition.notify_one();
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvFiberScheduler::YieldFiber()
+{
+	MsvFiber* pFiber = MsvFiber::GetCurrentFiber();
+	if (!pFiber)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	pFiber->SwitchToScheduler(MsvFiberSwitchReason::MSV_FIBER_YIELD);
+
+	return MSV_SUCCESS;
+}
+
+size_t MsvFiberScheduler::GetFibersCount() const
+{
+	return m_fibersCount;
+}
+
+MsvErrorCode MsvFiberScheduler::GetEvent(std::shared_ptr<IMsvFiberEvent>& spEvent)
+{
+	std::shared_ptr<IMsvFiberEvent> spTempEvent(new (std::nothrow) MsvFiberEvent());
+
+	if (!spTempEvent)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spEvent = spTempEvent;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvFiberScheduler::GetMutex(std::shared_ptr<IMsvFiberMutex>& spMutex)
+{
+	std::shared_ptr<IMsvFiberMutex> spTempMutex(new (std::nothrow) MsvFiberMutex());
+
+	if (!spTempMutex)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spMutex = spTempMutex;
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvFiberScheduler protected methods
+********************************************************************************************************************************/
+
+
+void MsvFiberScheduler::SchedulerThread(MsvFiberThread* pThread)
+{
+	if (MSV_FAILED(MsvFiber::ConvertThreadToFiber(pThread->schedulerContext)))
+	{
+		return;
+	}
+
+	while (true)
+	{
+		MsvFiber* pFiber = nullptr;
+
+		{
+			std::unique_lock<std::mutex> lock(pThread->lock);
+			pThread->condition.wait(lock, [pThread] { return !pThread->readyFibers.empty() || !pThread->running; });
+
+			if (pThread->readyFibers.empty())
+			{
+				if (pThread->liveFibers == 0)
+				{
+					break;
+				}
+
+				//all live fibers wait and scheduler is stopping -> cancel their waits (they finish instead of waiting forever)
+				for (std::unique_ptr<MsvFiber>& spFiber: pThread->fibers)
+				{
+					spFiber->Cancel();
+				}
+
+				continue;
+			}
+
+			pFiber = pThread->readyFibers.front();
+			pThread->readyFibers.pop_front();
+		}
+
+		pFiber->Run();
+
+		if (pThread->switchReason == MsvFiberSwitchReason::MSV_FIBER_YIELD)
+		{
+			std::lock_guard<std::mutex> lock(pThread->lock);
+			pThread->readyFibers.push_back(pFiber);
+		}
+		else if (pThread->switchReason == MsvFiberSwitchReason::MSV_FIBER_FINISH)
+		{
+			std::lock_guard<std::mutex> lock(pThread->lock);
+			pThread->idleFibers.push_back(pFiber);
+			--pThread->liveFibers;
+			--m_fibersCount;
+		}
+
+		//suspended fiber is queued again by its waker
+	}
+
+	//fibers (and their stacks) must be released before thread is converted back
+	pThread->idleFibers.clear();
+	pThread->fibers.clear();
+
+	MsvFiber::ConvertFiberToThread(pThread->schedulerContext);
+}
+
+/** @} */	//End of group MSYS.
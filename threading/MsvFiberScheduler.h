@@ -0,0 +1,157 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Fiber Scheduler Implementation
+* @details		Contains implementation @ref MsvFiberScheduler of @ref IMsvFiberScheduler interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_FIBERSCHEDULER_H
+#define MARSTECH_FIBERSCHEDULER_H
+
+
+#include "IMsvFiberScheduler.h"
+#include "MsvFiber.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Fiber Scheduler Implementation.
+* @details	Implementation of fiber scheduler interface. Each scheduler thread has its own ready queue and
+*				pool of fibers (with stacks), fibers are never migrated between threads.
+* @see		IMsvFiberScheduler
+******************************************************************************************************/
+class MsvFiberScheduler:
+	public IMsvFiberScheduler
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvFiberScheduler();
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvFiberScheduler();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberScheduler::Start(uint16_t threadsCount, size_t stackSize)
+	******************************************************************************************************/
+	virtual MsvErrorCode Start(uint16_t threadsCount = 0, size_t stackSize = 64 * 1024) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberScheduler::Stop()
+	******************************************************************************************************/
+	virtual MsvErrorCode Stop() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberScheduler::IsRunning() const
+	******************************************************************************************************/
+	virtual bool IsRunning() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberScheduler::Spawn(std::function<void(void*)> fiber, void* pContext)
+	******************************************************************************************************/
+	virtual MsvErrorCode Spawn(std::function<void(void*)> fiber, void* pContext) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberScheduler::YieldFiber()
+	******************************************************************************************************/
+	virtual MsvErrorCode YieldFiber() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberScheduler::GetFibersCount() const
+	******************************************************************************************************/
+	virtual size_t GetFibersCount() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberScheduler::GetEvent(std::shared_ptr<IMsvFiberEvent>& spEvent)
+	******************************************************************************************************/
+	virtual MsvErrorCode GetEvent(std::shared_ptr<IMsvFiberEvent>& spEvent) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvFiberScheduler::GetMutex(std::shared_ptr<IMsvFiberMutex>& spMutex)
+	******************************************************************************************************/
+	virtual MsvErrorCode GetMutex(std::shared_ptr<IMsvFiberMutex>& spMutex) override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Scheduler thread.
+	* @details		Runs ready fibers of thread until scheduler is stopped and all its fibers finish.
+	* @param[in]	pThread				Scheduler thread data.
+	******************************************************************************************************/
+	void SchedulerThread(MsvFiberThread* pThread);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access (start, stop and spawn).
+	******************************************************************************************************/
+	mutable std::recursive_mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Scheduler threads.
+	* @details	Scheduler threads and their fibers.
+	******************************************************************************************************/
+	std::vector<std::unique_ptr<MsvFiberThread>> m_threads;
+
+	/**************************************************************************************************//**
+	* @brief		Next thread.
+	* @details	Index of thread which gets next spawned fiber (round robin).
+	******************************************************************************************************/
+	size_t m_nextThread;
+
+	/**************************************************************************************************//**
+	* @brief		Stack size.
+	* @details	Stack size of fibers in bytes.
+	******************************************************************************************************/
+	size_t m_stackSize;
+
+	/**************************************************************************************************//**
+	* @brief		Running flag.
+	* @details	True when scheduler is running.
+	******************************************************************************************************/
+	std::atomic<bool> m_running;
+
+	/**************************************************************************************************//**
+	* @brief		Fibers count.
+	* @details	Number of spawned fibers which have not finished yet.
+	******************************************************************************************************/
+	std::atomic<size_t> m_fibersCount;
+};
+
+
+#endif // !MARSTECH_FIBERSCHEDULER_H
+
+/** @} */	//End of group MSYS.
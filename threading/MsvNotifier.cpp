@@ -0,0 +1,260 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Notifier Implementation
+* @details		Contains implementation of @ref MsvNotifier.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvNotifier.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <algorithm>
+#include <chrono>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvNotifier::MsvNotifier():
+	m_tokens(0),
+	m_waiters(0),
+	m_externalWaiters(0)
+{
+
+}
+
+
+MsvNotifier::~MsvNotifier()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															MsvNotifier public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvNotifier::Initialize()
+{
+	if (m_spConditionVariable)
+	{
+		return MSV_ALREADY_INITIALIZED_INFO;
+	}
+
+	std::shared_ptr<std::condition_variable> spConditionVariable(new (std::nothrow) std::condition_variable());
+	std::shared_ptr<std::mutex> spConditionVariableMutex(new (std::nothrow) std::mutex());
+	std::shared_ptr<uint64_t> spConditionVariablePredicate(new (std::nothrow) uint64_t(0));
+
+	if (!spConditionVariable || !spConditionVariableMutex || !spConditionVariablePredicate)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	m_spConditionVariable = spConditionVariable;
+	m_spConditionVariableMutex = spConditionVariableMutex;
+	m_spConditionVariablePredicate = spConditionVariablePredicate;
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															IMsvNotifier public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvNotifier::NotifyOne()
+{
+	return Notify(1);
+}
+
+MsvErrorCode MsvNotifier::Notify(uint32_t count)
+{
+	if (count == 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	uint32_t waiters;
+	uint32_t externalWaiters = m_externalWaiters.load();
+	uint32_t workerTokens = 0;
+
+	if (externalWaiters == 0)
+	{
+		m_tokens.fetch_add(count);
+
+		//fast path -> nobody sleeps, token will be consumed by next waiter without locking
+		waiters = m_waiters.load();
+		if (waiters == 0)
+		{
+			return MSV_SUCCESS;
+		}
+	}
+	else
+	{
+		//each token is given to one counter - sleeping waiters first, attached workers get the rest
+		waiters = m_waiters.load();
+		uint32_t tokens = (std::min)(count, waiters);
+		workerTokens = count - tokens;
+
+		if (tokens != 0)
+		{
+			m_tokens.fetch_add(tokens);
+		}
+	}
+
+	{
+		//lock is required to not lose notification between predicate check and sleep of waiter
+		std::lock_guard<std::mutex> lock(*m_spConditionVariableMutex);
+
+		if (workerTokens != 0)
+		{
+			*m_spConditionVariablePredicate += workerTokens;
+		}
+	}
+
+	//waiters and workers share condition variable -> woken thread of other kind would not pass on notification
+	if (count >= waiters + externalWaiters || (waiters != 0 && externalWaiters != 0))
+	{
+		m_spConditionVariable->notify_all();
+	}
+	else
+	{
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			m_spConditionVariable->notify_one();
+		}
+	}
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvNotifier::NotifyAll()
+{
+	uint32_t count = m_waiters.load() + m_externalWaiters.load();
+	if (count == 0)
+	{
+		return MSV_SUCCESS;
+	}
+
+	return Notify(count);
+}
+
+bool MsvNotifier::WaitForNotification(uint64_t timeout)
+{
+	//fast path -> token is available
+	if (TryConsumeToken())
+	{
+		return true;
+	}
+
+	m_waiters.fetch_add(1);
+
+	bool result = true;
+	{
+		std::unique_lock<std::mutex> lock(*m_spConditionVariableMutex);
+
+		if (timeout == 0)
+		{
+			m_spConditionVariable->wait(lock, [this] { return TryConsumeToken(); });
+		}
+		else
+		{
+			result = m_spConditionVariable->wait_for(lock, std::chrono::microseconds(timeout), [this] { return TryConsumeToken(); });
+		}
+	}
+
+	m_waiters.fetch_sub(1);
+
+	return result;
+}
+
+uint32_t MsvNotifier::GetWaitersCount() const
+{
+	return m_waiters.load();
+}
+
+MsvErrorCode MsvNotifier::AttachWorker(std::shared_ptr<std::condition_variable>& spConditionVariable, std::shared_ptr<std::mutex>& spConditionVariableMutex, std::shared_ptr<uint64_t>& spConditionVariablePredicate)
+{
+	m_externalWaiters.fetch_add(1);
+
+	spConditionVariable = m_spConditionVariable;
+	spConditionVariableMutex = m_spConditionVariableMutex;
+	spConditionVariablePredicate = m_spConditionVariablePredicate;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvNotifier::DetachWorker()
+{
+	uint32_t externalWaiters = m_externalWaiters.load();
+
+	do
+	{
+		if (externalWaiters == 0)
+		{
+			return MSV_NOT_INITIALIZED_INFO;
+		}
+	}
+	while (!m_externalWaiters.compare_exchange_weak(externalWaiters, externalWaiters - 1));
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvNotifier protected methods
+********************************************************************************************************************************/
+
+
+bool MsvNotifier::TryConsumeToken()
+{
+	uint64_t tokens = m_tokens.load();
+
+	while (tokens != 0)
+	{
+		if (m_tokens.compare_exchange_weak(tokens, tokens - 1))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+/** @} */	//End of group MSYS.
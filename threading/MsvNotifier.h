@@ -0,0 +1,162 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Notifier Implementation
+* @details		Contains implementation @ref MsvNotifier of @ref IMsvNotifier interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_NOTIFIER_H
+#define MARSTECH_NOTIFIER_H
+
+
+#include "IMsvNotifier.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Notifier Implementation.
+* @details	Implementation of notifier interface. Tokens and waiters are counted by atomics, so
+*				notification without waiters and wait with available token do not lock mutex.
+* @see		IMsvNotifier
+******************************************************************************************************/
+class MsvNotifier:
+	public IMsvNotifier
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvNotifier();
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvNotifier();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize notifier.
+	* @details		Allocates synchronization objects shared with attached workers.
+	* @retval		MSV_ALREADY_INITIALIZED_INFO	When notifier is already initialized.
+	* @retval		MSV_ALLOCATION_ERROR			When memory allocation failed.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvNotifier::NotifyOne()
+	******************************************************************************************************/
+	virtual MsvErrorCode NotifyOne() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvNotifier::Notify(uint32_t count)
+	******************************************************************************************************/
+	virtual MsvErrorCode Notify(uint32_t count) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvNotifier::NotifyAll()
+	******************************************************************************************************/
+	virtual MsvErrorCode NotifyAll() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvNotifier::WaitForNotification(uint64_t timeout)
+	******************************************************************************************************/
+	virtual bool WaitForNotification(uint64_t timeout = 0) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvNotifier::GetWaitersCount() const
+	******************************************************************************************************/
+	virtual uint32_t GetWaitersCount() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvNotifier::AttachWorker(std::shared_ptr<std::condition_variable>& spConditionVariable, std::shared_ptr<std::mutex>& spConditionVariableMutex, std::shared_ptr<uint64_t>& spConditionVariablePredicate)
+	******************************************************************************************************/
+	virtual MsvErrorCode AttachWorker(std::shared_ptr<std::condition_variable>& spConditionVariable, std::shared_ptr<std::mutex>& spConditionVariableMutex, std::shared_ptr<uint64_t>& spConditionVariablePredicate) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvNotifier::DetachWorker()
+	******************************************************************************************************/
+	virtual MsvErrorCode DetachWorker() override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Try consume token.
+	* @details		Decrements token counter when it is not zero.
+	* @returns		bool
+	* @retval		true				When token has been consumed.
+	* @retval		false				When there is no token.
+	******************************************************************************************************/
+	bool TryConsumeToken();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Condition variable.
+	* @details	Waiters sleep on it when there is no token.
+	******************************************************************************************************/
+	std::shared_ptr<std::condition_variable> m_spConditionVariable;
+
+	/**************************************************************************************************//**
+	* @brief		Condition variable mutex.
+	* @details	It is locked only when there is a sleeping waiter (slow path).
+	******************************************************************************************************/
+	std::shared_ptr<std::mutex> m_spConditionVariableMutex;
+
+	/**************************************************************************************************//**
+	* @brief		Condition variable predicate.
+	* @details	Tokens of attached workers (see @ref AttachWorker), workers consume them.
+	******************************************************************************************************/
+	std::shared_ptr<uint64_t> m_spConditionVariablePredicate;
+
+	/**************************************************************************************************//**
+	* @brief		Available tokens.
+	* @details	Tokens of waiters, each waiter consumes one.
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_tokens;
+
+	/**************************************************************************************************//**
+	* @brief		Waiters count.
+	* @details	Number of threads sleeping in @ref WaitForNotification.
+	******************************************************************************************************/
+	std::atomic<uint32_t> m_waiters;
+
+	/**************************************************************************************************//**
+	* @brief		External waiters count.
+	* @details	Number of attached workers (see @ref AttachWorker and @ref DetachWorker).
+	******************************************************************************************************/
+	std::atomic<uint32_t> m_externalWaiters;
+};
+
+
+#endif // !MARSTECH_NOTIFIER_H
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,239 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Pipeline Implementation
+* @details		Contains implementation of @ref MsvPipeline.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvPipeline.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvPipeline::MsvPipeline():
+	m_running(false)
+{
+
+}
+
+
+MsvPipeline::~MsvPipeline()
+{
+	Stop();
+}
+
+
+/********************************************************************************************************************************
+*															IMsvPipeline public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvPipeline::AddStage(const char* stageName, std::function<bool(std::shared_ptr<void>& spItem)> stageFunction, uint16_t parallelism, size_t bufferSize, MsvPipelineOverflow overflow)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!stageFunction || parallelism == 0 || bufferSize == 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (m_running)
+	{
+		return MSV_STILL_RUNNING_ERROR;
+	}
+
+	std::shared_ptr<MsvPipelineStage> spStage(new (std::nothrow) MsvPipelineStage(stageName, stageFunction, parallelism, bufferSize, overflow));
+	if (!spStage)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	m_stages.push_back(spStage);
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvPipeline::Start()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (m_stages.empty())
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	if (m_running)
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	m_startTime = std::chrono::steady_clock::now();
+
+	for (size_t stageIndex = 0; stageIndex < m_stages.size(); ++stageIndex)
+	{
+		std::shared_ptr<MsvPipelineStage>& spStage = m_stages[stageIndex];
+
+		spStage->m_buffer.Open();
+		spStage->m_processed = 0;
+		spStage->m_busyTime = 0;
+		spStage->m_activeThreads = spStage->m_parallelism;
+
+		for (uint16_t i = 0; i < spStage->m_parallelism; ++i)
+		{
+			spStage->m_threads.emplace_back(&MsvPipeline::StageThread, this, stageIndex);
+		}
+	}
+
+	m_running = true;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvPipeline::Stop()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (!m_running)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	m_running = false;
+
+	//close the first buffer -> each stage closes buffer of next stage when it is drained
+	m_stages.front()->m_buffer.Close();
+
+	for (std::shared_ptr<MsvPipelineStage>& spStage: m_stages)
+	{
+		for (std::thread& thread: spStage->m_threads)
+		{
+			thread.join();
+		}
+
+		spStage->m_threads.clear();
+	}
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvPipeline::Push(std::shared_ptr<void> spItem)
+{
+	if (!spItem)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	if (!m_running)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	if (!m_stages.front()->m_buffer.Push(spItem))
+	{
+		//pipeline has been stopped while waiting for free space
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	return MSV_SUCCESS;
+}
+
+bool MsvPipeline::IsRunning() const
+{
+	return m_running;
+}
+
+MsvErrorCode MsvPipeline::GetStageStats(std::vector<MsvPipelineStageStats>& stats) const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_startTime).count());
+
+	stats.clear();
+	stats.reserve(m_stages.size());
+
+	for (const std::shared_ptr<MsvPipelineStage>& spStage: m_stages)
+	{
+		MsvPipelineStageStats stageStats;
+		stageStats.name = spStage->m_name;
+		stageStats.parallelism = spStage->m_parallelism;
+		stageStats.capacity = spStage->m_buffer.GetCapacity();
+		stageStats.occupancy = spStage->m_buffer.GetOccupancy();
+		stageStats.processed = spStage->m_processed;
+		stageStats.dropped = spStage->m_buffer.GetDropped();
+		stageStats.throughput = elapsed ? stageStats.processed * 1000000 / elapsed : 0;
+		stageStats.busyTime = spStage->m_busyTime;
+		stageStats.blockedTime = spStage->m_buffer.GetBlockedTime();
+
+		stats.push_back(stageStats);
+	}
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvPipeline protected methods
+********************************************************************************************************************************/
+
+
+void MsvPipeline::StageThread(size_t stageIndex)
+{
+	std::shared_ptr<MsvPipelineStage> spStage = m_stages[stageIndex];
+	std::shared_ptr<MsvPipelineStage> spNextStage = stageIndex + 1 < m_stages.size() ? m_stages[stageIndex + 1] : nullptr;
+
+	std::shared_ptr<void> spItem;
+	while (spStage->m_buffer.Pop(spItem))
+	{
+		std::chrono::steady_clock::time_point taskStart = std::chrono::steady_clock::now();
+		bool passItem = spStage->m_stageFunction(spItem);
+		spStage->m_busyTime.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - taskStart).count()), std::memory_order_relaxed);
+		spStage->m_processed.fetch_add(1, std::memory_order_relaxed);
+
+		if (passItem && spNextStage && spItem)
+		{
+			//blocks when next stage is full (backpressure)
+			spNextStage->m_buffer.Push(spItem);
+		}
+
+		spItem.reset();
+	}
+
+	//the last thread of stage closes next stage -> next stage drains its buffer and stops
+	if (spStage->m_activeThreads.fetch_sub(1) == 1 && spNextStage)
+	{
+		spNextStage->m_buffer.Close();
+	}
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,174 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Pipeline Implementation
+* @details		Contains implementation @ref MsvPipeline of @ref IMsvPipeline interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_PIPELINE_H
+#define MARSTECH_PIPELINE_H
+
+
+#include "IMsvPipeline.h"
+#include "MsvPipelineBuffer.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+#include <thread>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Pipeline Stage.
+* @details	Stage data used by @ref MsvPipeline.
+******************************************************************************************************/
+struct MsvPipelineStage
+{
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	stageName			Stage name.
+	* @param[in]	stageFunction		Stage function.
+	* @param[in]	parallelism			Number of stage threads.
+	* @param[in]	bufferSize			Input buffer capacity.
+	* @param[in]	overflow				Input buffer overflow policy.
+	******************************************************************************************************/
+	MsvPipelineStage(const char* stageName, std::function<bool(std::shared_ptr<void>& spItem)> stageFunction, uint16_t parallelism, size_t bufferSize, MsvPipelineOverflow overflow):
+		m_name(stageName ? stageName : ""),
+		m_stageFunction(stageFunction),
+		m_parallelism(parallelism),
+		m_buffer(bufferSize, overflow),
+		m_activeThreads(0),
+		m_processed(0),
+		m_busyTime(0)
+	{
+
+	}
+
+	std::string m_name;															///< Stage name.
+	std::function<bool(std::shared_ptr<void>& spItem)> m_stageFunction;	///< Stage function.
+	uint16_t m_parallelism;														///< Number of stage threads.
+	MsvPipelineBuffer m_buffer;												///< Stage input buffer.
+	std::vector<std::thread> m_threads;										///< Stage threads.
+	std::atomic<uint16_t> m_activeThreads;									///< Number of running stage threads.
+	std::atomic<uint64_t> m_processed;										///< Number of processed items.
+	std::atomic<uint64_t> m_busyTime;										///< Time spent in stage function (microseconds).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Pipeline Implementation.
+* @details	Implementation of pipeline interface. Each stage has its own threads and bounded input buffer.
+*				The last thread of stage closes input buffer of next stage, so stop drains whole pipeline.
+* @see		IMsvPipeline
+******************************************************************************************************/
+class MsvPipeline:
+	public IMsvPipeline
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Constructor.
+	******************************************************************************************************/
+	MsvPipeline();
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvPipeline();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvPipeline::AddStage(const char* stageName, std::function<bool(std::shared_ptr<void>& spItem)> stageFunction, uint16_t parallelism, size_t bufferSize, MsvPipelineOverflow overflow)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddStage(const char* stageName, std::function<bool(std::shared_ptr<void>& spItem)> stageFunction, uint16_t parallelism = 1, size_t bufferSize = 1024, MsvPipelineOverflow overflow = MsvPipelineOverflow::MSV_PIPELINE_BLOCK) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvPipeline::Start()
+	******************************************************************************************************/
+	virtual MsvErrorCode Start() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvPipeline::Stop()
+	******************************************************************************************************/
+	virtual MsvErrorCode Stop() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvPipeline::Push(std::shared_ptr<void> spItem)
+	******************************************************************************************************/
+	virtual MsvErrorCode Push(std::shared_ptr<void> spItem) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvPipeline::IsRunning() const
+	******************************************************************************************************/
+	virtual bool IsRunning() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvPipeline::GetStageStats(std::vector<MsvPipelineStageStats>& stats) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetStageStats(std::vector<MsvPipelineStageStats>& stats) const override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Stage thread entry point.
+	* @details		Pops items from stage input buffer, executes stage function and pushes items to input
+	*					buffer of next stage until input buffer is closed and empty.
+	* @param[in]	stageIndex			Index of stage in @ref m_stages.
+	******************************************************************************************************/
+	void StageThread(size_t stageIndex);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	mutable std::recursive_mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Stages.
+	* @details	Pipeline stages in processing order.
+	******************************************************************************************************/
+	std::vector<std::shared_ptr<MsvPipelineStage>> m_stages;
+
+	/**************************************************************************************************//**
+	* @brief		Running flag.
+	* @details	True when pipeline is running.
+	******************************************************************************************************/
+	std::atomic<bool> m_running;
+
+	/**************************************************************************************************//**
+	* @brief		Start time.
+	* @details	Time of the last start (used to compute throughput).
+	******************************************************************************************************/
+	std::chrono::steady_clock::time_point m_startTime;
+};
+
+
+#endif // !MARSTECH_PIPELINE_H
+
+/** @} */	//End of group MSYS.
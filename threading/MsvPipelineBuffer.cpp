@@ -0,0 +1,166 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Pipeline Buffer
+* @details		Contains implementation of @ref MsvPipelineBuffer.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvPipelineBuffer.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvPipelineBuffer::MsvPipelineBuffer(size_t capacity, MsvPipelineOverflow overflow):
+	m_items(capacity),
+	m_head(0),
+	m_count(0),
+	m_closed(false),
+	m_overflow(overflow),
+	m_dropped(0),
+	m_blockedTime(0)
+{
+
+}
+
+
+MsvPipelineBuffer::~MsvPipelineBuffer()
+{
+	Close();
+}
+
+
+/********************************************************************************************************************************
+*															MsvPipelineBuffer public methods
+********************************************************************************************************************************/
+
+
+bool MsvPipelineBuffer::Push(std::shared_ptr<void> spItem)
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	if (m_count == m_items.size() && !m_closed)
+	{
+		if (m_overflow == MsvPipelineOverflow::MSV_PIPELINE_SHED)
+		{
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		std::chrono::steady_clock::time_point blockStart = std::chrono::steady_clock::now();
+		m_notFull.wait(lock, [this] { return m_count < m_items.size() || m_closed; });
+		m_blockedTime.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - blockStart).count()), std::memory_order_relaxed);
+	}
+
+	if (m_closed)
+	{
+		return false;
+	}
+
+	m_items[(m_head + m_count) % m_items.size()] = std::move(spItem);
+	++m_count;
+
+	lock.unlock();
+	m_notEmpty.notify_one();
+
+	return true;
+}
+
+bool MsvPipelineBuffer::Pop(std::shared_ptr<void>& spItem)
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	m_notEmpty.wait(lock, [this] { return m_count != 0 || m_closed; });
+
+	if (m_count == 0)
+	{
+		//closed and empty
+		return false;
+	}
+
+	spItem = std::move(m_items[m_head]);
+	m_head = (m_head + 1) % m_items.size();
+	--m_count;
+
+	lock.unlock();
+	m_notFull.notify_one();
+
+	return true;
+}
+
+void MsvPipelineBuffer::Open()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	m_closed = false;
+}
+
+void MsvPipelineBuffer::Close()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		m_closed = true;
+	}
+
+	m_notEmpty.notify_all();
+	m_notFull.notify_all();
+}
+
+size_t MsvPipelineBuffer::GetCapacity() const
+{
+	return m_items.size();
+}
+
+size_t MsvPipelineBuffer::GetOccupancy() const
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	return m_count;
+}
+
+uint64_t MsvPipelineBuffer::GetDropped() const
+{
+	return m_dropped.load(std::memory_order_relaxed);
+}
+
+uint64_t MsvPipelineBuffer::GetBlockedTime() const
+{
+	return m_blockedTime.load(std::memory_order_relaxed);
+}
+
+/** @} */	//End of group MSYS.
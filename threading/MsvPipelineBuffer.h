@@ -0,0 +1,196 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Pipeline Buffer
+* @details		Contains definition of @ref MsvPipelineBuffer.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_PIPELINEBUFFER_H
+#define MARSTECH_PIPELINEBUFFER_H
+
+
+#include "IMsvPipeline.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Pipeline Buffer.
+* @details	Bounded buffer (ring of fixed capacity) which connects pipeline stages. Full buffer blocks
+*				producers or sheds items by overflow policy.
+* @see		MsvPipeline
+* @see		MsvPipelineOverflow
+******************************************************************************************************/
+class MsvPipelineBuffer
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	capacity			Buffer capacity (number of items).
+	* @param[in]	overflow			Policy when buffer is full.
+	******************************************************************************************************/
+	MsvPipelineBuffer(size_t capacity, MsvPipelineOverflow overflow);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvPipelineBuffer();
+
+	/**************************************************************************************************//**
+	* @brief			Push item.
+	* @details		Pushes item to the buffer. Waits for free space or drops the item when buffer is full
+	*					(depends on overflow policy).
+	* @param[in]	spItem			Item to push.
+	* @returns		bool
+	* @retval		true				When item has been pushed or shed by overflow policy.
+	* @retval		false				When buffer is closed.
+	******************************************************************************************************/
+	bool Push(std::shared_ptr<void> spItem);
+
+	/**************************************************************************************************//**
+	* @brief			Pop item.
+	* @details		Pops the oldest item. Waits for item when buffer is empty.
+	* @param[out]	spItem			Popped item.
+	* @returns		bool
+	* @retval		true				When item has been popped.
+	* @retval		false				When buffer is closed and empty.
+	******************************************************************************************************/
+	bool Pop(std::shared_ptr<void>& spItem);
+
+	/**************************************************************************************************//**
+	* @brief			Open buffer.
+	* @details		Opens buffer for pushing new items (buffer is open after construction).
+	******************************************************************************************************/
+	void Open();
+
+	/**************************************************************************************************//**
+	* @brief			Close buffer.
+	* @details		Rejects new items and wakes all waiters. Already buffered items can be still popped.
+	******************************************************************************************************/
+	void Close();
+
+	/**************************************************************************************************//**
+	* @brief			Get capacity.
+	* @returns		size_t
+	******************************************************************************************************/
+	size_t GetCapacity() const;
+
+	/**************************************************************************************************//**
+	* @brief			Get occupancy.
+	* @details		Returns number of buffered items.
+	* @returns		size_t
+	******************************************************************************************************/
+	size_t GetOccupancy() const;
+
+	/**************************************************************************************************//**
+	* @brief			Get dropped items count.
+	* @details		Returns number of items shed by overflow policy.
+	* @returns		uint64_t
+	******************************************************************************************************/
+	uint64_t GetDropped() const;
+
+	/**************************************************************************************************//**
+	* @brief			Get blocked time.
+	* @details		Returns time producers waited for free space (microseconds).
+	* @returns		uint64_t
+	******************************************************************************************************/
+	uint64_t GetBlockedTime() const;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	mutable std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Not empty condition.
+	* @details	Notified when item is pushed.
+	******************************************************************************************************/
+	std::condition_variable m_notEmpty;
+
+	/**************************************************************************************************//**
+	* @brief		Not full condition.
+	* @details	Notified when item is popped.
+	******************************************************************************************************/
+	std::condition_variable m_notFull;
+
+	/**************************************************************************************************//**
+	* @brief		Items.
+	* @details	Ring of buffered items (it is allocated once by constructor).
+	******************************************************************************************************/
+	std::vector<std::shared_ptr<void>> m_items;
+
+	/**************************************************************************************************//**
+	* @brief		Head.
+	* @details	Index of the oldest item in @ref m_items.
+	******************************************************************************************************/
+	size_t m_head;
+
+	/**************************************************************************************************//**
+	* @brief		Count.
+	* @details	Number of buffered items.
+	******************************************************************************************************/
+	size_t m_count;
+
+	/**************************************************************************************************//**
+	* @brief		Closed flag.
+	* @details	True when buffer rejects new items.
+	******************************************************************************************************/
+	bool m_closed;
+
+	/**************************************************************************************************//**
+	* @brief		Overflow policy.
+	* @details	Policy used when buffer is full.
+	******************************************************************************************************/
+	MsvPipelineOverflow m_overflow;
+
+	/**************************************************************************************************//**
+	* @brief		Dropped items count.
+	* @details	Number of items shed by overflow policy.
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_dropped;
+
+	/**************************************************************************************************//**
+	* @brief		Blocked time.
+	* @details	Time producers waited for free space (microseconds).
+	******************************************************************************************************/
+	std::atomic<uint64_t> m_blockedTime;
+};
+
+
+#endif // !MARSTECH_PIPELINEBUFFER_H
+
+/** @} */	//End of group MSYS.
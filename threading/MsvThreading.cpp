@@ -32,6 +32,11 @@ along with Foobar. If not, see <https://www.gnu.org/licenses/>.
 
 
 #include "MsvThreading.h"
+#include "MsvFiberScheduler.h"
+#include "MsvNotifier.h"
+#include "MsvPipeline.h"
+#include "MsvVirtualScheduler.h"
+#include "MsvVirtualThreading.h"
 
 #include "mthreading/MsvEvent.h"
 #include "mthreading/MsvThreadPool.h"
@@ -81,6 +86,83 @@ MsvErrorCode MsvThreading::GetEvent(std::shared_ptr<IMsvEvent>& spEvent) const
 	return MSV_SUCCESS;
 }
 
+MsvErrorCode MsvThreading::GetFiberScheduler(std::shared_ptr<IMsvFiberScheduler>& spFiberScheduler) const
+{
+	std::shared_ptr<IMsvFiberScheduler> spTempFiberScheduler(new (std::nothrow) MsvFiberScheduler());
+
+	if (!spTempFiberScheduler)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spFiberScheduler = spTempFiberScheduler;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvThreading::GetNotifier(std::shared_ptr<IMsvNotifier>& spNotifier) const
+{
+	std::shared_ptr<MsvNotifier> spTempNotifier(new (std::nothrow) MsvNotifier());
+
+	if (!spTempNotifier)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	MSV_RETURN_FAILED(spTempNotifier->Initialize());
+
+	spNotifier = spTempNotifier;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvThreading::GetPipeline(std::shared_ptr<IMsvPipeline>& spPipeline) const
+{
+	std::shared_ptr<IMsvPipeline> spTempPipeline(new (std::nothrow) MsvPipeline());
+
+	if (!spTempPipeline)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spPipeline = spTempPipeline;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvThreading::GetVirtualScheduler(std::shared_ptr<IMsvVirtualScheduler>& spVirtualScheduler, uint64_t seed) const
+{
+	std::shared_ptr<IMsvVirtualScheduler> spTempVirtualScheduler(new (std::nothrow) MsvVirtualScheduler(seed));
+
+	if (!spTempVirtualScheduler)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spVirtualScheduler = spTempVirtualScheduler;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvThreading::GetVirtualThreading(std::shared_ptr<IMsvThreading>& spVirtualThreading, std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler) const
+{
+	if (!spVirtualScheduler)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::shared_ptr<IMsvThreading> spTempVirtualThreading(new (std::nothrow) MsvVirtualThreading(spVirtualScheduler));
+
+	if (!spTempVirtualThreading)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spVirtualThreading = spTempVirtualThreading;
+
+	return MSV_SUCCESS;
+}
+
 MsvErrorCode MsvThreading::GetSharedThreadPool(std::shared_ptr<IMsvThreadPool>& spThreadPool) const
 {
 	std::lock_guard<std::recursive_mutex> lock(m_lock);
@@ -124,6 +206,31 @@ MsvErrorCode MsvThreading::GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& sp
 	return MSV_SUCCESS;
 }
 
+MsvErrorCode MsvThreading::GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<IMsvNotifier> spNotifier) const
+{
+	if (!spNotifier)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::shared_ptr<std::condition_variable> spConditionVariable;
+	std::shared_ptr<std::mutex> spConditionVariableMutex;
+	std::shared_ptr<uint64_t> spConditionVariablePredicate;
+	MSV_RETURN_FAILED(spNotifier->AttachWorker(spConditionVariable, spConditionVariableMutex, spConditionVariablePredicate));
+
+	//worker is detached when it is destroyed (or when it could not be allocated)
+	std::shared_ptr<IMsvUniqueWorker> spTempUniqueWorker(new (std::nothrow) MsvUniqueWorker(spConditionVariable, spConditionVariableMutex, spConditionVariablePredicate), [spNotifier](IMsvUniqueWorker* pUniqueWorker) { delete pUniqueWorker; spNotifier->DetachWorker(); });
+
+	if (!spTempUniqueWorker)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spUniqueWorker = spTempUniqueWorker;
+
+	return MSV_SUCCESS;
+}
+
 MsvErrorCode MsvThreading::GetWorker(std::shared_ptr<IMsvWorker>& spWorker, std::shared_ptr<std::condition_variable> spConditionVariable, std::shared_ptr<std::mutex> spConditionVariableMutex, std::shared_ptr<uint64_t> spConditionVariablePredicate) const
 {
 	std::shared_ptr<IMsvWorker> spTempWorker(new (std::nothrow) MsvWorker(spConditionVariable, spConditionVariableMutex, spConditionVariablePredicate));
@@ -138,5 +245,30 @@ MsvErrorCode MsvThreading::GetWorker(std::shared_ptr<IMsvWorker>& spWorker, std:
 	return MSV_SUCCESS;
 }
 
+MsvErrorCode MsvThreading::GetWorker(std::shared_ptr<IMsvWorker>& spWorker, std::shared_ptr<IMsvNotifier> spNotifier) const
+{
+	if (!spNotifier)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::shared_ptr<std::condition_variable> spConditionVariable;
+	std::shared_ptr<std::mutex> spConditionVariableMutex;
+	std::shared_ptr<uint64_t> spConditionVariablePredicate;
+	MSV_RETURN_FAILED(spNotifier->AttachWorker(spConditionVariable, spConditionVariableMutex, spConditionVariablePredicate));
+
+	//worker is detached when it is destroyed (or when it could not be allocated)
+	std::shared_ptr<IMsvWorker> spTempWorker(new (std::nothrow) MsvWorker(spConditionVariable, spConditionVariableMutex, spConditionVariablePredicate), [spNotifier](IMsvWorker* pWorker) { delete pWorker; spNotifier->DetachWorker(); });
+
+	if (!spTempWorker)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spWorker = spTempWorker;
+
+	return MSV_SUCCESS;
+}
+
 
 /** @} */	//End of group MSYS.
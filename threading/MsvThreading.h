@@ -62,6 +62,31 @@ public:
 	******************************************************************************************************/
 	virtual MsvErrorCode GetEvent(std::shared_ptr<IMsvEvent>& spEvent) const override;
 
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreading::GetFiberScheduler(std::shared_ptr<IMsvFiberScheduler>& spFiberScheduler) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetFiberScheduler(std::shared_ptr<IMsvFiberScheduler>& spFiberScheduler) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreading::GetNotifier(std::shared_ptr<IMsvNotifier>& spNotifier) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetNotifier(std::shared_ptr<IMsvNotifier>& spNotifier) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreading::GetPipeline(std::shared_ptr<IMsvPipeline>& spPipeline) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetPipeline(std::shared_ptr<IMsvPipeline>& spPipeline) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreading::GetVirtualScheduler(std::shared_ptr<IMsvVirtualScheduler>& spVirtualScheduler, uint64_t seed) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetVirtualScheduler(std::shared_ptr<IMsvVirtualScheduler>& spVirtualScheduler, uint64_t seed = 0) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreading::GetVirtualThreading(std::shared_ptr<IMsvThreading>& spVirtualThreading, std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetVirtualThreading(std::shared_ptr<IMsvThreading>& spVirtualThreading, std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler) const override;
+
 	/**************************************************************************************************//**
 	* @copydoc IMsvThreading::GetSharedThreadPool(std::shared_ptr<IMsvThreadPool>& spThreadPool) const
 	******************************************************************************************************/
@@ -77,11 +102,21 @@ public:
 	******************************************************************************************************/
 	virtual MsvErrorCode GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<std::condition_variable> spConditionVariable = nullptr, std::shared_ptr<std::mutex> spConditionVariableMutex = nullptr, std::shared_ptr<uint64_t> spConditionVariablePredicate = nullptr) const override;
 
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreading::GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<IMsvNotifier> spNotifier) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<IMsvNotifier> spNotifier) const override;
+
 	/**************************************************************************************************//**
 	* @copydoc IMsvThreading::GetWorker(std::shared_ptr<IMsvWorker>& spWorker, std::shared_ptr<std::condition_variable> spConditionVariable = nullptr, std::shared_ptr<std::mutex> spConditionVariableMutex = nullptr, std::shared_ptr<uint64_t> spConditionVariablePredicate = nullptr) const
 	******************************************************************************************************/
 	virtual MsvErrorCode GetWorker(std::shared_ptr<IMsvWorker>& spWorker, std::shared_ptr<std::condition_variable> spConditionVariable = nullptr, std::shared_ptr<std::mutex> spConditionVariableMutex = nullptr, std::shared_ptr<uint64_t> spConditionVariablePredicate = nullptr) const override;
 
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreading::GetWorker(std::shared_ptr<IMsvWorker>& spWorker, std::shared_ptr<IMsvNotifier> spNotifier) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetWorker(std::shared_ptr<IMsvWorker>& spWorker, std::shared_ptr<IMsvNotifier> spNotifier) const override;
+
 protected:
 	/**************************************************************************************************//**
 	* @brief		Thread mutex.
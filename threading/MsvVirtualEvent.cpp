@@ -0,0 +1,189 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Virtual Event Implementation
+* @details		Contains implementation of @ref MsvVirtualEvent.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvVirtualEvent.h"
+#include "MsvVirtualScheduler.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvVirtualEvent::MsvVirtualEvent(std::shared_ptr<MsvVirtualScheduler> spScheduler):
+	m_spWeakScheduler(spScheduler),
+	m_set(false),
+	m_lastWaiterId(0)
+{
+
+}
+
+
+MsvVirtualEvent::~MsvVirtualEvent()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															IMsvVirtualEvent public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvVirtualEvent::SetEvent(bool notifyAll)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	if (m_waiters.empty())
+	{
+		m_set = true;
+		return MSV_SUCCESS;
+	}
+
+	std::shared_ptr<MsvVirtualScheduler> spScheduler = m_spWeakScheduler.lock();
+	if (!spScheduler)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	if (notifyAll)
+	{
+		for (const MsvVirtualEventWaiter& waiter: m_waiters)
+		{
+			WakeWaiter(spScheduler, waiter, true);
+		}
+
+		m_waiters.clear();
+		return MSV_SUCCESS;
+	}
+
+	//deterministic (seeded) choice of woken waiter
+	size_t waiterIndex = static_cast<size_t>(spScheduler->GetRandom() % m_waiters.size());
+	WakeWaiter(spScheduler, m_waiters[waiterIndex], true);
+	m_waiters.erase(m_waiters.begin() + static_cast<std::ptrdiff_t>(waiterIndex));
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvVirtualEvent::ResetEvent()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	m_set = false;
+
+	return MSV_SUCCESS;
+}
+
+bool MsvVirtualEvent::IsSet() const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	return m_set;
+}
+
+MsvErrorCode MsvVirtualEvent::WaitForEvent(std::function<void(void* pContext, bool signaled)> continuation, void* pContext, uint64_t timeout)
+{
+	if (!continuation)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::shared_ptr<MsvVirtualScheduler> spScheduler = m_spWeakScheduler.lock();
+	if (!spScheduler)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	MsvVirtualEventWaiter waiter{++m_lastWaiterId, continuation, pContext};
+
+	if (m_set)
+	{
+		//auto reset -> set event is consumed by this waiter
+		m_set = false;
+		WakeWaiter(spScheduler, waiter, true);
+		return MSV_SUCCESS;
+	}
+
+	m_waiters.push_back(waiter);
+
+	if (timeout != 0)
+	{
+		std::weak_ptr<MsvVirtualEvent> spWeakEvent = shared_from_this();
+		uint64_t waiterId = waiter.waiterId;
+		MSV_RETURN_FAILED(spScheduler->AddTask([spWeakEvent, waiterId](void*)
+		{
+			std::shared_ptr<MsvVirtualEvent> spEvent = spWeakEvent.lock();
+			if (spEvent)
+			{
+				spEvent->OnTimeout(waiterId);
+			}
+		}, nullptr, timeout));
+	}
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvVirtualEvent protected methods
+********************************************************************************************************************************/
+
+
+void MsvVirtualEvent::WakeWaiter(const std::shared_ptr<MsvVirtualScheduler>& spScheduler, const MsvVirtualEventWaiter& waiter, bool signaled)
+{
+	std::function<void(void* pContext, bool signaled)> continuation = waiter.continuation;
+	spScheduler->AddTask([continuation, signaled](void* pContext) { continuation(pContext, signaled); }, waiter.pContext);
+}
+
+void MsvVirtualEvent::OnTimeout(uint64_t waiterId)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	for (std::vector<MsvVirtualEventWaiter>::iterator waiter = m_waiters.begin(); waiter != m_waiters.end(); ++waiter)
+	{
+		if (waiter->waiterId == waiterId)
+		{
+			//timeout is executed by scheduler -> execute continuation directly (same virtual time)
+			MsvVirtualEventWaiter timedOutWaiter = *waiter;
+			m_waiters.erase(waiter);
+			timedOutWaiter.continuation(timedOutWaiter.pContext, false);
+			return;
+		}
+	}
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,157 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Virtual Event Implementation
+* @details		Contains implementation @ref MsvVirtualEvent of @ref IMsvVirtualEvent interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_VIRTUALEVENT_H
+#define MARSTECH_VIRTUALEVENT_H
+
+
+#include "IMsvVirtualScheduler.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <mutex>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+class MsvVirtualScheduler;
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Virtual Event Waiter.
+* @details	Registered waiter of @ref MsvVirtualEvent.
+******************************************************************************************************/
+struct MsvVirtualEventWaiter
+{
+	uint64_t waiterId;																		///< Waiter ID (used by timeout).
+	std::function<void(void* pContext, bool signaled)> continuation;			///< Waiter continuation.
+	void* pContext;																			///< Context passed to continuation.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Virtual Event Implementation.
+* @details	Implementation of virtual event interface. Continuations of woken waiters and timeouts are
+*				scheduled by @ref MsvVirtualScheduler.
+* @see		IMsvVirtualEvent
+******************************************************************************************************/
+class MsvVirtualEvent:
+	public IMsvVirtualEvent,
+	public std::enable_shared_from_this<MsvVirtualEvent>
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spScheduler			Scheduler which drives this event.
+	******************************************************************************************************/
+	MsvVirtualEvent(std::shared_ptr<MsvVirtualScheduler> spScheduler);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvVirtualEvent();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualEvent::SetEvent(bool notifyAll)
+	******************************************************************************************************/
+	virtual MsvErrorCode SetEvent(bool notifyAll = false) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualEvent::ResetEvent()
+	******************************************************************************************************/
+	virtual MsvErrorCode ResetEvent() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualEvent::IsSet() const
+	******************************************************************************************************/
+	virtual bool IsSet() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualEvent::WaitForEvent(std::function<void(void* pContext, bool signaled)> continuation, void* pContext, uint64_t timeout)
+	******************************************************************************************************/
+	virtual MsvErrorCode WaitForEvent(std::function<void(void* pContext, bool signaled)> continuation, void* pContext, uint64_t timeout = 0) override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Wake waiter.
+	* @details		Schedules continuation of waiter.
+	* @param[in]	spScheduler			Scheduler which executes continuation.
+	* @param[in]	waiter				Waiter to wake.
+	* @param[in]	signaled				True when event has been set, false when timeout elapsed.
+	******************************************************************************************************/
+	static void WakeWaiter(const std::shared_ptr<MsvVirtualScheduler>& spScheduler, const MsvVirtualEventWaiter& waiter, bool signaled);
+
+	/**************************************************************************************************//**
+	* @brief			Timeout handler.
+	* @details		Wakes waiter (as not signaled) when it still waits.
+	* @param[in]	waiterId				ID of timed out waiter.
+	******************************************************************************************************/
+	void OnTimeout(uint64_t waiterId);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	mutable std::recursive_mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Scheduler.
+	* @details	Scheduler which drives this event (event might outlive it).
+	******************************************************************************************************/
+	std::weak_ptr<MsvVirtualScheduler> m_spWeakScheduler;
+
+	/**************************************************************************************************//**
+	* @brief		Waiters.
+	* @details	Registered waiters (in registration order).
+	******************************************************************************************************/
+	std::vector<MsvVirtualEventWaiter> m_waiters;
+
+	/**************************************************************************************************//**
+	* @brief		Set flag.
+	* @details	True when event has been set and there was no waiter.
+	******************************************************************************************************/
+	bool m_set;
+
+	/**************************************************************************************************//**
+	* @brief		Last waiter ID.
+	* @details	IDs of waiters are incremented.
+	******************************************************************************************************/
+	uint64_t m_lastWaiterId;
+};
+
+
+#endif // !MARSTECH_VIRTUALEVENT_H
+
+/** @} */	//End of group MSYS.
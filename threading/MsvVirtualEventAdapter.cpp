@@ -0,0 +1,133 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Virtual Event Adapter
+* @details		Contains implementation of @ref MsvVirtualEventAdapter.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvVirtualEventAdapter.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvVirtualEventAdapter::MsvVirtualEventAdapter(std::shared_ptr<IMsvVirtualScheduler> spScheduler):
+	m_spWeakScheduler(spScheduler),
+	m_set(false),
+	m_waiters(0),
+	m_broadcasts(0)
+{
+
+}
+
+
+MsvVirtualEventAdapter::~MsvVirtualEventAdapter()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															IMsvEvent public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvVirtualEventAdapter::SetEvent(bool notifyAll)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (notifyAll && m_waiters != 0)
+	{
+		++m_broadcasts;
+		return MSV_SUCCESS;
+	}
+
+	m_set = true;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvVirtualEventAdapter::ResetEvent()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	m_set = false;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvVirtualEventAdapter::WaitForEvent()
+{
+	std::shared_ptr<IMsvVirtualScheduler> spScheduler = m_spWeakScheduler.lock();
+	if (!spScheduler)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	uint64_t broadcasts;
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (m_set)
+		{
+			m_set = false;
+			return MSV_SUCCESS;
+		}
+
+		broadcasts = m_broadcasts;
+		++m_waiters;
+	}
+
+	//waiting is running of scheduled tasks -> virtual time moves to task which sets event
+	while (true)
+	{
+		bool executed = spScheduler->RunNextTask();
+
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (m_broadcasts != broadcasts || m_set)
+		{
+			m_set = m_broadcasts != broadcasts ? m_set : false;
+			--m_waiters;
+			return MSV_SUCCESS;
+		}
+
+		if (!executed)
+		{
+			--m_waiters;
+			return MSV_NOT_FOUND_ERROR;
+		}
+	}
+}
+
+/** @} */	//End of group MSYS.
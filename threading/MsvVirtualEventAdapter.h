@@ -0,0 +1,134 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Virtual Event Adapter
+* @details		Contains implementation @ref MsvVirtualEventAdapter of @ref IMsvEvent interface driven by virtual time.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_VIRTUALEVENTADAPTER_H
+#define MARSTECH_VIRTUALEVENTADAPTER_H
+
+
+#include "mthreading/IMsvEvent.h"
+
+#include "IMsvVirtualScheduler.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <memory>
+#include <mutex>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Virtual Event Adapter.
+* @details	Implementation of @ref IMsvEvent driven by virtual time of @ref IMsvVirtualScheduler. Blocking
+*				wait does not sleep - it executes scheduled tasks (and moves virtual time) until event is set,
+*				so existing users of @ref IMsvEvent run in virtual time without changes.
+* @note		It must be used by thread which runs scheduler (wait is nested run of scheduler).
+* @see		IMsvEvent
+* @see		IMsvThreading::GetVirtualThreading
+******************************************************************************************************/
+class MsvVirtualEventAdapter:
+	public IMsvEvent
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spScheduler			Scheduler which drives this event.
+	******************************************************************************************************/
+	MsvVirtualEventAdapter(std::shared_ptr<IMsvVirtualScheduler> spScheduler);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvVirtualEventAdapter();
+
+	/**************************************************************************************************//**
+	* @brief			Set event.
+	* @details		Wakes one waiter (or all waiters when notifyAll is true). Event stays set when there
+	*					is no waiter.
+	* @param[in]	notifyAll						True to wake all waiters, false to wake one waiter.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode SetEvent(bool notifyAll = false) override;
+
+	/**************************************************************************************************//**
+	* @brief			Reset event.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode ResetEvent() override;
+
+	/**************************************************************************************************//**
+	* @brief			Wait for event.
+	* @details		Executes scheduled tasks until event is set (set event is consumed - auto reset).
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When scheduler has been destroyed.
+	* @retval		MSV_NOT_FOUND_ERROR			When there is no scheduled task which could set event (wait
+	*														would never end).
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode WaitForEvent() override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Scheduler.
+	* @details	Scheduler which drives this event (event might outlive it).
+	******************************************************************************************************/
+	std::weak_ptr<IMsvVirtualScheduler> m_spWeakScheduler;
+
+	/**************************************************************************************************//**
+	* @brief		Set flag.
+	* @details	True when event has been set and it has not been consumed by waiter.
+	******************************************************************************************************/
+	bool m_set;
+
+	/**************************************************************************************************//**
+	* @brief		Waiters count.
+	* @details	Number of (nested) waiters.
+	******************************************************************************************************/
+	uint32_t m_waiters;
+
+	/**************************************************************************************************//**
+	* @brief		Broadcasts count.
+	* @details	Incremented by each set which wakes all waiters.
+	******************************************************************************************************/
+	uint64_t m_broadcasts;
+};
+
+
+#endif // !MARSTECH_VIRTUALEVENTADAPTER_H
+
+/** @} */	//End of group MSYS.
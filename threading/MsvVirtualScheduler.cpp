@@ -0,0 +1,246 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Virtual Scheduler Implementation
+* @details		Contains implementation of @ref MsvVirtualScheduler.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvVirtualScheduler.h"
+#include "MsvVirtualEvent.h"
+
+#include "merror/MsvErrorCodes.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <limits>
+
+MSV_ENABLE_WARNINGS
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvVirtualScheduler::MsvVirtualScheduler(uint64_t seed):
+	m_random(seed),
+	m_seed(seed),
+	m_time(0),
+	m_sequence(0),
+	m_lastPeriodicTaskId(0),
+	m_oneShotTasks(0)
+{
+
+}
+
+
+MsvVirtualScheduler::~MsvVirtualScheduler()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															IMsvVirtualScheduler public methods
+********************************************************************************************************************************/
+
+
+uint64_t MsvVirtualScheduler::GetTime() const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	return m_time;
+}
+
+uint64_t MsvVirtualScheduler::GetSeed() const
+{
+	return m_seed;
+}
+
+MsvErrorCode MsvVirtualScheduler::AddTask(std::function<void(void*)> task, void* pContext, uint64_t delay)
+{
+	if (!task)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	m_tasks.push(MsvVirtualTask{m_time + delay, m_random(), m_sequence++, 0, task, pContext});
+	++m_oneShotTasks;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvVirtualScheduler::AddPeriodicTask(uint64_t& taskId, std::function<void(void*)> task, void* pContext, uint64_t period)
+{
+	if (!task || period == 0)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	taskId = ++m_lastPeriodicTaskId;
+	m_periodicTasks[taskId] = period;
+	m_tasks.push(MsvVirtualTask{m_time + period, m_random(), m_sequence++, taskId, task, pContext});
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvVirtualScheduler::RemovePeriodicTask(uint64_t taskId)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	//scheduled task will be dropped when it is popped
+	if (m_periodicTasks.erase(taskId) == 0)
+	{
+		return MSV_NOT_FOUND_ERROR;
+	}
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvVirtualScheduler::GetEvent(std::shared_ptr<IMsvVirtualEvent>& spEvent)
+{
+	std::shared_ptr<IMsvVirtualEvent> spTempEvent(new (std::nothrow) MsvVirtualEvent(shared_from_this()));
+
+	if (!spTempEvent)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spEvent = spTempEvent;
+
+	return MSV_SUCCESS;
+}
+
+uint64_t MsvVirtualScheduler::RunFor(uint64_t duration)
+{
+	uint64_t timeLimit = GetTime() + duration;
+	uint64_t executedTasks = 0;
+
+	while (RunNextTask(timeLimit, false))
+	{
+		++executedTasks;
+	}
+
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	m_time = timeLimit;
+
+	return executedTasks;
+}
+
+uint64_t MsvVirtualScheduler::RunUntilIdle()
+{
+	uint64_t executedTasks = 0;
+
+	while (RunNextTask(std::numeric_limits<uint64_t>::max(), true))
+	{
+		++executedTasks;
+	}
+
+	return executedTasks;
+}
+
+bool MsvVirtualScheduler::RunNextTask()
+{
+	return RunNextTask(std::numeric_limits<uint64_t>::max(), false);
+}
+
+size_t MsvVirtualScheduler::GetPendingTasksCount() const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	return m_tasks.size();
+}
+
+
+/********************************************************************************************************************************
+*															MsvVirtualScheduler public methods
+********************************************************************************************************************************/
+
+
+uint64_t MsvVirtualScheduler::GetRandom()
+{
+	std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+	return m_random();
+}
+
+
+/********************************************************************************************************************************
+*															MsvVirtualScheduler protected methods
+********************************************************************************************************************************/
+
+
+bool MsvVirtualScheduler::RunNextTask(uint64_t timeLimit, bool oneShotOnly)
+{
+	MsvVirtualTask task;
+
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_lock);
+
+		while (true)
+		{
+			if (m_tasks.empty() || m_tasks.top().time > timeLimit || (oneShotOnly && m_oneShotTasks == 0))
+			{
+				return false;
+			}
+
+			task = m_tasks.top();
+			m_tasks.pop();
+
+			if (task.periodicTaskId == 0)
+			{
+				--m_oneShotTasks;
+				break;
+			}
+
+			std::map<uint64_t, uint64_t>::iterator periodicTask = m_periodicTasks.find(task.periodicTaskId);
+			if (periodicTask != m_periodicTasks.end())
+			{
+				//schedule next period before execution -> task might remove itself
+				m_tasks.push(MsvVirtualTask{task.time + periodicTask->second, m_random(), m_sequence++, task.periodicTaskId, task.task, task.pContext});
+				break;
+			}
+
+			//removed periodic task -> drop it
+		}
+
+		m_time = task.time;
+	}
+
+	task.task(task.pContext);
+
+	return true;
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,249 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Virtual Scheduler Implementation
+* @details		Contains implementation @ref MsvVirtualScheduler of @ref IMsvVirtualScheduler interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_VIRTUALSCHEDULER_H
+#define MARSTECH_VIRTUALSCHEDULER_H
+
+
+#include "IMsvVirtualScheduler.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <map>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <vector>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Virtual Task.
+* @details	Scheduled task of @ref MsvVirtualScheduler.
+******************************************************************************************************/
+struct MsvVirtualTask
+{
+	uint64_t time;									///< Virtual time when task will be executed.
+	uint64_t order;								///< Seeded random order of tasks with the same time.
+	uint64_t sequence;							///< Scheduling sequence (order of tasks with the same time and random order).
+	uint64_t periodicTaskId;					///< ID of periodic task (0 for one shot tasks).
+	std::function<void(void*)> task;			///< Task to execute.
+	void* pContext;								///< Context passed to task.
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Virtual Task Comparator.
+* @details	Orders tasks in priority queue (the earliest task is on top).
+******************************************************************************************************/
+struct MsvVirtualTaskLater
+{
+	/**************************************************************************************************//**
+	* @brief			Compare tasks.
+	* @param[in]	first				First task.
+	* @param[in]	second			Second task.
+	* @returns		bool
+	* @retval		true				When first task is executed after second task.
+	* @retval		false				When first task is executed before second task.
+	******************************************************************************************************/
+	bool operator()(const MsvVirtualTask& first, const MsvVirtualTask& second) const
+	{
+		if (first.time != second.time)
+		{
+			return first.time > second.time;
+		}
+
+		if (first.order != second.order)
+		{
+			return first.order > second.order;
+		}
+
+		return first.sequence > second.sequence;
+	}
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Virtual Scheduler Implementation.
+* @details	Implementation of virtual scheduler interface. Tasks are stored in priority queue ordered by
+*				virtual time and seeded random order.
+* @note		It must be owned by shared pointer (events keep weak pointer to it).
+* @see		IMsvVirtualScheduler
+******************************************************************************************************/
+class MsvVirtualScheduler:
+	public IMsvVirtualScheduler,
+	public std::enable_shared_from_this<MsvVirtualScheduler>
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	seed				Seed of random generator which orders tasks with the same virtual time.
+	******************************************************************************************************/
+	MsvVirtualScheduler(uint64_t seed = 0);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvVirtualScheduler();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualScheduler::GetTime() const
+	******************************************************************************************************/
+	virtual uint64_t GetTime() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualScheduler::GetSeed() const
+	******************************************************************************************************/
+	virtual uint64_t GetSeed() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualScheduler::AddTask(std::function<void(void*)> task, void* pContext, uint64_t delay)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddTask(std::function<void(void*)> task, void* pContext, uint64_t delay = 0) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualScheduler::AddPeriodicTask(uint64_t& taskId, std::function<void(void*)> task, void* pContext, uint64_t period)
+	******************************************************************************************************/
+	virtual MsvErrorCode AddPeriodicTask(uint64_t& taskId, std::function<void(void*)> task, void* pContext, uint64_t period) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualScheduler::RemovePeriodicTask(uint64_t taskId)
+	******************************************************************************************************/
+	virtual MsvErrorCode RemovePeriodicTask(uint64_t taskId) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualScheduler::GetEvent(std::shared_ptr<IMsvVirtualEvent>& spEvent)
+	******************************************************************************************************/
+	virtual MsvErrorCode GetEvent(std::shared_ptr<IMsvVirtualEvent>& spEvent) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualScheduler::RunFor(uint64_t duration)
+	******************************************************************************************************/
+	virtual uint64_t RunFor(uint64_t duration) override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualScheduler::RunUntilIdle()
+	******************************************************************************************************/
+	virtual uint64_t RunUntilIdle() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualScheduler::RunNextTask()
+	******************************************************************************************************/
+	virtual bool RunNextTask() override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvVirtualScheduler::GetPendingTasksCount() const
+	******************************************************************************************************/
+	virtual size_t GetPendingTasksCount() const override;
+
+	/**************************************************************************************************//**
+	* @brief			Get random number.
+	* @details		Returns next number of seeded random generator (used by virtual events to choose waiter).
+	* @returns		uint64_t
+	******************************************************************************************************/
+	uint64_t GetRandom();
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Run next task.
+	* @details		Pops the earliest task when it should be executed before time limit, moves virtual time
+	*					and executes it.
+	* @param[in]	timeLimit			Virtual time limit.
+	* @param[in]	oneShotOnly			True to stop when there is no one shot task.
+	* @returns		bool
+	* @retval		true					When task has been executed.
+	* @retval		false					When there is no task to execute.
+	******************************************************************************************************/
+	bool RunNextTask(uint64_t timeLimit, bool oneShotOnly);
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access. Tasks are executed without lock.
+	******************************************************************************************************/
+	mutable std::recursive_mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Scheduled tasks.
+	* @details	The earliest task is on top.
+	******************************************************************************************************/
+	std::priority_queue<MsvVirtualTask, std::vector<MsvVirtualTask>, MsvVirtualTaskLater> m_tasks;
+
+	/**************************************************************************************************//**
+	* @brief		Periodic tasks.
+	* @details	Map of periodic task IDs and their periods.
+	******************************************************************************************************/
+	std::map<uint64_t, uint64_t> m_periodicTasks;
+
+	/**************************************************************************************************//**
+	* @brief		Random generator.
+	* @details	Seeded random generator which orders tasks with the same virtual time.
+	******************************************************************************************************/
+	std::mt19937_64 m_random;
+
+	/**************************************************************************************************//**
+	* @brief		Seed.
+	* @details	Seed of @ref m_random.
+	******************************************************************************************************/
+	uint64_t m_seed;
+
+	/**************************************************************************************************//**
+	* @brief		Virtual time.
+	* @details	Current virtual time in microseconds.
+	******************************************************************************************************/
+	uint64_t m_time;
+
+	/**************************************************************************************************//**
+	* @brief		Sequence.
+	* @details	Scheduling sequence of tasks.
+	******************************************************************************************************/
+	uint64_t m_sequence;
+
+	/**************************************************************************************************//**
+	* @brief		Last periodic task ID.
+	* @details	IDs of periodic tasks are incremented.
+	******************************************************************************************************/
+	uint64_t m_lastPeriodicTaskId;
+
+	/**************************************************************************************************//**
+	* @brief		One shot tasks count.
+	* @details	Number of scheduled one shot tasks (used by @ref RunUntilIdle).
+	******************************************************************************************************/
+	size_t m_oneShotTasks;
+};
+
+
+#endif // !MARSTECH_VIRTUALSCHEDULER_H
+
+/** @} */	//End of group MSYS.
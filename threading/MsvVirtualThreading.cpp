@@ -0,0 +1,102 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Virtual Threading Implementation
+* @details		Contains implementation of @ref MsvVirtualThreading.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvVirtualThreading.h"
+#include "MsvVirtualEventAdapter.h"
+#include "MsvVirtualUniqueWorker.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvVirtualThreading::MsvVirtualThreading(std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler):
+	m_spVirtualScheduler(spVirtualScheduler)
+{
+
+}
+
+
+MsvVirtualThreading::~MsvVirtualThreading()
+{
+
+}
+
+
+/********************************************************************************************************************************
+*															IMsvThreading public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvVirtualThreading::GetEvent(std::shared_ptr<IMsvEvent>& spEvent) const
+{
+	std::shared_ptr<IMsvEvent> spTempEvent(new (std::nothrow) MsvVirtualEventAdapter(m_spVirtualScheduler));
+
+	if (!spTempEvent)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spEvent = spTempEvent;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvVirtualThreading::GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<std::condition_variable>, std::shared_ptr<std::mutex>, std::shared_ptr<uint64_t>) const
+{
+	std::shared_ptr<IMsvUniqueWorker> spTempUniqueWorker(new (std::nothrow) MsvVirtualUniqueWorker(m_spVirtualScheduler));
+
+	if (!spTempUniqueWorker)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	spUniqueWorker = spTempUniqueWorker;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvVirtualThreading::GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<IMsvNotifier> spNotifier) const
+{
+	if (!spNotifier)
+	{
+		return MSV_INVALID_DATA_ERROR;
+	}
+
+	return GetUniqueWorker(spUniqueWorker, nullptr, nullptr, nullptr);
+}
+
+/** @} */	//End of group MSYS.
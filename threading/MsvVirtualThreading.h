@@ -0,0 +1,92 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Virtual Threading Implementation
+* @details		Contains implementation @ref MsvVirtualThreading of @ref IMsvThreading interface driven by virtual time.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_VIRTUALTHREADING_H
+#define MARSTECH_VIRTUALTHREADING_H
+
+
+#include "MsvThreading.h"
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Virtual Threading Implementation.
+* @details	Implementation of threading interface for tests of modules which depend on @ref IMsvEvent and
+*				@ref IMsvUniqueWorker. Events and unique workers are driven by virtual time of
+*				@ref IMsvVirtualScheduler (see @ref MsvVirtualEventAdapter and @ref MsvVirtualUniqueWorker),
+*				other interfaces are real ones (see @ref MsvThreading).
+* @see		IMsvThreading::GetVirtualThreading
+******************************************************************************************************/
+class MsvVirtualThreading:
+	public MsvThreading
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spVirtualScheduler			Scheduler which drives events and unique workers.
+	******************************************************************************************************/
+	MsvVirtualThreading(std::shared_ptr<IMsvVirtualScheduler> spVirtualScheduler);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~MsvVirtualThreading();
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreading::GetEvent(std::shared_ptr<IMsvEvent>& spEvent) const
+	******************************************************************************************************/
+	virtual MsvErrorCode GetEvent(std::shared_ptr<IMsvEvent>& spEvent) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreading::GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<std::condition_variable> spConditionVariable = nullptr, std::shared_ptr<std::mutex> spConditionVariableMutex = nullptr, std::shared_ptr<uint64_t> spConditionVariablePredicate = nullptr) const
+	* @note			Synchronization objects are ignored (worker is driven by virtual time only).
+	******************************************************************************************************/
+	virtual MsvErrorCode GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<std::condition_variable> spConditionVariable = nullptr, std::shared_ptr<std::mutex> spConditionVariableMutex = nullptr, std::shared_ptr<uint64_t> spConditionVariablePredicate = nullptr) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvThreading::GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<IMsvNotifier> spNotifier) const
+	* @note			Notifier is ignored (worker is driven by virtual time only).
+	******************************************************************************************************/
+	virtual MsvErrorCode GetUniqueWorker(std::shared_ptr<IMsvUniqueWorker>& spUniqueWorker, std::shared_ptr<IMsvNotifier> spNotifier) const override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Virtual scheduler.
+	* @details	Scheduler which drives events and unique workers.
+	******************************************************************************************************/
+	std::shared_ptr<IMsvVirtualScheduler> m_spVirtualScheduler;
+};
+
+
+#endif // !MARSTECH_VIRTUALTHREADING_H
+
+/** @} */	//End of group MSYS.
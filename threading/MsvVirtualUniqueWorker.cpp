@@ -0,0 +1,154 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Virtual Unique Worker
+* @details		Contains implementation of @ref MsvVirtualUniqueWorker.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvVirtualUniqueWorker.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvVirtualUniqueWorker::MsvVirtualUniqueWorker(std::shared_ptr<IMsvVirtualScheduler> spScheduler):
+	m_spWeakScheduler(spScheduler),
+	m_pContext(nullptr),
+	m_periodicTaskId(0)
+{
+
+}
+
+
+MsvVirtualUniqueWorker::~MsvVirtualUniqueWorker()
+{
+	StopThread();
+}
+
+
+/********************************************************************************************************************************
+*															IMsvUniqueWorker public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvVirtualUniqueWorker::SetTask(std::function<void(void*)> task, void* pContext)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_spRunning)
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	m_task = task;
+	m_pContext = pContext;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvVirtualUniqueWorker::StartThread(uint64_t period)
+{
+	std::shared_ptr<IMsvVirtualScheduler> spScheduler = m_spWeakScheduler.lock();
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_spRunning)
+	{
+		return MSV_ALREADY_RUNNING_INFO;
+	}
+
+	if (!m_task || !spScheduler)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	std::shared_ptr<std::atomic<bool>> spRunning(new (std::nothrow) std::atomic<bool>(true));
+	if (!spRunning)
+	{
+		return MSV_ALLOCATION_ERROR;
+	}
+
+	//task might be scheduled after worker has been stopped (or destroyed) -> it checks running flag
+	std::function<void(void*)> task = m_task;
+	std::function<void(void*)> workerTask = [spRunning, task](void* pContext)
+	{
+		if (*spRunning)
+		{
+			task(pContext);
+		}
+	};
+
+	if (period == 0)
+	{
+		MSV_RETURN_FAILED(spScheduler->AddTask(workerTask, m_pContext));
+	}
+	else
+	{
+		MSV_RETURN_FAILED(spScheduler->AddPeriodicTask(m_periodicTaskId, workerTask, m_pContext, period));
+	}
+
+	m_spRunning = spRunning;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvVirtualUniqueWorker::StopThread()
+{
+	std::shared_ptr<IMsvVirtualScheduler> spScheduler = m_spWeakScheduler.lock();
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (!m_spRunning)
+	{
+		return MSV_NOT_RUNNING_INFO;
+	}
+
+	*m_spRunning = false;
+	m_spRunning.reset();
+
+	if (m_periodicTaskId != 0 && spScheduler)
+	{
+		spScheduler->RemovePeriodicTask(m_periodicTaskId);
+	}
+
+	m_periodicTaskId = 0;
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvVirtualUniqueWorker::WaitForThreadStop()
+{
+	return MSV_SUCCESS;
+}
+
+/** @} */	//End of group MSYS.
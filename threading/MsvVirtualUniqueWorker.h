@@ -0,0 +1,152 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Virtual Unique Worker
+* @details		Contains implementation @ref MsvVirtualUniqueWorker of @ref IMsvUniqueWorker interface driven by virtual time.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_VIRTUALUNIQUEWORKER_H
+#define MARSTECH_VIRTUALUNIQUEWORKER_H
+
+
+#include "mthreading/IMsvUniqueWorker.h"
+
+#include "IMsvVirtualScheduler.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Virtual Unique Worker.
+* @details	Implementation of @ref IMsvUniqueWorker driven by virtual time of @ref IMsvVirtualScheduler.
+*				Worker period is periodic task of scheduler, so existing users of @ref IMsvUniqueWorker run in
+*				virtual time without changes.
+* @see		IMsvUniqueWorker
+* @see		IMsvThreading::GetVirtualThreading
+******************************************************************************************************/
+class MsvVirtualUniqueWorker:
+	public IMsvUniqueWorker
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	spScheduler			Scheduler which drives this worker.
+	******************************************************************************************************/
+	MsvVirtualUniqueWorker(std::shared_ptr<IMsvVirtualScheduler> spScheduler);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Stops worker (its task is not executed anymore).
+	******************************************************************************************************/
+	virtual ~MsvVirtualUniqueWorker();
+
+	/**************************************************************************************************//**
+	* @brief			Set task.
+	* @param[in]	task								Task to execute.
+	* @param[in]	pContext							Context passed to task.
+	* @retval		MSV_ALREADY_RUNNING_INFO		When worker is running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode SetTask(std::function<void(void*)> task, void* pContext) override;
+
+	/**************************************************************************************************//**
+	* @brief			Start thread.
+	* @details		Schedules task each period of virtual time (task is executed once when period is 0).
+	* @param[in]	period							Period in virtual microseconds.
+	* @retval		MSV_ALREADY_RUNNING_INFO		When worker is already running.
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When task is not set or scheduler has been destroyed.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode StartThread(uint64_t period = 0) override;
+
+	/**************************************************************************************************//**
+	* @brief			Stop thread.
+	* @details		Task is not executed anymore (scheduled executions are dropped).
+	* @retval		MSV_NOT_RUNNING_INFO			When worker is not running.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode StopThread() override;
+
+	/**************************************************************************************************//**
+	* @brief			Wait for thread stop.
+	* @details		Returns immediately (there is no thread, task is executed by scheduler).
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode WaitForThreadStop() override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access.
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Scheduler.
+	* @details	Scheduler which drives this worker (worker might outlive it).
+	******************************************************************************************************/
+	std::weak_ptr<IMsvVirtualScheduler> m_spWeakScheduler;
+
+	/**************************************************************************************************//**
+	* @brief		Task.
+	* @details	Task executed by worker.
+	******************************************************************************************************/
+	std::function<void(void*)> m_task;
+
+	/**************************************************************************************************//**
+	* @brief		Task context.
+	* @details	Context passed to task.
+	******************************************************************************************************/
+	void* m_pContext;
+
+	/**************************************************************************************************//**
+	* @brief		Periodic task ID.
+	* @details	ID of scheduler periodic task (0 when task is not periodic).
+	******************************************************************************************************/
+	uint64_t m_periodicTaskId;
+
+	/**************************************************************************************************//**
+	* @brief		Running flag.
+	* @details	Shared with scheduled task (it is not executed when worker has been stopped). Nullptr when
+	*				worker is not running.
+	******************************************************************************************************/
+	std::shared_ptr<std::atomic<bool>> m_spRunning;
+};
+
+
+#endif // !MARSTECH_VIRTUALUNIQUEWORKER_H
+
+/** @} */	//End of group MSYS.
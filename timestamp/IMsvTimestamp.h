@@ -0,0 +1,109 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Timestamp Interface
+* @details		Contains definition of @ref IMsvTimestamp interface.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_ITIMESTAMP_H
+#define MARSTECH_ITIMESTAMP_H
+
+
+#include "merror/MsvError.h"
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <chrono>
+#include <cstdint>
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Timestamp Interface.
+* @details	Cheap timestamp source for logging and tracing. Hot paths store raw ticks (CPU time stamp
+*				counter when it is available, steady clock other way) and convert them to wall time lazily
+*				(when records are formatted or flushed). Ticks are calibrated against system clock and
+*				calibration is refreshed periodically in background thread (drift of tick frequency and
+*				system clock adjustments are corrected).
+* @note		Ticks are monotonic and they might be compared directly. Only conversion to wall time depends on
+*				calibration.
+******************************************************************************************************/
+class IMsvTimestamp
+{
+public:
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	******************************************************************************************************/
+	virtual ~IMsvTimestamp() {}
+
+	/**************************************************************************************************//**
+	* @brief			Get ticks.
+	* @details		Returns raw ticks (no conversion).
+	* @returns		uint64_t
+	******************************************************************************************************/
+	virtual uint64_t GetTicks() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Get ticks frequency.
+	* @details		Returns calibrated number of ticks per second.
+	* @returns		uint64_t
+	******************************************************************************************************/
+	virtual uint64_t GetTicksFrequency() const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Ticks to time.
+	* @details		Converts ticks to wall time (by current calibration).
+	* @param[in]	ticks				Ticks (see @ref GetTicks).
+	* @returns		std::chrono::system_clock::time_point
+	******************************************************************************************************/
+	virtual std::chrono::system_clock::time_point TicksToTime(uint64_t ticks) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Time to ticks.
+	* @details		Converts wall time to ticks (by current calibration).
+	* @param[in]	time				Wall time.
+	* @returns		uint64_t
+	******************************************************************************************************/
+	virtual uint64_t TimeToTicks(std::chrono::system_clock::time_point time) const = 0;
+
+	/**************************************************************************************************//**
+	* @brief			Calibrate.
+	* @details		Measures tick frequency since last calibration and updates conversion to wall time. It is
+	*					called periodically by background thread.
+	* @retval		MSV_NOT_INITIALIZED_ERROR	When timestamp has not been initialized.
+	* @retval		MSV_SUCCESS						On success.
+	******************************************************************************************************/
+	virtual MsvErrorCode Calibrate() = 0;
+};
+
+
+#endif // !MARSTECH_ITIMESTAMP_H
+
+/** @} */	//End of group MSYS.
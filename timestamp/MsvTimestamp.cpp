@@ -0,0 +1,255 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Timestamp Implementation
+* @details		Contains implementation of @ref MsvTimestamp class.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#include "MsvTimestamp.h"
+
+#include "merror/MsvErrorCodes.h"
+
+
+/**************************************************************************************************//**
+* @brief		Minimum measure interval.
+* @details	Tick frequency is measured only when interval since last calibration point is longer (in
+*				nanoseconds), previous frequency is kept other way.
+******************************************************************************************************/
+#define MSV_TIMESTAMP_MIN_MEASURE_INTERVAL 1000000
+
+
+/********************************************************************************************************************************
+*															Constructors and destructors
+********************************************************************************************************************************/
+
+
+MsvTimestamp::MsvTimestamp(uint32_t calibrationPeriod):
+	m_calibrationPeriod(calibrationPeriod),
+	m_calibrationVersion(0),
+	m_lastTicks(0),
+	m_initialized(false),
+	m_running(false)
+{
+	for (MsvTimestampCalibration& calibration: m_calibrations)
+	{
+		calibration.baseTicks.store(0, std::memory_order_relaxed);
+		calibration.baseTime.store(0, std::memory_order_relaxed);
+		calibration.nanosecondsPerTick.store(1.0, std::memory_order_relaxed);
+	}
+}
+
+
+MsvTimestamp::~MsvTimestamp()
+{
+	Uninitialize();
+}
+
+
+/********************************************************************************************************************************
+*															MsvTimestamp public methods
+********************************************************************************************************************************/
+
+
+MsvErrorCode MsvTimestamp::Initialize()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	if (m_initialized)
+	{
+		return MSV_ALREADY_INITIALIZED_INFO;
+	}
+
+	//first calibration point -> wait a while -> measure tick frequency from second point
+	m_lastTicks = ReadTicks();
+	m_lastSteadyTime = std::chrono::steady_clock::now();
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	UpdateCalibration();
+
+	m_initialized = true;
+
+	if (m_calibrationPeriod > 0)
+	{
+		m_running = true;
+		m_thread = std::thread(&MsvTimestamp::CalibrationThread, this);
+	}
+
+	return MSV_SUCCESS;
+}
+
+MsvErrorCode MsvTimestamp::Uninitialize()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+
+		if (!m_initialized)
+		{
+			return MSV_NOT_INITIALIZED_INFO;
+		}
+
+		m_initialized = false;
+		m_running = false;
+	}
+
+	m_condition.notify_all();
+	if (m_thread.joinable())
+	{
+		m_thread.join();
+	}
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															IMsvTimestamp public methods
+********************************************************************************************************************************/
+
+
+uint64_t MsvTimestamp::GetTicks() const
+{
+	return ReadTicks();
+}
+
+uint64_t MsvTimestamp::GetTicksFrequency() const
+{
+	uint64_t baseTicks = 0;
+	int64_t baseTime = 0;
+	double nanosecondsPerTick = 0;
+	ReadCalibration(baseTicks, baseTime, nanosecondsPerTick);
+
+	return static_cast<uint64_t>(1000000000.0 / nanosecondsPerTick);
+}
+
+std::chrono::system_clock::time_point MsvTimestamp::TicksToTime(uint64_t ticks) const
+{
+	uint64_t baseTicks = 0;
+	int64_t baseTime = 0;
+	double nanosecondsPerTick = 0;
+	ReadCalibration(baseTicks, baseTime, nanosecondsPerTick);
+
+	//ticks might be older than calibration point -> signed difference
+	int64_t ticksDifference = static_cast<int64_t>(ticks - baseTicks);
+	int64_t time = baseTime + static_cast<int64_t>(static_cast<double>(ticksDifference) * nanosecondsPerTick);
+
+	return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(time)));
+}
+
+uint64_t MsvTimestamp::TimeToTicks(std::chrono::system_clock::time_point time) const
+{
+	uint64_t baseTicks = 0;
+	int64_t baseTime = 0;
+	double nanosecondsPerTick = 0;
+	ReadCalibration(baseTicks, baseTime, nanosecondsPerTick);
+
+	int64_t timeDifference = std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count() - baseTime;
+
+	return baseTicks + static_cast<uint64_t>(static_cast<int64_t>(static_cast<double>(timeDifference) / nanosecondsPerTick));
+}
+
+MsvErrorCode MsvTimestamp::Calibrate()
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (!m_initialized)
+	{
+		return MSV_NOT_INITIALIZED_ERROR;
+	}
+
+	UpdateCalibration();
+
+	return MSV_SUCCESS;
+}
+
+
+/********************************************************************************************************************************
+*															MsvTimestamp protected methods
+********************************************************************************************************************************/
+
+
+void MsvTimestamp::CalibrationThread()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	while (!m_condition.wait_for(lock, std::chrono::milliseconds(m_calibrationPeriod), [this] { return !m_running; }))
+	{
+		UpdateCalibration();
+	}
+}
+
+void MsvTimestamp::UpdateCalibration()
+{
+	//system time is read between two tick reads -> its ticks are in the middle
+	uint64_t ticksBefore = ReadTicks();
+	std::chrono::system_clock::time_point systemTime = std::chrono::system_clock::now();
+	uint64_t ticksAfter = ReadTicks();
+	std::chrono::steady_clock::time_point steadyTime = std::chrono::steady_clock::now();
+
+	uint64_t ticks = ticksBefore + (ticksAfter - ticksBefore) / 2;
+	uint32_t version = m_calibrationVersion.load(std::memory_order_relaxed);
+	double nanosecondsPerTick = m_calibrations[version & 1].nanosecondsPerTick.load(std::memory_order_relaxed);
+
+	int64_t steadyDifference = std::chrono::duration_cast<std::chrono::nanoseconds>(steadyTime - m_lastSteadyTime).count();
+	if (steadyDifference >= MSV_TIMESTAMP_MIN_MEASURE_INTERVAL && ticks > m_lastTicks)
+	{
+		nanosecondsPerTick = static_cast<double>(steadyDifference) / static_cast<double>(ticks - m_lastTicks);
+		m_lastTicks = ticks;
+		m_lastSteadyTime = steadyTime;
+	}
+
+	//write unpublished block and publish it (reader of this block from previous version retries, the fence
+	//orders previous publication before these stores)
+	std::atomic_thread_fence(std::memory_order_release);
+	MsvTimestampCalibration& calibration = m_calibrations[(version + 1) & 1];
+	calibration.baseTicks.store(ticks, std::memory_order_relaxed);
+	calibration.baseTime.store(std::chrono::duration_cast<std::chrono::nanoseconds>(systemTime.time_since_epoch()).count(), std::memory_order_relaxed);
+	calibration.nanosecondsPerTick.store(nanosecondsPerTick, std::memory_order_relaxed);
+
+	m_calibrationVersion.store(version + 1, std::memory_order_release);
+}
+
+void MsvTimestamp::ReadCalibration(uint64_t& baseTicks, int64_t& baseTime, double& nanosecondsPerTick) const
+{
+	uint32_t version = 0;
+
+	do
+	{
+		version = m_calibrationVersion.load(std::memory_order_acquire);
+
+		const MsvTimestampCalibration& calibration = m_calibrations[version & 1];
+		baseTicks = calibration.baseTicks.load(std::memory_order_relaxed);
+		baseTime = calibration.baseTime.load(std::memory_order_relaxed);
+		nanosecondsPerTick = calibration.nanosecondsPerTick.load(std::memory_order_relaxed);
+
+		//block is rewritten after next calibration has been published -> retry when version has changed
+		std::atomic_thread_fence(std::memory_order_acquire);
+	}
+	while (m_calibrationVersion.load(std::memory_order_relaxed) != version);
+}
+
+/** @} */	//End of group MSYS.
@@ -0,0 +1,254 @@
+/**************************************************************************************************//**
+* @addtogroup	MSYS
+* @{
+******************************************************************************************************/
+
+/**************************************************************************************************//**
+* @file
+* @brief			MarsTech Timestamp Implementation
+* @details		Contains definition of @ref MsvTimestamp class.
+* @author		Martin Svoboda
+* @date			19.10.2026
+* @copyright	GNU General Public License (GPLv3).
+******************************************************************************************************/
+
+
+/*
+This file is part of MarsTech C++ SYS Library.
+
+MarsTech Dependency Injection is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+MarsTech Promise Like Syntax is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Foobar. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef MARSTECH_TIMESTAMP_H
+#define MARSTECH_TIMESTAMP_H
+
+
+#include "IMsvTimestamp.h"
+
+/**************************************************************************************************//**
+* @brief		Time stamp counter ticks.
+* @details	When it is 1, ticks are read from CPU time stamp counter (RDTSC), steady clock is used other way.
+*				Define it (for whole project) to override default value.
+* @note		Default value is 1 for x86 and x64 platforms (invariant TSC is expected) and 0 other way.
+******************************************************************************************************/
+#ifndef MSV_TIMESTAMP_TSC
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define MSV_TIMESTAMP_TSC 1
+#else
+#define MSV_TIMESTAMP_TSC 0
+#endif
+#endif
+
+MSV_DISABLE_ALL_WARNINGS
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if MSV_TIMESTAMP_TSC
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+MSV_ENABLE_WARNINGS
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Timestamp Calibration.
+* @details	Conversion of ticks to wall time. Calibration is published by version (see
+*				@ref MsvTimestamp::m_calibrationVersion), members are atomic to be read while next calibration
+*				is written to the other block.
+******************************************************************************************************/
+struct MsvTimestampCalibration
+{
+	std::atomic<uint64_t> baseTicks;						///< Ticks of calibration point.
+	std::atomic<int64_t> baseTime;						///< System time of calibration point (nanoseconds since epoch).
+	std::atomic<double> nanosecondsPerTick;			///< Calibrated tick period (in nanoseconds).
+};
+
+
+/**************************************************************************************************//**
+* @brief		MarsTech Timestamp Implementation.
+* @details	Implementation of timestamp interface. Ticks are read without any locking and conversion reads
+*				current calibration as seqlock (version is read before and after calibration block).
+* @see		IMsvTimestamp
+******************************************************************************************************/
+class MsvTimestamp:
+	public IMsvTimestamp
+{
+public:
+	/**************************************************************************************************//**
+	* @brief			Constructor.
+	* @param[in]	calibrationPeriod			Calibration period (in milliseconds).
+	******************************************************************************************************/
+	MsvTimestamp(uint32_t calibrationPeriod = 1000);
+
+	/**************************************************************************************************//**
+	* @brief		Virtual destructor.
+	* @details	Stops calibration thread.
+	******************************************************************************************************/
+	virtual ~MsvTimestamp();
+
+	/**************************************************************************************************//**
+	* @brief			Initialize.
+	* @details		Measures tick frequency (it takes several milliseconds) and starts calibration thread.
+	* @retval		MSV_ALREADY_INITIALIZED_INFO	When timestamp has been already initialized.
+	* @retval		MSV_SUCCESS							On success.
+	******************************************************************************************************/
+	MsvErrorCode Initialize();
+
+	/**************************************************************************************************//**
+	* @brief			Uninitialize.
+	* @details		Stops calibration thread (last calibration is used).
+	* @retval		MSV_NOT_INITIALIZED_INFO		When timestamp has not been initialized.
+	* @retval		MSV_SUCCESS							On success.
+	******************************************************************************************************/
+	MsvErrorCode Uninitialize();
+
+	/**************************************************************************************************//**
+	* @brief			Read ticks.
+	* @details		Reads raw ticks (it is inlined to hot paths, see @ref GetTicks).
+	* @returns		uint64_t
+	******************************************************************************************************/
+	static inline uint64_t ReadTicks()
+	{
+#if MSV_TIMESTAMP_TSC
+		return __rdtsc();
+#else
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+	}
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTimestamp::GetTicks() const
+	******************************************************************************************************/
+	virtual uint64_t GetTicks() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTimestamp::GetTicksFrequency() const
+	******************************************************************************************************/
+	virtual uint64_t GetTicksFrequency() const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTimestamp::TicksToTime(uint64_t ticks) const
+	******************************************************************************************************/
+	virtual std::chrono::system_clock::time_point TicksToTime(uint64_t ticks) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTimestamp::TimeToTicks(std::chrono::system_clock::time_point time) const
+	******************************************************************************************************/
+	virtual uint64_t TimeToTicks(std::chrono::system_clock::time_point time) const override;
+
+	/**************************************************************************************************//**
+	* @copydoc IMsvTimestamp::Calibrate()
+	******************************************************************************************************/
+	virtual MsvErrorCode Calibrate() override;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief			Calibration thread.
+	* @details		Calibrates ticks periodically until it is stopped.
+	******************************************************************************************************/
+	void CalibrationThread();
+
+	/**************************************************************************************************//**
+	* @brief			Update calibration.
+	* @details		Reads calibration point and publishes new calibration.
+	* @warning		It must be called under lock.
+	******************************************************************************************************/
+	void UpdateCalibration();
+
+	/**************************************************************************************************//**
+	* @brief			Read calibration.
+	* @details		Reads published calibration block consistently (it is read again when calibration version
+	*					changes while block is read).
+	* @param[out]	baseTicks							Ticks of calibration point.
+	* @param[out]	baseTime								System time of calibration point (nanoseconds since epoch).
+	* @param[out]	nanosecondsPerTick				Calibrated tick period (in nanoseconds).
+	******************************************************************************************************/
+	void ReadCalibration(uint64_t& baseTicks, int64_t& baseTime, double& nanosecondsPerTick) const;
+
+protected:
+	/**************************************************************************************************//**
+	* @brief		Thread mutex.
+	* @details	Locks this object for thread safety access (calibration is not locked for reading).
+	******************************************************************************************************/
+	std::mutex m_lock;
+
+	/**************************************************************************************************//**
+	* @brief		Condition.
+	* @details	Wakes calibration thread when it is stopped.
+	******************************************************************************************************/
+	std::condition_variable m_condition;
+
+	/**************************************************************************************************//**
+	* @brief		Calibration period.
+	* @details	Calibration period (in milliseconds).
+	******************************************************************************************************/
+	uint32_t m_calibrationPeriod;
+
+	/**************************************************************************************************//**
+	* @brief		Calibrations.
+	* @details	Published and next calibration.
+	******************************************************************************************************/
+	MsvTimestampCalibration m_calibrations[2];
+
+	/**************************************************************************************************//**
+	* @brief		Calibration version.
+	* @details	Number of published calibrations (published block is version & 1, the other block is written
+	*				by next calibration).
+	******************************************************************************************************/
+	std::atomic<uint32_t> m_calibrationVersion;
+
+	/**************************************************************************************************//**
+	* @brief		Last ticks.
+	* @details	Ticks of last calibration point (tick frequency is measured from it).
+	******************************************************************************************************/
+	uint64_t m_lastTicks;
+
+	/**************************************************************************************************//**
+	* @brief		Last steady time.
+	* @details	Steady time of last calibration point (system time might be adjusted, so it is not used to
+	*				measure tick frequency).
+	******************************************************************************************************/
+	std::chrono::steady_clock::time_point m_lastSteadyTime;
+
+	/**************************************************************************************************//**
+	* @brief		Calibration thread.
+	* @details	Background thread which calibrates ticks.
+	******************************************************************************************************/
+	std::thread m_thread;
+
+	/**************************************************************************************************//**
+	* @brief		Initialized flag.
+	* @details	True when timestamp has been initialized.
+	******************************************************************************************************/
+	bool m_initialized;
+
+	/**************************************************************************************************//**
+	* @brief		Running flag.
+	* @details	True when calibration thread is running.
+	******************************************************************************************************/
+	bool m_running;
+};
+
+
+#endif // !MARSTECH_TIMESTAMP_H
+
+/** @} */	//End of group MSYS.